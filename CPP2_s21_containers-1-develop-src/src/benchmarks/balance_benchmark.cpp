@@ -0,0 +1,100 @@
+// Compares the red-black and AVL balance policies of RedBlackTree on the same
+// workloads: build time, lookup time, erase time and the resulting shape.
+//
+//   make benchmark
+//   ./benchmarks/balance_benchmark.cc [element_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_red_black_tree/RedBlackTree.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename NodeT>
+void SumDepths(const NodeT *node, const NodeT *nil, size_t depth,
+               size_t &total) {
+  if (node == nil) {
+    return;
+  }
+  total += depth;
+  SumDepths(node->left_, nil, depth + 1, total);
+  SumDepths(node->right_, nil, depth + 1, total);
+}
+
+template <typename Balance>
+void Run(const char *policy, const char *workload,
+         const std::vector<int> &keys, const std::vector<int> &probes) {
+  using Tree = s21::RedBlackTree<int, std::less<int>, s21::Identity<int>,
+                                 Balance>;
+  Tree tree;
+
+  Clock::time_point start = Clock::now();
+  for (int key : keys) {
+    tree.Insert(key);
+  }
+  double insert_ms = ElapsedMs(start);
+
+  size_t depth_sum = 0;
+  SumDepths(tree.GetRoot(), tree.GetNil(), 1, depth_sum);
+  s21::TreeStats stats = tree.GetStats();
+
+  start = Clock::now();
+  size_t hits = 0;
+  for (int probe : probes) {
+    hits += tree.FindNode(probe) != nullptr;
+  }
+  double find_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  for (size_t i = 0; i < keys.size(); i += 2) {
+    auto *node = tree.FindNode(keys[i]);
+    if (node != nullptr) {
+      tree.RemoveNode(node);
+    }
+  }
+  double erase_ms = ElapsedMs(start);
+
+  std::printf("%-10s %-10s %10.2f %10.2f %10.2f %7zu %10.2f %8s\n", policy,
+              workload, insert_ms, find_ms, erase_ms, stats.height,
+              static_cast<double>(depth_sum) / stats.node_count,
+              tree.Validate() && hits == probes.size() ? "ok" : "BROKEN");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+  std::vector<int> sequential(count);
+  for (size_t i = 0; i < count; ++i) {
+    sequential[i] = static_cast<int>(i);
+  }
+  std::vector<int> shuffled = sequential;
+  std::mt19937 rng(42);
+  std::shuffle(shuffled.begin(), shuffled.end(), rng);
+  std::vector<int> probes = shuffled;
+  std::shuffle(probes.begin(), probes.end(), rng);
+
+  std::printf("%zu elements\n", count);
+  std::printf("%-10s %-10s %10s %10s %10s %7s %10s %8s\n", "policy",
+              "workload", "insert ms", "find ms", "erase ms", "height",
+              "avg depth", "check");
+  Run<s21::RedBlackBalance>("red-black", "random", shuffled, probes);
+  Run<s21::AvlBalance>("avl", "random", shuffled, probes);
+  Run<s21::RedBlackBalance>("red-black", "sequential", sequential, probes);
+  Run<s21::AvlBalance>("avl", "sequential", sequential, probes);
+  return 0;
+}
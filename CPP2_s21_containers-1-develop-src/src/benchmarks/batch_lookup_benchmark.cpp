@@ -0,0 +1,82 @@
+// Compares a find() loop against find_many() on batches of random keys, for
+// a map large enough that most descents miss the cache.
+//
+//   make benchmark
+//   ./benchmarks/batch_lookup_benchmark.cc [element_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+  std::vector<int> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    keys[i] = static_cast<int>(i * 2);
+  }
+  std::mt19937 rng(42);
+  std::shuffle(keys.begin(), keys.end(), rng);
+
+  s21::map<int, int> map;
+  for (int key : keys) {
+    map.insert(key, key);
+  }
+
+  // Half of the probes hit, half fall between stored keys
+  std::vector<int> probes(count);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(count * 2));
+  for (int &probe : probes) {
+    probe = dist(rng);
+  }
+
+  std::printf("%zu elements\n", count);
+  std::printf("%-8s %12s %12s %8s\n", "batch", "find ms", "find_many ms",
+              "speedup");
+  using iterator = s21::map<int, int>::iterator;
+  for (size_t batch : {16, 64, 256, 1024}) {
+    std::vector<iterator> out(batch);
+    long long sink_single = 0;
+    long long sink_batched = 0;
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i + batch <= probes.size(); i += batch) {
+      for (size_t j = 0; j < batch; ++j) {
+        iterator it = map.find(probes[i + j]);
+        sink_single += it == map.end() ? 0 : it->second;
+      }
+    }
+    double single_ms = ElapsedMs(start);
+
+    start = Clock::now();
+    for (size_t i = 0; i + batch <= probes.size(); i += batch) {
+      map.find_many(probes.begin() + i, probes.begin() + i + batch,
+                    out.begin());
+      for (const iterator &it : out) {
+        sink_batched += it == map.end() ? 0 : it->second;
+      }
+    }
+    double batched_ms = ElapsedMs(start);
+
+    std::printf("%-8zu %12.2f %12.2f %7.2fx%s\n", batch, single_ms,
+                batched_ms, single_ms / batched_ms,
+                sink_single == sink_batched ? "" : "  MISMATCH");
+  }
+  return 0;
+}
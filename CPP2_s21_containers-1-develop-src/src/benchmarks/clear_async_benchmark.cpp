@@ -0,0 +1,67 @@
+// Fills a map of strings and a list of strings, then reports how long the
+// caller is blocked by clear() and by clear_async(), and how long the
+// background thread still needs to finish the detached clear.
+//
+//   make benchmark
+//   ./benchmarks/clear_async_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "../s21_list/s21_list.h"
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+std::string Value(int i) {
+  return "value number " + std::to_string(i) + " long enough for the heap";
+}
+
+template <typename Container, typename Fill>
+void Clear(const char *label, int count, Fill fill) {
+  Container blocking;
+  fill(blocking, count);
+  Clock::time_point start = Clock::now();
+  blocking.clear();
+  double sync_ms = ElapsedMs(start);
+
+  Container detached;
+  fill(detached, count);
+  start = Clock::now();
+  detached.clear_async();
+  double async_ms = ElapsedMs(start);
+  start = Clock::now();
+  s21::Reclaimer::Instance().Drain();
+  std::printf("%-6s %12.2f %12.2f %12.2f\n", label, sync_ms, async_ms,
+              ElapsedMs(start));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  std::printf("%-6s %12s %12s %12s\n", "", "clear ms", "async ms",
+              "drain ms");
+  Clear<s21::map<int, std::string>>(
+      "map", count, [](s21::map<int, std::string> &map, int n) {
+        for (int i = 0; i < n; ++i) {
+          map.insert(i, Value(i));
+        }
+      });
+  Clear<s21::list<std::string>>(
+      "list", count, [](s21::list<std::string> &list, int n) {
+        for (int i = 0; i < n; ++i) {
+          list.push_back(Value(i));
+        }
+      });
+  return 0;
+}
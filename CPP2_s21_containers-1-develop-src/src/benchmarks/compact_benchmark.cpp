@@ -0,0 +1,85 @@
+// Ages a map with rounds of random erases and inserts, so that neighbouring
+// keys end up in unrelated nodes, then times a full scan and a batch of
+// random lookups before and after compact() in either layout.
+//
+//   make benchmark
+//   ./benchmarks/compact_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+void Measure(const char *label, s21::map<int, int> &map,
+             const s21::vector<int> &probes) {
+  Clock::time_point start = Clock::now();
+  long long sum = 0;
+  for (auto &item : map) {
+    sum += item.second;
+  }
+  double scan_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  size_t hits = 0;
+  for (size_t i = 0; i < probes.size(); ++i) {
+    hits += map.contains(probes.data()[i]) ? 1 : 0;
+  }
+  double lookup_ms = ElapsedMs(start);
+  std::printf("%-22s %10.2f %12.2f   (%lld, %zu)\n", label, scan_ms,
+              lookup_ms, sum, hits);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> keys(0, count * 4);
+
+  s21::map<int, int> map;
+  while (map.size() < static_cast<size_t>(count)) {
+    int key = keys(rng);
+    map.insert(key, key);
+  }
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < count / 2; ++i) {
+      auto it = map.lower_bound(keys(rng));
+      if (it != map.end()) {
+        map.erase(it);
+      }
+    }
+    while (map.size() < static_cast<size_t>(count)) {
+      int key = keys(rng);
+      map.insert(key, key);
+    }
+  }
+
+  s21::vector<int> probes;
+  for (int i = 0; i < count; ++i) {
+    probes.push_back(keys(rng));
+  }
+
+  std::printf("%-22s %10s %12s\n", "layout", "scan ms", "lookup ms");
+  Measure("aged", map, probes);
+  Clock::time_point start = Clock::now();
+  map.compact();
+  std::printf("compact(): %.2f ms\n", ElapsedMs(start));
+  Measure("in-order", map, probes);
+  start = Clock::now();
+  map.compact(s21::NodeLayout::kVanEmdeBoas);
+  std::printf("compact(vEB): %.2f ms\n", ElapsedMs(start));
+  Measure("van Emde Boas", map, probes);
+  return 0;
+}
@@ -0,0 +1,60 @@
+// Refreshes a cached map from its source over and over, as a periodic
+// cache reload would, once by clearing it and inserting every entry again
+// and once with the copy assignment, which reuses the cached map's nodes
+// and copies the source's shape.
+//
+//   make benchmark
+//   ./benchmarks/copy_assign_benchmark.cc [element_count] [refreshes]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 200000;
+  int refreshes = argc > 2 ? std::atoi(argv[2]) : 10;
+  s21::map<int, std::string> source;
+  for (int i = 0; i < count; ++i) {
+    source.insert(static_cast<int>((i * 2654435761u) % 1000000007u),
+                  "value of some length " + std::to_string(i));
+  }
+
+  s21::map<int, std::string> reinserted(source);
+  Clock::time_point start = Clock::now();
+  for (int round = 0; round < refreshes; ++round) {
+    reinserted.clear();
+    for (const auto &item : source) {
+      reinserted.insert(item);
+    }
+  }
+  double reinsert_ms = ElapsedMs(start) / refreshes;
+
+  s21::map<int, std::string> assigned(source);
+  start = Clock::now();
+  for (int round = 0; round < refreshes; ++round) {
+    assigned = source;
+  }
+  double assign_ms = ElapsedMs(start) / refreshes;
+  if (assigned.size() != reinserted.size()) {
+    std::printf("size mismatch\n");
+    return 1;
+  }
+  std::printf("%d entries, ms per refresh\n", count);
+  std::printf("clear + insert %10.2f\n", reinsert_ms);
+  std::printf("operator=      %10.2f\n", assign_ms);
+  return 0;
+}
@@ -0,0 +1,67 @@
+// Passes a map by value through a chain of read-only stages, as a pipeline
+// does, once with map (every hop copies the tree) and once with cow_map
+// (every hop shares it), and then times the first write to a shared copy.
+//
+//   make benchmark
+//   ./benchmarks/cow_copy_benchmark.cc [stage_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_cow_map/s21_cow_map.h"
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Map>
+long long ReadStage(Map map, int key) {
+  return map.contains(key) ? 1 : 0;
+}
+
+template <typename Map>
+double RunPipeline(Map &map, size_t stages, long long *hits) {
+  Clock::time_point start = Clock::now();
+  for (size_t stage = 0; stage < stages; ++stage) {
+    *hits += ReadStage(map, static_cast<int>(stage));
+  }
+  return ElapsedMs(start);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t stages = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100;
+
+  std::printf("%-10s %12s %12s %8s %14s\n", "elements", "map ms", "cow ms",
+              "speedup", "first write ms");
+  for (int count : {1000, 100000, 1000000}) {
+    s21::map<int, int> map;
+    s21::cow_map<int, int> cow;
+    for (int i = 0; i < count; ++i) {
+      map.insert(i, i);
+      cow.insert(i, i);
+    }
+    long long map_hits = 0;
+    long long cow_hits = 0;
+    double map_ms = RunPipeline(map, stages, &map_hits);
+    double cow_ms = RunPipeline(cow, stages, &cow_hits);
+
+    s21::cow_map<int, int> copy(cow);
+    Clock::time_point start = Clock::now();
+    copy[0] = -1;
+    double write_ms = ElapsedMs(start);
+
+    std::printf("%-10d %12.2f %12.4f %7.0fx %14.2f%s\n", count, map_ms,
+                cow_ms, map_ms / cow_ms, write_ms,
+                map_hits == cow_hits ? "" : "  MISMATCH");
+  }
+  return 0;
+}
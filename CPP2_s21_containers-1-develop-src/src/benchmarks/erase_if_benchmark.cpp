@@ -0,0 +1,62 @@
+// Expires a fraction of a map's entries, as a TTL sweep would, once with a
+// loop of erase(iterator) calls and once with s21::erase_if, which rebuilds
+// the tree in one pass when enough entries go.
+//
+//   make benchmark
+//   ./benchmarks/erase_if_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+// Keys are random, expiry times are spread evenly over [0, 1000)
+void Fill(s21::map<int, int> &map, int count) {
+  for (int i = 0; i < count; ++i) {
+    map.insert(static_cast<int>((i * 2654435761u) % 1000000007u),
+               static_cast<int>((i * 40503u) % 1000u));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::printf("%-10s %12s %12s\n", "expired", "loop ms", "erase_if ms");
+  const int per_mille[] = {10, 100, 250, 500, 600, 750, 900, 990};
+  for (int now : per_mille) {
+    auto expired = [now](const std::pair<const int, int> &entry) {
+      return entry.second < now;
+    };
+    s21::map<int, int> looped;
+    Fill(looped, count);
+    Clock::time_point start = Clock::now();
+    for (auto it = looped.begin(); it != looped.end();) {
+      it = expired(*it) ? looped.erase(it) : std::next(it);
+    }
+    double loop_ms = ElapsedMs(start);
+
+    s21::map<int, int> swept;
+    Fill(swept, count);
+    start = Clock::now();
+    s21::erase_if(swept, expired);
+    double erase_if_ms = ElapsedMs(start);
+    if (looped.size() != swept.size()) {
+      std::printf("size mismatch\n");
+      return 1;
+    }
+    std::printf("%8.1f%% %12.2f %12.2f\n", now / 10.0, loop_ms, erase_if_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+// Looks keys up in a 1M-element map in three access patterns: a sequential
+// sweep where every key is read twice in a row, a random walk taking small
+// steps, and uniformly random keys. Each pattern runs with plain find, with
+// the lookup cache on and with find_from given the previous result.
+//
+//   make benchmark
+//   ./benchmarks/finger_search_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Lookup>
+double Time(const s21::vector<int> &keys, Lookup lookup) {
+  Clock::time_point start = Clock::now();
+  long long sum = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    sum += lookup(keys.data()[i]);
+  }
+  double ms = ElapsedMs(start);
+  if (sum == 42) {
+    std::printf("unlikely\n");
+  }
+  return ms;
+}
+
+void Run(const char *label, s21::map<int, int> &map,
+         const s21::vector<int> &keys) {
+  map.set_lookup_cache(false);
+  double plain = Time(keys, [&map](int key) { return map.find(key)->second; });
+  map.set_lookup_cache(true);
+  double cached =
+      Time(keys, [&map](int key) { return map.find(key)->second; });
+  map.set_lookup_cache(false);
+  auto finger = map.begin();
+  double from = Time(keys, [&map, &finger](int key) {
+    finger = map.find_from(finger, key);
+    return finger->second;
+  });
+  std::printf("%-12s %10.2f %10.2f %10.2f\n", label, plain, cached, from);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  s21::map<int, int> map;
+  for (int i = 0; i < count; ++i) {
+    map.insert(static_cast<int>((i * 2654435761u) % count), i);
+  }
+
+  std::mt19937 rng(3);
+  s21::vector<int> sequential;
+  s21::vector<int> walk;
+  s21::vector<int> random;
+  std::uniform_int_distribution<int> any(0, count - 1);
+  std::uniform_int_distribution<int> step(-8, 8);
+  int position = count / 2;
+  for (int i = 0; i < count; ++i) {
+    sequential.push_back(i / 2);
+    position = (position + step(rng) + count) % count;
+    walk.push_back(position);
+    random.push_back(any(rng));
+  }
+
+  std::printf("%-12s %10s %10s %10s\n", "pattern", "find", "cached",
+              "find_from");
+  Run("sequential", map, sequential);
+  Run("random walk", map, walk);
+  Run("random", map, random);
+  return 0;
+}
@@ -0,0 +1,70 @@
+// Compares point lookups in a set against the frozen_set produced from it,
+// for sizes from cache-resident to well beyond the last-level cache.
+//
+//   make benchmark
+//   ./benchmarks/frozen_lookup_benchmark.cc [lookup_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_set/s21_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t lookups = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+  std::mt19937 rng(42);
+
+  std::printf("%-10s %12s %12s %8s\n", "elements", "set ms", "frozen ms",
+              "speedup");
+  for (size_t count : {1000, 100000, 1000000, 4000000}) {
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; ++i) {
+      keys[i] = static_cast<int>(i * 2);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+    s21::set<int> set;
+    for (int key : keys) {
+      set.insert(key);
+    }
+    s21::frozen_set<int> frozen = set.freeze();
+
+    std::vector<int> probes(lookups);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(count * 2));
+    for (int &probe : probes) {
+      probe = dist(rng);
+    }
+
+    Clock::time_point start = Clock::now();
+    size_t set_hits = 0;
+    for (int probe : probes) {
+      set_hits += set.contains(probe);
+    }
+    double set_ms = ElapsedMs(start);
+
+    start = Clock::now();
+    size_t frozen_hits = 0;
+    for (int probe : probes) {
+      frozen_hits += frozen.contains(probe);
+    }
+    double frozen_ms = ElapsedMs(start);
+
+    std::printf("%-10zu %12.2f %12.2f %7.2fx%s\n", count, set_ms, frozen_ms,
+                set_ms / frozen_ms,
+                set_hits == frozen_hits ? "" : "  MISMATCH");
+  }
+  return 0;
+}
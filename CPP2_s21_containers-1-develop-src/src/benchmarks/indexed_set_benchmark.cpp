@@ -0,0 +1,62 @@
+// Compares s21::set with s21::indexed_set, whose nodes link through 32-bit
+// positions in one arena: bytes per key, and the time to load, look up and
+// copy the same random keys.
+//
+//   make benchmark
+//   ./benchmarks/indexed_set_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_indexed_set/s21_indexed_set.h"
+#include "../s21_set/s21_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+int KeyAt(int i) { return static_cast<int>((i * 2654435761u) % 1000000007u); }
+
+template <typename Set>
+void Run(const char *label, int count) {
+  Set set;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < count; ++i) {
+    set.insert(KeyAt(i));
+  }
+  double load_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  size_t found = 0;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < count; ++i) {
+      found += set.contains(KeyAt(i * 7 + round)) ? 1 : 0;
+    }
+  }
+  double find_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  Set copy(set);
+  double copy_ms = ElapsedMs(start);
+
+  std::printf("%-12s %10.1f %10.2f %10.2f %10.2f %8zu\n", label,
+              static_cast<double>(set.stats().bytes_used) / count, load_ms,
+              find_ms, copy_ms, found + copy.size() - set.size());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::printf("%-12s %10s %10s %10s %10s %8s\n", "", "bytes/key", "load ms",
+              "find ms", "copy ms", "found");
+  Run<s21::set<int>>("set", count);
+  Run<s21::indexed_set<int>>("indexed_set", count);
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Compares set<unsigned> with integer_set on IDs drawn from a bounded range:
+// insert, point lookups, a full ordered scan, and the memory each one holds.
+//
+//   make benchmark
+//   ./benchmarks/integer_set_benchmark.cc [lookup_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_integer_set/s21_integer_set.h"
+#include "../s21_set/s21_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+size_t MemoryUsage(s21::set<unsigned> &set) {
+  return set.size() * sizeof(s21::set<unsigned>::tree_type::node_type);
+}
+
+size_t MemoryUsage(s21::integer_set<unsigned> &set) {
+  return set.memory_usage();
+}
+
+template <typename Set>
+void Run(const char *name, const std::vector<unsigned> &keys,
+         const std::vector<unsigned> &probes) {
+  Clock::time_point start = Clock::now();
+  Set set;
+  for (unsigned key : keys) {
+    set.insert(key);
+  }
+  double insert_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  size_t hits = 0;
+  for (unsigned probe : probes) {
+    hits += set.contains(probe);
+  }
+  double lookup_ms = ElapsedMs(start);
+
+  start = Clock::now();
+  unsigned long long sum = 0;
+  for (unsigned key : set) {
+    sum += key;
+  }
+  double scan_ms = ElapsedMs(start);
+
+  std::printf("%-12s %10.2f %10.2f %10.2f %12zu  (%zu hits, sum %llu)\n",
+              name, insert_ms, lookup_ms, scan_ms, MemoryUsage(set), hits,
+              sum);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t lookups = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+  std::mt19937 rng(42);
+
+  for (unsigned universe : {1u << 16, 1u << 20, 1u << 24}) {
+    std::uniform_int_distribution<unsigned> dist(0, universe - 1);
+    std::vector<unsigned> keys(universe / 4);
+    for (unsigned &key : keys) {
+      key = dist(rng);
+    }
+    std::vector<unsigned> probes(lookups);
+    for (unsigned &probe : probes) {
+      probe = dist(rng);
+    }
+
+    std::printf("\nuniverse %u, %zu inserts\n", universe, keys.size());
+    std::printf("%-12s %10s %10s %10s %12s\n", "", "insert ms", "lookup ms",
+                "scan ms", "bytes");
+    Run<s21::integer_set<unsigned>>("integer_set", keys, probes);
+    Run<s21::set<unsigned>>("set", keys, probes);
+  }
+  return 0;
+}
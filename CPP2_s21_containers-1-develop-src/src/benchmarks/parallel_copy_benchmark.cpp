@@ -0,0 +1,50 @@
+// Copies a large map with the copy constructor and with the parallel copy
+// constructor on a growing number of threads. Scaling depends on the cores
+// available: on a single core all parallel rows should be about equal.
+//
+//   make benchmark
+//   ./benchmarks/parallel_copy_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  s21::map<int, long long> map;
+  for (int i = 0; i < count; ++i) {
+    map.insert(static_cast<int>((i * 2654435761u) % 1000000007u), i);
+  }
+
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  std::printf("%-10s %12s %8s\n", "threads", "ms", "speedup");
+  Clock::time_point start = Clock::now();
+  double serial_ms;
+  {
+    s21::map<int, long long> copy(map);
+    serial_ms = ElapsedMs(start);
+  }
+  std::printf("%-10s %12.2f %8s\n", "copy", serial_ms, "1.00x");
+  for (size_t threads : {1, 2, 4, 8}) {
+    start = Clock::now();
+    s21::map<int, long long> copy(map, threads);
+    double ms = ElapsedMs(start);
+    std::printf("%-10zu %12.2f %7.2fx%s\n", threads, ms, serial_ms / ms,
+                copy.size() == map.size() ? "" : "  MISMATCH");
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+// Folds every value of a large map with a plain iterator loop and with
+// parallel_reduce on a growing number of threads. Scaling depends on the
+// cores available: on a single core all rows should be about equal.
+//
+//   make benchmark
+//   ./benchmarks/parallel_reduce_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  s21::map<int, long long> map;
+  for (int i = 0; i < count; ++i) {
+    map.insert(static_cast<int>((i * 2654435761u) % 1000000007u), i);
+  }
+
+  Clock::time_point start = Clock::now();
+  long long expected = 0;
+  for (auto &item : map) {
+    expected += item.second;
+  }
+  double loop_ms = ElapsedMs(start);
+
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  std::printf("%-10s %12s %8s\n", "threads", "ms", "speedup");
+  std::printf("%-10s %12.2f %8s\n", "loop", loop_ms, "1.00x");
+  for (size_t threads : {1, 2, 4, 8}) {
+    start = Clock::now();
+    long long sum = map.parallel_reduce(
+        0LL,
+        [](long long acc, const std::pair<const int, long long> &item) {
+          return acc + item.second;
+        },
+        std::plus<long long>(), threads);
+    double ms = ElapsedMs(start);
+    std::printf("%-10zu %12.2f %7.2fx%s\n", threads, ms, loop_ms / ms,
+                sum == expected ? "" : "  MISMATCH");
+  }
+  return 0;
+}
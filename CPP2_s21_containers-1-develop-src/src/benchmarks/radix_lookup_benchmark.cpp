@@ -0,0 +1,77 @@
+// Compares string-key lookups in a map against a radix_map holding the same
+// URL-like keys, which share long prefixes and so cost the tree many full
+// string comparisons per lookup.
+//
+//   make benchmark
+//   ./benchmarks/radix_lookup_benchmark.cc [lookup_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_radix_map/s21_radix_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+std::string MakeKey(std::mt19937 &rng) {
+  static const char *const kSections[] = {"/api/v1/users/", "/api/v1/orders/",
+                                          "/api/v2/users/", "/static/img/"};
+  std::string key = kSections[rng() % 4];
+  key += std::to_string(rng() % 1000000);
+  key += "/profile";
+  return key;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t lookups = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+  std::mt19937 rng(42);
+
+  std::printf("%-10s %12s %12s %8s\n", "elements", "map ms", "radix ms",
+              "speedup");
+  for (size_t count : {1000, 100000, 1000000}) {
+    s21::map<std::string, int> map;
+    s21::radix_map<std::string, int> radix;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < count; ++i) {
+      keys.push_back(MakeKey(rng));
+      map.insert(keys.back(), static_cast<int>(i));
+      radix.insert(keys.back(), static_cast<int>(i));
+    }
+
+    std::vector<std::string> probes(lookups);
+    for (std::string &probe : probes) {
+      probe = rng() % 2 ? keys[rng() % count] : MakeKey(rng);
+    }
+
+    Clock::time_point start = Clock::now();
+    size_t map_hits = 0;
+    for (const std::string &probe : probes) {
+      map_hits += map.contains(probe);
+    }
+    double map_ms = ElapsedMs(start);
+
+    start = Clock::now();
+    size_t radix_hits = 0;
+    for (const std::string &probe : probes) {
+      radix_hits += radix.contains(probe);
+    }
+    double radix_ms = ElapsedMs(start);
+
+    std::printf("%-10zu %12.2f %12.2f %7.2fx%s\n", count, map_ms, radix_ms,
+                map_ms / radix_ms, map_hits == radix_hits ? "" : "  MISMATCH");
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+// Upserts batches of random keys, half of them already present, into a map
+// once with a loop of insert() calls and once with insert(first, last),
+// which merges large batches with the map's contents in one pass.
+//
+//   make benchmark
+//   ./benchmarks/range_insert_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+int Key(unsigned i) {
+  return static_cast<int>((i * 2654435761u) % 1000000007u);
+}
+
+// The map holds the keys of the even i
+void Fill(s21::map<int, int> &map, int count) {
+  for (int i = 0; i < count; ++i) {
+    map.insert(Key(2u * i), i);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::printf("%-10s %12s %12s\n", "batch", "loop ms", "range ms");
+  const int per_mille[] = {1, 10, 100, 250, 400, 500, 1000};
+  for (int share : per_mille) {
+    std::vector<std::pair<int, int>> batch;
+    int batch_size = static_cast<int>(static_cast<long long>(count) * share /
+                                      1000);
+    for (int i = 0; i < batch_size; ++i) {
+      batch.emplace_back(Key(static_cast<unsigned>(i)), -i);
+    }
+
+    s21::map<int, int> looped;
+    Fill(looped, count);
+    Clock::time_point start = Clock::now();
+    for (const auto &item : batch) {
+      looped.insert(item);
+    }
+    double loop_ms = ElapsedMs(start);
+
+    s21::map<int, int> ranged;
+    Fill(ranged, count);
+    start = Clock::now();
+    ranged.insert(batch.begin(), batch.end());
+    double range_ms = ElapsedMs(start);
+    if (looped.size() != ranged.size()) {
+      std::printf("size mismatch\n");
+      return 1;
+    }
+    std::printf("%10d %12.2f %12.2f\n", batch_size, loop_ms, range_ms);
+  }
+  return 0;
+}
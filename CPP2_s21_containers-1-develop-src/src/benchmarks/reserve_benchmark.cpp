@@ -0,0 +1,59 @@
+// Loads a map with and without a reserve() call up front and reports the
+// time and the number of heap allocations each load made.
+//
+//   make benchmark
+//   ./benchmarks/reserve_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "../s21_map/s21_map.h"
+
+namespace {
+
+size_t allocation_count = 0;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+void Load(const char *label, int count, bool reserve) {
+  s21::map<int, int> map;
+  Clock::time_point start = Clock::now();
+  size_t allocations = allocation_count;
+  if (reserve) {
+    map.reserve(count);
+  }
+  for (int i = 0; i < count; ++i) {
+    map.insert(static_cast<int>((i * 2654435761u) % 1000000007u), i);
+  }
+  std::printf("%-12s %10.2f %14zu\n", label, ElapsedMs(start),
+              allocation_count - allocations);
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++allocation_count;
+  void *memory = std::malloc(size != 0 ? size : 1);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::printf("%-12s %10s %14s\n", "load", "ms", "allocations");
+  Load("insert", count, false);
+  Load("reserve", count, true);
+  return 0;
+}
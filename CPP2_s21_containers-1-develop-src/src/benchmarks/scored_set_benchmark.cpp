@@ -0,0 +1,95 @@
+// Runs a leaderboard workload, score updates mixed with rank lookups and
+// reads of the 10 best (lowest, as lap times) scores, once on a map of
+// scores kept in step with a multiset of (score, player) pairs, where a
+// rank is a walk from begin(), and once on scored_set, where every
+// operation is O(log n).
+//
+//   make benchmark
+//   ./benchmarks/scored_set_benchmark.cc [player_count] [operations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <utility>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_multiset/s21_multiset.h"
+#include "../s21_scored_set/s21_scored_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+unsigned Mix(unsigned i) { return (i * 2654435761u) % 1000000007u; }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int players = argc > 1 ? std::atoi(argv[1]) : 100000;
+  int operations = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+  s21::map<int, int> scores;
+  s21::multiset<std::pair<int, int>> by_score;
+  s21::scored_set<int, int> board;
+  for (int player = 0; player < players; ++player) {
+    int score = static_cast<int>(Mix(player) % 100000);
+    scores.insert(player, score);
+    by_score.insert(std::make_pair(score, player));
+    board.insert(player, score);
+  }
+
+  // Every fourth operation asks for a rank, every sixteenth for the top 10
+  size_t paired_check = 0;
+  Clock::time_point start = Clock::now();
+  for (int op = 0; op < operations; ++op) {
+    int player = static_cast<int>(Mix(op + 7) % players);
+    int score = static_cast<int>(Mix(op + 13) % 100000);
+    if (op % 4 == 0) {
+      auto it = by_score.find(std::make_pair(scores.at(player), player));
+      paired_check += std::distance(by_score.begin(), it);
+    } else if (op % 16 == 1) {
+      auto it = by_score.begin();
+      for (int i = 0; i < 10; ++i, ++it) {
+        paired_check += it->second;
+      }
+    } else {
+      int &current = scores.at(player);
+      by_score.erase(by_score.find(std::make_pair(current, player)));
+      by_score.insert(std::make_pair(score, player));
+      current = score;
+    }
+  }
+  double paired_ms = ElapsedMs(start);
+
+  size_t scored_check = 0;
+  start = Clock::now();
+  for (int op = 0; op < operations; ++op) {
+    int player = static_cast<int>(Mix(op + 7) % players);
+    int score = static_cast<int>(Mix(op + 13) % 100000);
+    if (op % 4 == 0) {
+      scored_check += board.rank(player);
+    } else if (op % 16 == 1) {
+      auto top = board.range_by_rank(0, 10);
+      for (size_t i = 0; i < top.size(); ++i) {
+        scored_check += top.data()[i].first;
+      }
+    } else {
+      board.insert_or_assign(player, score);
+    }
+  }
+  double scored_ms = ElapsedMs(start);
+  if (paired_check != scored_check) {
+    std::printf("result mismatch\n");
+    return 1;
+  }
+  std::printf("%d players, %d operations, ms\n", players, operations);
+  std::printf("map + multiset %10.2f\n", paired_ms);
+  std::printf("scored_set     %10.2f\n", scored_ms);
+  return 0;
+}
@@ -0,0 +1,61 @@
+// Builds, queries and destroys many short-lived sets of a few keys each, the
+// per-request pattern small_set is meant for, with set and small_set.
+//
+//   make benchmark
+//   ./benchmarks/small_set_benchmark.cc [round_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_set/s21_set.h"
+#include "../s21_small_set/s21_small_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Set>
+double Run(const std::vector<int> &keys, size_t per_set, size_t *hits) {
+  Clock::time_point start = Clock::now();
+  for (size_t first = 0; first + per_set <= keys.size(); first += per_set) {
+    Set set;
+    for (size_t i = first; i < first + per_set; ++i) {
+      set.insert(keys[i]);
+    }
+    for (size_t i = first; i < first + per_set; ++i) {
+      *hits += set.contains(keys[i] + 1);
+    }
+  }
+  return ElapsedMs(start);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937 rng(42);
+
+  std::printf("%-10s %12s %12s %8s\n", "per set", "set ms", "small ms",
+              "speedup");
+  for (size_t per_set : {2, 4, 8, 16}) {
+    std::vector<int> keys(rounds * per_set);
+    for (int &key : keys) {
+      key = static_cast<int>(rng() % 64);
+    }
+    size_t set_hits = 0;
+    size_t small_hits = 0;
+    double set_ms = Run<s21::set<int>>(keys, per_set, &set_hits);
+    double small_ms = Run<s21::small_set<int, 8>>(keys, per_set, &small_hits);
+    std::printf("%-10zu %12.2f %12.2f %7.2fx%s\n", per_set, set_ms, small_ms,
+                set_ms / small_ms, set_hits == small_hits ? "" : "  MISMATCH");
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// Looks up Zipf-distributed string keys in s21::set and s21::splay_set.
+// Rank r is drawn with probability proportional to 1 / r^s; at s = 1.2
+// about 90% of the lookups hit 1% of the keys, which the splay tree keeps
+// near its root. The s = 0 row is uniform access, where splaying only
+// costs.
+//
+//   make benchmark
+//   ./benchmarks/splay_set_benchmark.cc [element_count] [lookup_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "../s21_set/s21_set.h"
+#include "../s21_splay_set/s21_splay_set.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+std::string KeyAt(int i) {
+  return "customer/account/" +
+         std::to_string((i * 2654435761u) % 1000000007u);
+}
+
+// Rank 1 maps to a pseudo-random element so that the hot keys are spread
+// over the whole tree
+s21::vector<std::string> ZipfKeys(int count, int lookups, double exponent) {
+  s21::vector<double> cdf(count);
+  double total = 0;
+  for (int rank = 0; rank < count; ++rank) {
+    total += 1.0 / std::pow(rank + 1.0, exponent);
+    cdf.data()[rank] = total;
+  }
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0, total);
+  s21::vector<std::string> keys(lookups);
+  for (int i = 0; i < lookups; ++i) {
+    const double *rank =
+        std::lower_bound(cdf.data(), cdf.data() + count, uniform(rng));
+    unsigned index = static_cast<unsigned>(rank - cdf.data());
+    keys.data()[i] = KeyAt(static_cast<int>((index * 40503u + 7u) % count));
+  }
+  return keys;
+}
+
+template <typename Set>
+double Lookup(Set &set, const s21::vector<std::string> &keys,
+              size_t &found) {
+  Clock::time_point start = Clock::now();
+  for (size_t i = 0; i < keys.size(); ++i) {
+    found += set.contains(keys.data()[i]) ? 1 : 0;
+  }
+  return ElapsedMs(start);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  int lookups = argc > 2 ? std::atoi(argv[2]) : 2000000;
+  s21::set<std::string> set;
+  s21::splay_set<std::string> splay_set;
+  for (int i = 0; i < count; ++i) {
+    set.insert(KeyAt(i));
+    splay_set.insert(KeyAt(i));
+  }
+  std::printf("%-8s %12s %12s\n", "zipf s", "set ms", "splay ms");
+  const double exponents[] = {0.0, 1.0, 1.2, 1.5};
+  for (double exponent : exponents) {
+    s21::vector<std::string> keys = ZipfKeys(count, lookups, exponent);
+    size_t found = 0;
+    double set_ms = Lookup(set, keys, found);
+    double splay_ms = Lookup(splay_set, keys, found);
+    if (found != 2 * keys.size()) {
+      std::printf("lookup missed a key\n");
+      return 1;
+    }
+    std::printf("%-8.1f %12.2f %12.2f\n", exponent, set_ms, splay_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+// Random lookups in a map and a split_map whose values are 256 bytes, with
+// the containers several times larger than the last-level cache. In map
+// every node visited on the way down drags its value into the cache; in
+// split_map the nodes hold only keys and links.
+//
+//   make benchmark
+//   ./benchmarks/split_map_benchmark.cc [element_count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_split_map/s21_split_map.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace {
+
+struct Payload {
+  long long fields[32] = {};
+};
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Map>
+void Measure(const char *label, Map &map, const s21::vector<int> &probes) {
+  Clock::time_point start = Clock::now();
+  size_t hits = 0;
+  long long sum = 0;
+  for (size_t i = 0; i < probes.size(); ++i) {
+    auto it = map.find(probes.data()[i]);
+    if (it != map.end()) {
+      ++hits;
+      sum += it->second.fields[0];
+    }
+  }
+  std::printf("%-12s %10.2f   (%zu, %lld)\n", label, ElapsedMs(start), hits,
+              sum);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 400000;
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> keys(0, count * 2);
+
+  s21::map<int, Payload> map;
+  s21::split_map<int, Payload> split;
+  Payload payload;
+  for (int i = 0; i < count; ++i) {
+    int key = keys(rng);
+    payload.fields[0] = key;
+    map.insert(key, payload);
+    split.insert(key, payload);
+  }
+  s21::vector<int> probes;
+  for (int i = 0; i < 2000000; ++i) {
+    probes.push_back(keys(rng));
+  }
+
+  std::printf("%-12s %10s\n", "container", "find ms");
+  Measure("map", map, probes);
+  Measure("split_map", split, probes);
+  return 0;
+}
@@ -2,6 +2,18 @@
 #define CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H_
 
 #include "s21_array/s21_array.h"
+#include "s21_counted_multiset/s21_counted_multiset.h"
+#include "s21_cow_map/s21_cow_map.h"
+#include "s21_cow_set/s21_cow_set.h"
+#include "s21_indexed_set/s21_indexed_set.h"
+#include "s21_integer_set/s21_integer_set.h"
 #include "s21_multiset/s21_multiset.h"
+#include "s21_radix_map/s21_radix_map.h"
+#include "s21_scored_set/s21_scored_set.h"
+#include "s21_small_map/s21_small_map.h"
+#include "s21_small_set/s21_small_set.h"
+#include "s21_splay_map/s21_splay_map.h"
+#include "s21_splay_set/s21_splay_set.h"
+#include "s21_split_map/s21_split_map.h"
 
 #endif  // CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -0,0 +1,432 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_COUNTED_MULTISET_H_
+#define CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_COUNTED_MULTISET_H_
+
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Walks every duplicate of a (key, count) node as if it were a separate
+// element: offset_ is the position inside the run of equal keys.
+template <typename Key, typename TreeIterator>
+class CountedMultisetIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = Key;
+  using pointer = const Key *;
+  using reference = const Key &;
+
+ public:
+  CountedMultisetIterator() = default;
+  CountedMultisetIterator(TreeIterator node_it, size_t offset)
+      : node_it_(node_it), offset_(offset){};
+
+ public:
+  reference operator*() const { return node_it_->first; }
+  pointer operator->() const { return &node_it_->first; }
+
+  CountedMultisetIterator &operator++();
+  CountedMultisetIterator &operator--();
+  CountedMultisetIterator operator++(int);
+  CountedMultisetIterator operator--(int);
+
+  bool operator==(const CountedMultisetIterator &other) const;
+  bool operator!=(const CountedMultisetIterator &other) const;
+
+  TreeIterator GetTreeIterator() const { return node_it_; }
+  size_t GetOffset() const { return offset_; }
+
+ private:
+  TreeIterator node_it_;
+  size_t offset_ = 0;
+};
+
+template <typename Key, typename Compare = std::less<Key>>
+class counted_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using node_value_type = std::pair<const key_type, size_type>;
+  using tree_type =
+      RedBlackTree<node_value_type, key_compare, SelectFirst<node_value_type>>;
+  using iterator =
+      CountedMultisetIterator<key_type, typename tree_type::iterator>;
+  using const_iterator = iterator;
+
+  // Counted Multiset Constructors and operators
+ public:
+  counted_multiset();
+  counted_multiset(std::initializer_list<value_type> const &items);
+  counted_multiset(const counted_multiset &ms);
+  counted_multiset(counted_multiset &&ms) noexcept;
+  ~counted_multiset();
+
+  counted_multiset<Key, Compare> &operator=(const counted_multiset &ms);
+  counted_multiset<Key, Compare> &operator=(counted_multiset &&ms) noexcept;
+
+  // Counted Multiset Main Iterators
+ public:
+  iterator begin();
+  iterator end();
+
+  // Counted Multiset Capacity and Modifiers
+ public:
+  bool empty();
+  size_type size();
+  size_type distinct_size();
+  size_type max_size();
+
+  void clear();
+  iterator insert(const value_type &value);
+  iterator insert(const value_type &value, size_type count);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
+  void swap(counted_multiset &other);
+  void merge(counted_multiset &other);
+
+  // Counted Multiset Lookup
+ public:
+  size_type count(const Key &key);
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  tree_type tree_;
+  size_type size_ = 0;
+
+  iterator MakeIterator(typename tree_type::node_type *node);
+  typename tree_type::node_type *NextNode(typename tree_type::node_type *node);
+};
+
+//////////////////////////////////////////////////////
+
+// For CountedMultisetIterator
+template <typename Key, typename TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>
+    &CountedMultisetIterator<Key, TreeIterator>::operator++() {
+  if (++offset_ >= node_it_->second) {
+    ++node_it_;
+    offset_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>
+    &CountedMultisetIterator<Key, TreeIterator>::operator--() {
+  if (offset_ == 0) {
+    --node_it_;
+    offset_ = node_it_->second - 1;
+  } else {
+    --offset_;
+  }
+  return *this;
+}
+
+template <typename Key, typename TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>::operator++(int) {
+  CountedMultisetIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>
+CountedMultisetIterator<Key, TreeIterator>::operator--(int) {
+  CountedMultisetIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename TreeIterator>
+bool CountedMultisetIterator<Key, TreeIterator>::operator==(
+    const CountedMultisetIterator &other) const {
+  return node_it_ == other.node_it_ && offset_ == other.offset_;
+}
+
+template <typename Key, typename TreeIterator>
+bool CountedMultisetIterator<Key, TreeIterator>::operator!=(
+    const CountedMultisetIterator &other) const {
+  return !(*this == other);
+}
+//////////////////////////////////////////////////////
+
+// For counted_multiset
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare>::counted_multiset() = default;
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare>::counted_multiset(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare>::counted_multiset(const counted_multiset &ms)
+    : tree_(ms.tree_), size_(ms.size_) {}
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare>::counted_multiset(
+    counted_multiset &&ms) noexcept {
+  this->tree_ = std::move(ms.tree_);
+  size_ = ms.size_;
+  ms.size_ = 0;
+}
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare>::~counted_multiset() = default;
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare> &counted_multiset<Key, Compare>::operator=(
+    const counted_multiset &ms) {
+  if (this != &ms) {
+    tree_ = ms.tree_;
+    size_ = ms.size_;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+counted_multiset<Key, Compare> &counted_multiset<Key, Compare>::operator=(
+    counted_multiset &&ms) noexcept {
+  if (this != &ms) {
+    tree_.ClearNodes(tree_.GetRoot());
+    tree_ = std::move(ms.tree_);
+    size_ = ms.size_;
+    ms.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::begin() {
+  return iterator(tree_.begin(), 0);
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::end() {
+  return iterator(tree_.end(), 0);
+}
+
+template <typename Key, typename Compare>
+bool counted_multiset<Key, Compare>::empty() {
+  return size_ == 0;
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::size_type
+counted_multiset<Key, Compare>::size() {
+  return size_;
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::size_type
+counted_multiset<Key, Compare>::distinct_size() {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::size_type
+counted_multiset<Key, Compare>::max_size() {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+template <typename Key, typename Compare>
+void counted_multiset<Key, Compare>::clear() {
+  tree_.ClearNodes(tree_.GetRoot());
+  tree_.SetRoot(tree_.GetNil());
+  size_ = 0;
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::insert(const value_type &value) {
+  return insert(value, 1);
+}
+
+// Adds count copies of value at once; the iterator points at the last copy
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::insert(const value_type &value,
+                                       size_type count) {
+  if (count == 0) {
+    return find(value);
+  }
+  auto *node = tree_.FindNode(value);
+  if (node == nullptr) {
+    node = tree_.Insert(node_value_type(value, count));
+  } else {
+    node->data_.second += count;
+  }
+  size_ += count;
+  return iterator(typename tree_type::iterator(node, tree_.GetNil()),
+                  node->data_.second - 1);
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename counted_multiset<Key, Compare>::iterator, bool>>
+counted_multiset<Key, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  s21::vector<value_type> new_vector;
+
+  (new_vector.push_back(std::forward<Args>(args)), ...);
+
+  for (size_t i = 0; i < sizeof...(args); ++i) {
+    auto result = insert(new_vector[i]);
+    result_vector.push_back(std::make_pair(result, true));
+  }
+  return result_vector;
+}
+
+// Removes a single copy; the node goes away with its last copy. The copies
+// after pos move down one offset, so pos itself names the next element
+// unless it was the last copy of its key.
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::erase(iterator pos) {
+  if (pos == end()) {
+    return end();
+  }
+  auto *node = pos.GetTreeIterator().GetNode();
+  --size_;
+  if (--node->data_.second == 0) {
+    return MakeIterator(tree_.EraseNode(node));
+  }
+  if (pos.GetOffset() < node->data_.second) {
+    return pos;
+  }
+  return MakeIterator(NextNode(node));
+}
+
+// Trims the copies of the first and last keys of the range and drops the
+// nodes in between whole, so the cost follows the distinct keys removed.
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::erase(iterator first, iterator last) {
+  if (first == last) {
+    return last;
+  }
+  auto *node = first.GetTreeIterator().GetNode();
+  auto *last_node = last.GetTreeIterator().GetNode();
+  if (node == last_node) {
+    size_type removed = last.GetOffset() - first.GetOffset();
+    node->data_.second -= removed;
+    size_ -= removed;
+    return first;
+  }
+  if (first.GetOffset() != 0) {
+    size_ -= node->data_.second - first.GetOffset();
+    node->data_.second = first.GetOffset();
+    node = NextNode(node);
+  }
+  while (node != last_node) {
+    size_ -= node->data_.second;
+    node = tree_.EraseNode(node);
+  }
+  if (last_node != tree_.GetNil()) {
+    last_node->data_.second -= last.GetOffset();
+    size_ -= last.GetOffset();
+  }
+  return MakeIterator(last_node);
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::size_type
+counted_multiset<Key, Compare>::erase(const Key &key) {
+  auto *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    return 0;
+  }
+  size_type count = node->data_.second;
+  tree_.RemoveNode(node);
+  size_ -= count;
+  return count;
+}
+
+template <typename Key, typename Compare>
+void counted_multiset<Key, Compare>::swap(counted_multiset &other) {
+  std::swap(tree_, other.tree_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Key, typename Compare>
+void counted_multiset<Key, Compare>::merge(counted_multiset &other) {
+  for (auto it = other.tree_.begin(); it != other.tree_.end(); ++it) {
+    insert(it->first, it->second);
+  }
+  other.clear();
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::size_type
+counted_multiset<Key, Compare>::count(const Key &key) {
+  auto *node = tree_.FindNode(key);
+  return node == nullptr ? 0 : node->data_.second;
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::find(const Key &key) {
+  auto *node = tree_.FindNode(key);
+  return node == nullptr ? end() : MakeIterator(node);
+}
+
+template <typename Key, typename Compare>
+bool counted_multiset<Key, Compare>::contains(const Key &key) {
+  return tree_.FindNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare>
+std::pair<typename counted_multiset<Key, Compare>::iterator,
+          typename counted_multiset<Key, Compare>::iterator>
+counted_multiset<Key, Compare>::equal_range(const Key &key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::lower_bound(const Key &key) {
+  return MakeIterator(tree_.LowerBoundNode(key));
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::upper_bound(const Key &key) {
+  return MakeIterator(tree_.UpperBoundNode(key));
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::iterator
+counted_multiset<Key, Compare>::MakeIterator(
+    typename tree_type::node_type *node) {
+  return iterator(typename tree_type::iterator(node, tree_.GetNil()), 0);
+}
+
+template <typename Key, typename Compare>
+typename counted_multiset<Key, Compare>::tree_type::node_type *
+counted_multiset<Key, Compare>::NextNode(typename tree_type::node_type *node) {
+  typename tree_type::iterator next(node, tree_.GetNil());
+  return (++next).GetNode();
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_COUNTED_MULTISET_H_
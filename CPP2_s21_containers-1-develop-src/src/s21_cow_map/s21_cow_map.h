@@ -0,0 +1,323 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_COW_MAP_COW_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_COW_MAP_COW_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Copy-on-write map: copies share one reference-counted tree, so copying is
+// O(1), and a copy clones the tree only on its first mutation while the tree
+// is still shared. Reads go through const member functions and iterators are
+// const_iterators, since handing out mutable references would force a clone
+// on every non-const access; values are changed with operator[] or
+// insert_or_assign. Concurrent reads of copies that share a tree are safe.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class cow_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type =
+      RedBlackTree<value_type, key_compare, SelectFirst<value_type>>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  cow_map();
+  cow_map(std::initializer_list<value_type> const &items);
+  cow_map(const cow_map &m);
+  cow_map(cow_map &&m) noexcept;
+  ~cow_map();
+
+  cow_map &operator=(const cow_map &m);
+  cow_map &operator=(cow_map &&m) noexcept;
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key);
+
+ public:
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // True while another copy shares the tree, i.e. the next write clones it
+  bool is_shared() const;
+  void clear();
+
+  std::pair<const_iterator, bool> insert(const value_type &value);
+  std::pair<const_iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<const_iterator, bool> insert_or_assign(const Key &key,
+                                                   const T &obj);
+
+  void erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(cow_map &other);
+  void merge(cow_map &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<const_iterator, bool>> insert_many(Args &&...args);
+
+ public:
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  const_iterator lower_bound(const Key &key) const;
+  const_iterator upper_bound(const Key &key) const;
+
+ private:
+  std::shared_ptr<tree_type> tree_;
+
+  tree_type &Mutable();
+  const_iterator MakeIterator(typename tree_type::node_type *node) const;
+};
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare>::cow_map() : tree_(std::make_shared<tree_type>()) {}
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare>::cow_map(
+    std::initializer_list<value_type> const &items)
+    : cow_map() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare>::cow_map(const cow_map &m) : tree_(m.tree_) {}
+
+// The moved-from map is left empty rather than without a tree
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare>::cow_map(cow_map &&m) noexcept
+    : tree_(std::move(m.tree_)) {
+  m.tree_ = std::make_shared<tree_type>();
+}
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare>::~cow_map() = default;
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare> &cow_map<Key, T, Compare>::operator=(
+    const cow_map &m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+cow_map<Key, T, Compare> &cow_map<Key, T, Compare>::operator=(
+    cow_map &&m) noexcept {
+  if (this != &m) {
+    tree_ = std::move(m.tree_);
+    m.tree_ = std::make_shared<tree_type>();
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+const T &cow_map<Key, T, Compare>::at(const Key &key) const {
+  auto *node = tree_->FindNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found");
+  }
+  return node->data_.second;
+}
+
+template <typename Key, typename T, typename Compare>
+T &cow_map<Key, T, Compare>::operator[](const Key &key) {
+  tree_type &tree = Mutable();
+  auto *node = tree.FindNode(key);
+  if (node == nullptr) {
+    node = tree.Insert(std::make_pair(key, mapped_type()));
+  }
+  return node->data_.second;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::begin() const {
+  return MakeIterator(tree_->MinNode(tree_->GetRoot()));
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::end() const {
+  return MakeIterator(tree_->GetNil());
+}
+
+template <typename Key, typename T, typename Compare>
+bool cow_map<Key, T, Compare>::empty() const {
+  return tree_->GetSize() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::size_type cow_map<Key, T, Compare>::size()
+    const {
+  return tree_->GetSize();
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::size_type
+cow_map<Key, T, Compare>::max_size() const {
+  return tree_->GetMaxSize();
+}
+
+template <typename Key, typename T, typename Compare>
+bool cow_map<Key, T, Compare>::is_shared() const {
+  return tree_.use_count() > 1;
+}
+
+// A shared tree is dropped rather than cloned just to be emptied
+template <typename Key, typename T, typename Compare>
+void cow_map<Key, T, Compare>::clear() {
+  if (is_shared()) {
+    tree_ = std::make_shared<tree_type>();
+  } else {
+    tree_->ClearNodes(tree_->GetRoot());
+    tree_->SetRoot(tree_->GetNil());
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename cow_map<Key, T, Compare>::const_iterator, bool>
+cow_map<Key, T, Compare>::insert(const value_type &value) {
+  auto *node = tree_->FindNode(value.first);
+  if (node != nullptr) {
+    return std::make_pair(MakeIterator(node), false);
+  }
+  return std::make_pair(MakeIterator(Mutable().Insert(value)), true);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename cow_map<Key, T, Compare>::const_iterator, bool>
+cow_map<Key, T, Compare>::insert(const Key &key, const T &obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename cow_map<Key, T, Compare>::const_iterator, bool>
+cow_map<Key, T, Compare>::insert_or_assign(const Key &key, const T &obj) {
+  tree_type &tree = Mutable();
+  auto *node = tree.FindNode(key);
+  if (node != nullptr) {
+    node->data_.second = obj;
+    return std::make_pair(MakeIterator(node), false);
+  }
+  return std::make_pair(MakeIterator(tree.Insert(value_type(key, obj))),
+                        true);
+}
+
+// pos may point into a tree shared with other copies, so the element is
+// looked up again by key once this map owns its tree.
+template <typename Key, typename T, typename Compare>
+void cow_map<Key, T, Compare>::erase(const_iterator pos) {
+  erase(pos->first);
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::size_type cow_map<Key, T, Compare>::erase(
+    const Key &key) {
+  if (tree_->FindNode(key) == nullptr) {
+    return 0;
+  }
+  tree_type &tree = Mutable();
+  tree.RemoveNode(tree.FindNode(key));
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+void cow_map<Key, T, Compare>::swap(cow_map &other) {
+  tree_.swap(other.tree_);
+}
+
+template <typename Key, typename T, typename Compare>
+void cow_map<Key, T, Compare>::merge(cow_map &other) {
+  if (tree_ == other.tree_) {
+    return;
+  }
+  s21::vector<Key> moved;
+  for (const auto &item : other) {
+    if (insert(item).second) {
+      moved.push_back(item.first);
+    }
+  }
+  for (size_t i = 0; i < moved.size(); ++i) {
+    other.erase(moved[i]);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename cow_map<Key, T, Compare>::const_iterator, bool>>
+cow_map<Key, T, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<const_iterator, bool>> result_vector;
+  std::initializer_list<value_type> init_list = {std::forward<Args>(args)...};
+
+  for (const auto &item : init_list) {
+    result_vector.push_back(insert(item));
+  }
+  return result_vector;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::find(const Key &key) const {
+  auto *node = tree_->FindNode(key);
+  return node == nullptr ? end() : MakeIterator(node);
+}
+
+template <typename Key, typename T, typename Compare>
+bool cow_map<Key, T, Compare>::contains(const Key &key) const {
+  return tree_->FindNode(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::size_type cow_map<Key, T, Compare>::count(
+    const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::lower_bound(const Key &key) const {
+  return MakeIterator(tree_->LowerBoundNode(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::upper_bound(const Key &key) const {
+  return MakeIterator(tree_->UpperBoundNode(key));
+}
+
+// The tree this map may write to, cloned first if another copy shares it
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::tree_type &
+cow_map<Key, T, Compare>::Mutable() {
+  if (is_shared()) {
+    tree_ = std::make_shared<tree_type>(*tree_);
+  }
+  return *tree_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename cow_map<Key, T, Compare>::const_iterator
+cow_map<Key, T, Compare>::MakeIterator(
+    typename tree_type::node_type *node) const {
+  return const_iterator(node, tree_->GetNil());
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_COW_MAP_COW_MAP_H_
@@ -0,0 +1,261 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_COW_SET_COW_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_COW_SET_COW_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Copy-on-write set, the set counterpart of cow_map: copies share one
+// reference-counted tree and a copy clones it only on its first mutation
+// while it is still shared.
+template <typename Key, typename Compare = std::less<Key>>
+class cow_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = RedBlackTree<value_type, key_compare, Identity<value_type>>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  cow_set();
+  cow_set(std::initializer_list<value_type> const &items);
+  cow_set(const cow_set &s);
+  cow_set(cow_set &&s) noexcept;
+  ~cow_set();
+
+  cow_set &operator=(const cow_set &s);
+  cow_set &operator=(cow_set &&s) noexcept;
+
+ public:
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // True while another copy shares the tree, i.e. the next write clones it
+  bool is_shared() const;
+
+  void clear();
+  std::pair<const_iterator, bool> insert(const value_type &value);
+  void erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(cow_set &other);
+  void merge(cow_set &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<const_iterator, bool>> insert_many(Args &&...args);
+
+ public:
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  const_iterator lower_bound(const Key &key) const;
+  const_iterator upper_bound(const Key &key) const;
+
+ private:
+  std::shared_ptr<tree_type> tree_;
+
+  tree_type &Mutable();
+  const_iterator MakeIterator(typename tree_type::node_type *node) const;
+};
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare>::cow_set() : tree_(std::make_shared<tree_type>()) {}
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare>::cow_set(std::initializer_list<value_type> const &items)
+    : cow_set() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare>::cow_set(const cow_set &s) : tree_(s.tree_) {}
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare>::cow_set(cow_set &&s) noexcept
+    : tree_(std::move(s.tree_)) {
+  s.tree_ = std::make_shared<tree_type>();
+}
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare>::~cow_set() = default;
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare> &cow_set<Key, Compare>::operator=(const cow_set &s) {
+  tree_ = s.tree_;
+  return *this;
+}
+
+template <typename Key, typename Compare>
+cow_set<Key, Compare> &cow_set<Key, Compare>::operator=(
+    cow_set &&s) noexcept {
+  if (this != &s) {
+    tree_ = std::move(s.tree_);
+    s.tree_ = std::make_shared<tree_type>();
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator cow_set<Key, Compare>::begin()
+    const {
+  return MakeIterator(tree_->MinNode(tree_->GetRoot()));
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator cow_set<Key, Compare>::end()
+    const {
+  return MakeIterator(tree_->GetNil());
+}
+
+template <typename Key, typename Compare>
+bool cow_set<Key, Compare>::empty() const {
+  return tree_->GetSize() == 0;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::size_type cow_set<Key, Compare>::size() const {
+  return tree_->GetSize();
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::size_type cow_set<Key, Compare>::max_size()
+    const {
+  return tree_->GetMaxSize();
+}
+
+template <typename Key, typename Compare>
+bool cow_set<Key, Compare>::is_shared() const {
+  return tree_.use_count() > 1;
+}
+
+template <typename Key, typename Compare>
+void cow_set<Key, Compare>::clear() {
+  if (is_shared()) {
+    tree_ = std::make_shared<tree_type>();
+  } else {
+    tree_->ClearNodes(tree_->GetRoot());
+    tree_->SetRoot(tree_->GetNil());
+  }
+}
+
+template <typename Key, typename Compare>
+std::pair<typename cow_set<Key, Compare>::const_iterator, bool>
+cow_set<Key, Compare>::insert(const value_type &value) {
+  auto *node = tree_->FindNode(value);
+  if (node != nullptr) {
+    return std::make_pair(MakeIterator(node), false);
+  }
+  return std::make_pair(MakeIterator(Mutable().Insert(value)), true);
+}
+
+template <typename Key, typename Compare>
+void cow_set<Key, Compare>::erase(const_iterator pos) {
+  erase(*pos);
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::size_type cow_set<Key, Compare>::erase(
+    const Key &key) {
+  if (tree_->FindNode(key) == nullptr) {
+    return 0;
+  }
+  tree_type &tree = Mutable();
+  tree.RemoveNode(tree.FindNode(key));
+  return 1;
+}
+
+template <typename Key, typename Compare>
+void cow_set<Key, Compare>::swap(cow_set &other) {
+  tree_.swap(other.tree_);
+}
+
+template <typename Key, typename Compare>
+void cow_set<Key, Compare>::merge(cow_set &other) {
+  if (tree_ == other.tree_) {
+    return;
+  }
+  s21::vector<Key> moved;
+  for (const auto &item : other) {
+    if (insert(item).second) {
+      moved.push_back(item);
+    }
+  }
+  for (size_t i = 0; i < moved.size(); ++i) {
+    other.erase(moved[i]);
+  }
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename cow_set<Key, Compare>::const_iterator, bool>>
+cow_set<Key, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<const_iterator, bool>> result_vector;
+  (result_vector.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+  return result_vector;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator cow_set<Key, Compare>::find(
+    const Key &key) const {
+  auto *node = tree_->FindNode(key);
+  return node == nullptr ? end() : MakeIterator(node);
+}
+
+template <typename Key, typename Compare>
+bool cow_set<Key, Compare>::contains(const Key &key) const {
+  return tree_->FindNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::size_type cow_set<Key, Compare>::count(
+    const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator
+cow_set<Key, Compare>::lower_bound(const Key &key) const {
+  return MakeIterator(tree_->LowerBoundNode(key));
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator
+cow_set<Key, Compare>::upper_bound(const Key &key) const {
+  return MakeIterator(tree_->UpperBoundNode(key));
+}
+
+// The tree this set may write to, cloned first if another copy shares it
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::tree_type &cow_set<Key, Compare>::Mutable() {
+  if (is_shared()) {
+    tree_ = std::make_shared<tree_type>(*tree_);
+  }
+  return *tree_;
+}
+
+template <typename Key, typename Compare>
+typename cow_set<Key, Compare>::const_iterator
+cow_set<Key, Compare>::MakeIterator(
+    typename tree_type::node_type *node) const {
+  return const_iterator(node, tree_->GetNil());
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_COW_SET_COW_SET_H_
@@ -0,0 +1,159 @@
+#ifndef CPP2_S21_CONTAINERS_1_EYTZINGER_H_
+#define CPP2_S21_CONTAINERS_1_EYTZINGER_H_
+
+#include <cstddef>
+
+#ifndef S21_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define S21_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define S21_PREFETCH(address) ((void)0)
+#endif
+#endif
+
+namespace s21 {
+
+// Slot arithmetic of the Eytzinger (BFS-order) layout behind the frozen
+// containers. Slots are numbered from 1: slot k has children 2k and 2k + 1
+// and lives at index k - 1 of the key array. Slot 0 means "past the end".
+//
+// A descent only ever moves to 2k or 2k + 1, so the next few levels of the
+// search are contiguous in memory and can be prefetched ahead of the
+// comparisons, and the loop needs no data-dependent branch.
+struct Eytzinger {
+  // 16 slots four levels down share one cache line for 4-byte keys
+  static constexpr size_t kPrefetchFanout = 16;
+
+  static size_t First(size_t size);
+  static size_t Last(size_t size);
+  static size_t Next(size_t slot, size_t size);
+  static size_t Prev(size_t slot, size_t size);
+
+  // Calls visit(index) for every array index in key order, so the i-th
+  // element of a sorted sequence belongs at the i-th visited index
+  template <typename Visit>
+  static void InOrder(size_t size, Visit visit);
+
+  // First slot whose key is not less than key (lower bound) or greater
+  // than key (upper bound), 0 if there is none
+  template <typename Key, typename K, typename Compare>
+  static size_t LowerBound(const Key *keys, size_t size, const K &key,
+                           const Compare &comp);
+  template <typename Key, typename K, typename Compare>
+  static size_t UpperBound(const Key *keys, size_t size, const K &key,
+                           const Compare &comp);
+
+ private:
+  template <typename Key, typename GoRight>
+  static size_t Descend(const Key *keys, size_t size, GoRight go_right);
+  static size_t CountTrailingOnes(size_t slot);
+};
+
+//////////////////////////////////////////////////////
+
+inline size_t Eytzinger::First(size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  size_t slot = 1;
+  while (2 * slot <= size) {
+    slot = 2 * slot;
+  }
+  return slot;
+}
+
+inline size_t Eytzinger::Last(size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  size_t slot = 1;
+  while (2 * slot + 1 <= size) {
+    slot = 2 * slot + 1;
+  }
+  return slot;
+}
+
+inline size_t Eytzinger::Next(size_t slot, size_t size) {
+  if (slot == 0) {
+    return 0;
+  }
+  if (2 * slot + 1 <= size) {
+    slot = 2 * slot + 1;
+    while (2 * slot <= size) {
+      slot = 2 * slot;
+    }
+    return slot;
+  }
+  // Climb while slot is a right child, then once more
+  return slot >> (CountTrailingOnes(slot) + 1);
+}
+
+inline size_t Eytzinger::Prev(size_t slot, size_t size) {
+  if (slot == 0) {
+    return Last(size);
+  }
+  if (2 * slot <= size) {
+    slot = 2 * slot;
+    while (2 * slot + 1 <= size) {
+      slot = 2 * slot + 1;
+    }
+    return slot;
+  }
+  // Climb while slot is a left child, then once more
+  while (slot != 0 && (slot & 1) == 0) {
+    slot >>= 1;
+  }
+  return slot >> 1;
+}
+
+template <typename Visit>
+void Eytzinger::InOrder(size_t size, Visit visit) {
+  for (size_t slot = First(size); slot != 0; slot = Next(slot, size)) {
+    visit(slot - 1);
+  }
+}
+
+template <typename Key, typename K, typename Compare>
+size_t Eytzinger::LowerBound(const Key *keys, size_t size, const K &key,
+                             const Compare &comp) {
+  return Descend(keys, size,
+                 [&](const Key &slot_key) { return comp(slot_key, key); });
+}
+
+template <typename Key, typename K, typename Compare>
+size_t Eytzinger::UpperBound(const Key *keys, size_t size, const K &key,
+                             const Compare &comp) {
+  return Descend(keys, size,
+                 [&](const Key &slot_key) { return !comp(key, slot_key); });
+}
+
+// Walks down to a leaf; the answer is the last slot where the walk went
+// left, recovered by dropping the trailing right turns and that left turn
+template <typename Key, typename GoRight>
+size_t Eytzinger::Descend(const Key *keys, size_t size, GoRight go_right) {
+  size_t slot = 1;
+  while (slot <= size) {
+    if (slot * kPrefetchFanout <= size) {
+      S21_PREFETCH(keys + slot * kPrefetchFanout - 1);
+    }
+    slot = 2 * slot + static_cast<size_t>(go_right(keys[slot - 1]));
+  }
+  return slot >> (CountTrailingOnes(slot) + 1);
+}
+
+inline size_t Eytzinger::CountTrailingOnes(size_t slot) {
+#if defined(__GNUC__) || defined(__clang__)
+  unsigned long long inverted = ~static_cast<unsigned long long>(slot);
+  return static_cast<size_t>(__builtin_ctzll(inverted));
+#else
+  size_t count = 0;
+  for (; slot & 1; slot >>= 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_EYTZINGER_H_
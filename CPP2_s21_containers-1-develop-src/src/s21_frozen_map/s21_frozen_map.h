@@ -0,0 +1,318 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FROZEN_MAP_FROZEN_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_FROZEN_MAP_FROZEN_MAP_H_
+
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_eytzinger/Eytzinger.h"
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Keys and values live in separate arrays, so dereferencing yields a pair of
+// references built on the fly rather than a reference to a stored pair.
+template <typename Key, typename T>
+class FrozenMapIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::pair<const Key, T>;
+  using reference = std::pair<const Key &, const T &>;
+
+  struct pointer {
+    reference pair;
+    const reference *operator->() const { return &pair; }
+  };
+
+ public:
+  FrozenMapIterator() = default;
+  FrozenMapIterator(const Key *keys, const T *values, size_t size,
+                    size_t slot)
+      : keys_(keys), values_(values), size_(size), slot_(slot){};
+
+ public:
+  reference operator*() const;
+  pointer operator->() const;
+
+  FrozenMapIterator &operator++();
+  FrozenMapIterator &operator--();
+  FrozenMapIterator operator++(int);
+  FrozenMapIterator operator--(int);
+
+  bool operator==(const FrozenMapIterator &other) const;
+  bool operator!=(const FrozenMapIterator &other) const;
+
+ private:
+  const Key *keys_ = nullptr;
+  const T *values_ = nullptr;
+  size_t size_ = 0;
+  size_t slot_ = 0;
+};
+
+// Immutable sorted map produced by map::freeze(). Keys are kept in
+// Eytzinger order exactly as in frozen_set and the values in a parallel
+// array, so lookups only ever touch the key array and the one value found.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class frozen_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using iterator = FrozenMapIterator<Key, T>;
+  using const_iterator = iterator;
+  using reference = typename iterator::reference;
+  using const_reference = reference;
+  using size_type = size_t;
+
+ public:
+  frozen_map();
+  // Lays out count key/value pairs read from first, which must be sorted by
+  // key and free of duplicate keys. Key and T have to be default
+  // constructible.
+  template <typename InputIt>
+  frozen_map(InputIt first, size_type count);
+
+ public:
+  const T &at(const Key &key) const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+ public:
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+  // Heterogeneous lookup, available when Compare::is_transparent is defined
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> find(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, bool> contains(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> count(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> lower_bound(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> upper_bound(const K &key) const;
+
+ private:
+  s21::vector<Key> keys_;
+  s21::vector<T> values_;
+  Compare comp_;
+
+  template <typename K>
+  size_t FindSlot(const K &key) const;
+  iterator MakeIterator(size_t slot) const;
+};
+
+//////////////////////////////////////////////////////
+
+// For FrozenMapIterator
+template <typename Key, typename T>
+typename FrozenMapIterator<Key, T>::reference
+FrozenMapIterator<Key, T>::operator*() const {
+  return reference(keys_[slot_ - 1], values_[slot_ - 1]);
+}
+
+template <typename Key, typename T>
+typename FrozenMapIterator<Key, T>::pointer
+FrozenMapIterator<Key, T>::operator->() const {
+  return pointer{**this};
+}
+
+template <typename Key, typename T>
+FrozenMapIterator<Key, T> &FrozenMapIterator<Key, T>::operator++() {
+  slot_ = Eytzinger::Next(slot_, size_);
+  return *this;
+}
+
+template <typename Key, typename T>
+FrozenMapIterator<Key, T> &FrozenMapIterator<Key, T>::operator--() {
+  slot_ = Eytzinger::Prev(slot_, size_);
+  return *this;
+}
+
+template <typename Key, typename T>
+FrozenMapIterator<Key, T> FrozenMapIterator<Key, T>::operator++(int) {
+  FrozenMapIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename T>
+FrozenMapIterator<Key, T> FrozenMapIterator<Key, T>::operator--(int) {
+  FrozenMapIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename T>
+bool FrozenMapIterator<Key, T>::operator==(
+    const FrozenMapIterator &other) const {
+  return keys_ == other.keys_ && slot_ == other.slot_;
+}
+
+template <typename Key, typename T>
+bool FrozenMapIterator<Key, T>::operator!=(
+    const FrozenMapIterator &other) const {
+  return !(*this == other);
+}
+
+//////////////////////////////////////////////////////
+
+// For frozen_map
+template <typename Key, typename T, typename Compare>
+frozen_map<Key, T, Compare>::frozen_map() = default;
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+frozen_map<Key, T, Compare>::frozen_map(InputIt first, size_type count)
+    : keys_(count), values_(count) {
+  Key *keys = keys_.data();
+  T *values = values_.data();
+  Eytzinger::InOrder(count, [&](size_t index) {
+    keys[index] = first->first;
+    values[index] = first->second;
+    ++first;
+  });
+}
+
+template <typename Key, typename T, typename Compare>
+const T &frozen_map<Key, T, Compare>::at(const Key &key) const {
+  size_t slot = FindSlot(key);
+  if (slot == 0) {
+    throw std::out_of_range("Key not found");
+  }
+  return values_.data()[slot - 1];
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::begin() const {
+  return MakeIterator(Eytzinger::First(keys_.size()));
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::end() const {
+  return MakeIterator(0);
+}
+
+template <typename Key, typename T, typename Compare>
+bool frozen_map<Key, T, Compare>::empty() const {
+  return keys_.size() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::size_type
+frozen_map<Key, T, Compare>::size() const {
+  return keys_.size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::size_type
+frozen_map<Key, T, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(Key) + sizeof(T));
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::find(const Key &key) const {
+  return MakeIterator(FindSlot(key));
+}
+
+template <typename Key, typename T, typename Compare>
+bool frozen_map<Key, T, Compare>::contains(const Key &key) const {
+  return FindSlot(key) != 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::size_type
+frozen_map<Key, T, Compare>::count(const Key &key) const {
+  return FindSlot(key) != 0 ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::lower_bound(const Key &key) const {
+  return MakeIterator(
+      Eytzinger::LowerBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::upper_bound(const Key &key) const {
+  return MakeIterator(
+      Eytzinger::UpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_map<Key, T, Compare>::iterator>
+frozen_map<Key, T, Compare>::find(const K &key) const {
+  return MakeIterator(FindSlot(key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, bool> frozen_map<Key, T, Compare>::contains(
+    const K &key) const {
+  return FindSlot(key) != 0;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename frozen_map<Key, T, Compare>::size_type>
+frozen_map<Key, T, Compare>::count(const K &key) const {
+  return FindSlot(key) != 0 ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_map<Key, T, Compare>::iterator>
+frozen_map<Key, T, Compare>::lower_bound(const K &key) const {
+  return MakeIterator(
+      Eytzinger::LowerBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_map<Key, T, Compare>::iterator>
+frozen_map<Key, T, Compare>::upper_bound(const K &key) const {
+  return MakeIterator(
+      Eytzinger::UpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+// Slot holding key, or 0 on a miss
+template <typename Key, typename T, typename Compare>
+template <typename K>
+size_t frozen_map<Key, T, Compare>::FindSlot(const K &key) const {
+  const Key *keys = keys_.data();
+  size_t slot = Eytzinger::LowerBound(keys, keys_.size(), key, comp_);
+  if (slot == 0 || comp_(key, keys[slot - 1])) {
+    return 0;
+  }
+  return slot;
+}
+
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::iterator
+frozen_map<Key, T, Compare>::MakeIterator(size_t slot) const {
+  return iterator(keys_.data(), values_.data(), keys_.size(), slot);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FROZEN_MAP_FROZEN_MAP_H_
@@ -0,0 +1,278 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FROZEN_SET_FROZEN_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_FROZEN_SET_FROZEN_SET_H_
+
+#include <functional>
+#include <iterator>
+#include <limits>
+
+#include "../s21_eytzinger/Eytzinger.h"
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+template <typename Key>
+class FrozenSetIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = Key;
+  using pointer = const Key *;
+  using reference = const Key &;
+
+ public:
+  FrozenSetIterator() = default;
+  FrozenSetIterator(const Key *keys, size_t size, size_t slot)
+      : keys_(keys), size_(size), slot_(slot){};
+
+ public:
+  reference operator*() const { return keys_[slot_ - 1]; }
+  pointer operator->() const { return &keys_[slot_ - 1]; }
+
+  FrozenSetIterator &operator++();
+  FrozenSetIterator &operator--();
+  FrozenSetIterator operator++(int);
+  FrozenSetIterator operator--(int);
+
+  bool operator==(const FrozenSetIterator &other) const;
+  bool operator!=(const FrozenSetIterator &other) const;
+
+ private:
+  const Key *keys_ = nullptr;
+  size_t size_ = 0;
+  size_t slot_ = 0;
+};
+
+// Immutable sorted set produced by set::freeze(). The keys sit in one array
+// in Eytzinger order (see Eytzinger.h) and nothing else is stored, so a
+// lookup is a branch-free walk over a contiguous, prefetchable array instead
+// of a pointer chase through tree nodes.
+template <typename Key, typename Compare = std::less<Key>>
+class frozen_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = FrozenSetIterator<Key>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+ public:
+  frozen_set();
+  // Lays out count keys read from first, which must be sorted by Compare
+  // and free of duplicates. Key has to be default constructible.
+  template <typename InputIt>
+  frozen_set(InputIt first, size_type count);
+
+ public:
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+ public:
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+  // Heterogeneous lookup, available when Compare::is_transparent is defined
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> find(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, bool> contains(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> count(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> lower_bound(const K &key) const;
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> upper_bound(const K &key) const;
+
+ private:
+  s21::vector<Key> keys_;
+  Compare comp_;
+
+  template <typename K>
+  size_t FindSlot(const K &key) const;
+  iterator MakeIterator(size_t slot) const;
+};
+
+//////////////////////////////////////////////////////
+
+// For FrozenSetIterator
+template <typename Key>
+FrozenSetIterator<Key> &FrozenSetIterator<Key>::operator++() {
+  slot_ = Eytzinger::Next(slot_, size_);
+  return *this;
+}
+
+template <typename Key>
+FrozenSetIterator<Key> &FrozenSetIterator<Key>::operator--() {
+  slot_ = Eytzinger::Prev(slot_, size_);
+  return *this;
+}
+
+template <typename Key>
+FrozenSetIterator<Key> FrozenSetIterator<Key>::operator++(int) {
+  FrozenSetIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key>
+FrozenSetIterator<Key> FrozenSetIterator<Key>::operator--(int) {
+  FrozenSetIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key>
+bool FrozenSetIterator<Key>::operator==(const FrozenSetIterator &other) const {
+  return keys_ == other.keys_ && slot_ == other.slot_;
+}
+
+template <typename Key>
+bool FrozenSetIterator<Key>::operator!=(const FrozenSetIterator &other) const {
+  return !(*this == other);
+}
+
+//////////////////////////////////////////////////////
+
+// For frozen_set
+template <typename Key, typename Compare>
+frozen_set<Key, Compare>::frozen_set() = default;
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+frozen_set<Key, Compare>::frozen_set(InputIt first, size_type count)
+    : keys_(count) {
+  Key *keys = keys_.data();
+  Eytzinger::InOrder(count, [&](size_t index) {
+    keys[index] = *first;
+    ++first;
+  });
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator frozen_set<Key, Compare>::begin()
+    const {
+  return MakeIterator(Eytzinger::First(keys_.size()));
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator frozen_set<Key, Compare>::end()
+    const {
+  return MakeIterator(0);
+}
+
+template <typename Key, typename Compare>
+bool frozen_set<Key, Compare>::empty() const {
+  return keys_.size() == 0;
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::size_type frozen_set<Key, Compare>::size()
+    const {
+  return keys_.size();
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::size_type
+frozen_set<Key, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Key);
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator frozen_set<Key, Compare>::find(
+    const Key &key) const {
+  return MakeIterator(FindSlot(key));
+}
+
+template <typename Key, typename Compare>
+bool frozen_set<Key, Compare>::contains(const Key &key) const {
+  return FindSlot(key) != 0;
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::size_type frozen_set<Key, Compare>::count(
+    const Key &key) const {
+  return FindSlot(key) != 0 ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator
+frozen_set<Key, Compare>::lower_bound(const Key &key) const {
+  return MakeIterator(
+      Eytzinger::LowerBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator
+frozen_set<Key, Compare>::upper_bound(const Key &key) const {
+  return MakeIterator(
+      Eytzinger::UpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_set<Key, Compare>::iterator>
+frozen_set<Key, Compare>::find(const K &key) const {
+  return MakeIterator(FindSlot(key));
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, bool> frozen_set<Key, Compare>::contains(
+    const K &key) const {
+  return FindSlot(key) != 0;
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_set<Key, Compare>::size_type>
+frozen_set<Key, Compare>::count(const K &key) const {
+  return FindSlot(key) != 0 ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_set<Key, Compare>::iterator>
+frozen_set<Key, Compare>::lower_bound(const K &key) const {
+  return MakeIterator(
+      Eytzinger::LowerBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+TransparentLookupT<Compare, K, typename frozen_set<Key, Compare>::iterator>
+frozen_set<Key, Compare>::upper_bound(const K &key) const {
+  return MakeIterator(
+      Eytzinger::UpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+// Slot holding key, or 0 on a miss
+template <typename Key, typename Compare>
+template <typename K>
+size_t frozen_set<Key, Compare>::FindSlot(const K &key) const {
+  const Key *keys = keys_.data();
+  size_t slot = Eytzinger::LowerBound(keys, keys_.size(), key, comp_);
+  if (slot == 0 || comp_(key, keys[slot - 1])) {
+    return 0;
+  }
+  return slot;
+}
+
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::iterator
+frozen_set<Key, Compare>::MakeIterator(size_t slot) const {
+  return iterator(keys_.data(), keys_.size(), slot);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FROZEN_SET_FROZEN_SET_H_
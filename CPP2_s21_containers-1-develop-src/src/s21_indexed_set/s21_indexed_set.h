@@ -0,0 +1,259 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_INDEXED_SET_INDEXED_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_INDEXED_SET_INDEXED_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "../s21_red_black_tree/IndexedRedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// set whose nodes sit in one arena and link with 32-bit positions (see
+// IndexedRedBlackTree.h): smaller nodes, better locality and cheap copies,
+// for at most 2^32 - 1 keys. Iterators survive inserts and erasing other
+// keys, but not swap() or moves.
+template <typename Key, typename Compare = std::less<Key>>
+class indexed_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = IndexedRedBlackTree<value_type, key_compare>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  indexed_set();
+  explicit indexed_set(const Compare &comp);
+  indexed_set(std::initializer_list<value_type> const &items);
+  indexed_set(const indexed_set &s);
+  indexed_set(indexed_set &&s) noexcept;
+  ~indexed_set();
+
+  indexed_set &operator=(const indexed_set &s);
+  indexed_set &operator=(indexed_set &&s) noexcept;
+
+ public:
+  iterator begin() const;
+  iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(indexed_set &other);
+  void merge(indexed_set &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Memory layout
+ public:
+  // Grows the arena once so that holding size keys needs no reallocation
+  void reserve(size_type size);
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
+ public:
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+ private:
+  tree_type tree_;
+};
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::indexed_set() = default;
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::indexed_set(const Compare &comp) : tree_(comp) {}
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::indexed_set(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::indexed_set(const indexed_set &s)
+    : tree_(s.tree_) {}
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::indexed_set(indexed_set &&s) noexcept
+    : tree_(std::move(s.tree_)) {}
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare>::~indexed_set() = default;
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare> &indexed_set<Key, Compare>::operator=(
+    const indexed_set &s) {
+  tree_ = s.tree_;
+  return *this;
+}
+
+template <typename Key, typename Compare>
+indexed_set<Key, Compare> &indexed_set<Key, Compare>::operator=(
+    indexed_set &&s) noexcept {
+  tree_ = std::move(s.tree_);
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::iterator indexed_set<Key, Compare>::begin()
+    const {
+  return tree_.begin();
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::iterator indexed_set<Key, Compare>::end()
+    const {
+  return tree_.end();
+}
+
+template <typename Key, typename Compare>
+bool indexed_set<Key, Compare>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::size_type indexed_set<Key, Compare>::size()
+    const {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::size_type
+indexed_set<Key, Compare>::max_size() const {
+  return std::min<size_type>(tree_type::kMaxSize,
+                             std::numeric_limits<size_type>::max() /
+                                 sizeof(typename tree_type::node_type));
+}
+
+template <typename Key, typename Compare>
+void indexed_set<Key, Compare>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename Compare>
+std::pair<typename indexed_set<Key, Compare>::iterator, bool>
+indexed_set<Key, Compare>::insert(const value_type &value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename Compare>
+void indexed_set<Key, Compare>::erase(iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::size_type indexed_set<Key, Compare>::erase(
+    const Key &key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename Compare>
+void indexed_set<Key, Compare>::swap(indexed_set &other) {
+  tree_.Swap(other.tree_);
+}
+
+// Keys are copied in and then erased from other one by one; erasing by
+// iterator is fine here because other's arena never grows meanwhile.
+template <typename Key, typename Compare>
+void indexed_set<Key, Compare>::merge(indexed_set &other) {
+  if (this == &other) {
+    return;
+  }
+  for (iterator it = other.begin(); it != other.end();) {
+    if (insert(*it).second) {
+      other.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename indexed_set<Key, Compare>::iterator, bool>>
+indexed_set<Key, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  s21::vector<value_type> new_vector;
+
+  (new_vector.push_back(std::forward<Args>(args)), ...);
+
+  for (size_t i = 0; i < sizeof...(args); ++i) {
+    auto result = insert(new_vector[i]);
+    result_vector.push_back(result);
+  }
+  return result_vector;
+}
+
+template <typename Key, typename Compare>
+void indexed_set<Key, Compare>::reserve(size_type size) {
+  tree_.Reserve(size);
+}
+
+template <typename Key, typename Compare>
+TreeStats indexed_set<Key, Compare>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename Compare>
+bool indexed_set<Key, Compare>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::iterator indexed_set<Key, Compare>::find(
+    const Key &key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename Compare>
+bool indexed_set<Key, Compare>::contains(const Key &key) const {
+  return tree_.Find(key) != tree_.end();
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::size_type indexed_set<Key, Compare>::count(
+    const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::iterator
+indexed_set<Key, Compare>::lower_bound(const Key &key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename Compare>
+typename indexed_set<Key, Compare>::iterator
+indexed_set<Key, Compare>::upper_bound(const Key &key) const {
+  return tree_.UpperBound(key);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_INDEXED_SET_INDEXED_SET_H_
@@ -0,0 +1,273 @@
+#ifndef CPP2_S21_CONTAINERS_1_HIERARCHICAL_BITMAP_H_
+#define CPP2_S21_CONTAINERS_1_HIERARCHICAL_BITMAP_H_
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Bit set over [0, universe) with one summary level per factor of 64: bit j
+// of level l + 1 is set iff word j of level l is non-zero, and the top level
+// is a single word. Next/Prev scan one word per level, going up until a
+// word has a set bit past the start and back down along the first non-zero
+// words, so they touch at most 2 * levels words (levels <= 6 for 32-bit
+// keys). The universe grows on demand when a larger bit is set.
+class HierarchicalBitmap {
+ public:
+  using Word = unsigned long long;
+  static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+ public:
+  HierarchicalBitmap() = default;
+
+  size_t universe() const { return level_count_ == 0 ? 0 : words(0) * 64; }
+  size_t memory_usage() const;
+
+  bool Test(size_t bit) const;
+  // Both return whether the bit changed
+  bool Set(size_t bit);
+  bool Reset(size_t bit);
+  // Smallest set bit >= bit and largest set bit <= bit, kNone when absent
+  size_t Next(size_t bit) const;
+  size_t Prev(size_t bit) const;
+
+  void Clear();
+  void Swap(HierarchicalBitmap &other);
+  // Moves the bits of other that are not set here, returns how many moved
+  size_t Merge(HierarchicalBitmap &other);
+
+ private:
+  static constexpr size_t kWordBits = 64;
+  static constexpr size_t kMaxLevels = 11;  // 64^11 > 2^64
+
+  s21::vector<Word> levels_[kMaxLevels];
+  size_t level_count_ = 0;
+
+  size_t words(size_t level) const { return levels_[level].size(); }
+  Word word(size_t level, size_t index) const {
+    return levels_[level].data()[index];
+  }
+  void Grow(size_t bit);
+  void RebuildSummaries();
+
+  static size_t CountTrailingZeros(Word word);
+  static size_t CountLeadingZeros(Word word);
+  static size_t PopCount(Word word);
+};
+
+//////////////////////////////////////////////////////
+
+inline size_t HierarchicalBitmap::memory_usage() const {
+  size_t total = 0;
+  for (size_t level = 0; level < level_count_; ++level) {
+    total += words(level) * sizeof(Word);
+  }
+  return total;
+}
+
+inline bool HierarchicalBitmap::Test(size_t bit) const {
+  return bit < universe() &&
+         (word(0, bit / kWordBits) >> (bit % kWordBits) & 1) != 0;
+}
+
+inline bool HierarchicalBitmap::Set(size_t bit) {
+  if (bit >= universe()) {
+    Grow(bit);
+  }
+  size_t index = bit;
+  for (size_t level = 0; level < level_count_; ++level) {
+    Word &target = levels_[level].data()[index / kWordBits];
+    Word mask = Word(1) << (index % kWordBits);
+    if (level == 0 && (target & mask) != 0) {
+      return false;
+    }
+    bool was_empty = target == 0;
+    target |= mask;
+    if (!was_empty) {
+      break;
+    }
+    index /= kWordBits;
+  }
+  return true;
+}
+
+inline bool HierarchicalBitmap::Reset(size_t bit) {
+  if (!Test(bit)) {
+    return false;
+  }
+  size_t index = bit;
+  for (size_t level = 0; level < level_count_; ++level) {
+    Word &target = levels_[level].data()[index / kWordBits];
+    target &= ~(Word(1) << (index % kWordBits));
+    if (target != 0) {
+      break;
+    }
+    index /= kWordBits;
+  }
+  return true;
+}
+
+inline size_t HierarchicalBitmap::Next(size_t bit) const {
+  if (bit >= universe()) {
+    return kNone;
+  }
+  size_t level = 0;
+  size_t index = bit;
+  while (true) {
+    size_t slot = index / kWordBits;
+    if (slot < words(level)) {
+      Word mask = word(level, slot) & (~Word(0) << (index % kWordBits));
+      if (mask != 0) {
+        index = slot * kWordBits + CountTrailingZeros(mask);
+        break;
+      }
+    }
+    if (++level == level_count_) {
+      return kNone;
+    }
+    index = slot + 1;
+  }
+  while (level-- > 0) {
+    index = index * kWordBits + CountTrailingZeros(word(level, index));
+  }
+  return index;
+}
+
+inline size_t HierarchicalBitmap::Prev(size_t bit) const {
+  if (level_count_ == 0) {
+    return kNone;
+  }
+  size_t level = 0;
+  size_t index = bit < universe() ? bit : universe() - 1;
+  while (true) {
+    size_t slot = index / kWordBits;
+    Word mask = word(level, slot) &
+                (~Word(0) >> (kWordBits - 1 - index % kWordBits));
+    if (mask != 0) {
+      index = slot * kWordBits + kWordBits - 1 - CountLeadingZeros(mask);
+      break;
+    }
+    if (slot == 0 || ++level == level_count_) {
+      return kNone;
+    }
+    index = slot - 1;
+  }
+  while (level-- > 0) {
+    index = index * kWordBits + kWordBits - 1 -
+            CountLeadingZeros(word(level, index));
+  }
+  return index;
+}
+
+inline void HierarchicalBitmap::Clear() {
+  for (size_t level = 0; level < level_count_; ++level) {
+    levels_[level] = s21::vector<Word>();
+  }
+  level_count_ = 0;
+}
+
+inline void HierarchicalBitmap::Swap(HierarchicalBitmap &other) {
+  for (size_t level = 0; level < kMaxLevels; ++level) {
+    std::swap(levels_[level], other.levels_[level]);
+  }
+  std::swap(level_count_, other.level_count_);
+}
+
+inline size_t HierarchicalBitmap::Merge(HierarchicalBitmap &other) {
+  if (other.level_count_ == 0) {
+    return 0;
+  }
+  if (other.universe() > universe()) {
+    Grow(other.universe() - 1);
+  }
+  size_t moved_count = 0;
+  for (size_t index = 0; index < other.words(0); ++index) {
+    Word moved = other.levels_[0][index] & ~levels_[0][index];
+    levels_[0][index] |= moved;
+    other.levels_[0][index] &= ~moved;
+    moved_count += PopCount(moved);
+  }
+  RebuildSummaries();
+  other.RebuildSummaries();
+  return moved_count;
+}
+
+// Resizes the base level to hold bit, at least doubling it so that a run of
+// increasing inserts stays amortized O(1), and recomputes the summaries.
+inline void HierarchicalBitmap::Grow(size_t bit) {
+  size_t needed = bit / kWordBits + 1;
+  size_t old_words = level_count_ == 0 ? 0 : words(0);
+  size_t new_words = needed > old_words * 2 ? needed : old_words * 2;
+  s21::vector<Word> base(new_words);
+  for (size_t index = 0; index < old_words; ++index) {
+    base[index] = levels_[0][index];
+  }
+  levels_[0] = std::move(base);
+
+  level_count_ = 1;
+  for (size_t count = new_words; count > 1; ++level_count_) {
+    count = (count + kWordBits - 1) / kWordBits;
+    levels_[level_count_] = s21::vector<Word>(count);
+  }
+  for (size_t level = level_count_; level < kMaxLevels; ++level) {
+    levels_[level] = s21::vector<Word>();
+  }
+  RebuildSummaries();
+}
+
+inline void HierarchicalBitmap::RebuildSummaries() {
+  for (size_t level = 1; level < level_count_; ++level) {
+    for (size_t index = 0; index < words(level); ++index) {
+      levels_[level][index] = 0;
+    }
+    for (size_t index = 0; index < words(level - 1); ++index) {
+      if (word(level - 1, index) != 0) {
+        levels_[level][index / kWordBits] |= Word(1)
+                                             << (index % kWordBits);
+      }
+    }
+  }
+}
+
+inline size_t HierarchicalBitmap::CountTrailingZeros(Word word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(word));
+#else
+  size_t count = 0;
+  for (; (word & 1) == 0; word >>= 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+inline size_t HierarchicalBitmap::CountLeadingZeros(Word word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_clzll(word));
+#else
+  size_t count = 0;
+  for (Word top = Word(1) << (kWordBits - 1); (word & top) == 0; top >>= 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+inline size_t HierarchicalBitmap::PopCount(Word word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(word));
+#else
+  size_t count = 0;
+  for (; word != 0; word &= word - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_HIERARCHICAL_BITMAP_H_
@@ -0,0 +1,332 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_INTEGER_SET_INTEGER_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_INTEGER_SET_INTEGER_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+#include "HierarchicalBitmap.h"
+
+namespace s21 {
+
+// The set has no element objects to point into, so the iterator keeps a
+// copy of the current key and hands out references to it.
+template <typename Key>
+class IntegerSetIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = Key;
+  using pointer = const Key *;
+  using reference = const Key &;
+
+ public:
+  IntegerSetIterator() = default;
+  IntegerSetIterator(const HierarchicalBitmap *bits, size_t position)
+      : bits_(bits), position_(position), key_(static_cast<Key>(position)){};
+
+ public:
+  reference operator*() const { return key_; }
+  pointer operator->() const { return &key_; }
+
+  IntegerSetIterator &operator++();
+  IntegerSetIterator &operator--();
+  IntegerSetIterator operator++(int);
+  IntegerSetIterator operator--(int);
+
+  bool operator==(const IntegerSetIterator &other) const;
+  bool operator!=(const IntegerSetIterator &other) const;
+
+ private:
+  const HierarchicalBitmap *bits_ = nullptr;
+  size_t position_ = HierarchicalBitmap::kNone;
+  Key key_ = Key();
+};
+
+// Ordered set of unsigned integers stored as a hierarchical bitmap (see
+// HierarchicalBitmap.h) instead of a tree: one bit per possible key plus
+// about 1/63 of that for the summaries. contains is a single bit test and
+// insert, erase and successor/predecessor touch one word per summary level.
+// Memory follows the largest key ever inserted rather than the element
+// count, so it pays off for dense IDs in a bounded range.
+template <typename Key = unsigned int>
+class integer_set {
+  static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value &&
+                    !std::is_same<Key, bool>::value,
+                "integer_set keys must be unsigned integers");
+  static_assert(sizeof(Key) <= sizeof(size_t),
+                "integer_set keys must fit in size_t");
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = IntegerSetIterator<Key>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+ public:
+  integer_set();
+  integer_set(std::initializer_list<value_type> const &items);
+  integer_set(const integer_set &other);
+  integer_set(integer_set &&other) noexcept;
+  ~integer_set();
+
+  integer_set &operator=(const integer_set &other);
+  integer_set &operator=(integer_set &&other) noexcept;
+
+ public:
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // Bytes held by the bitmap
+  size_type memory_usage() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(integer_set &other);
+  void merge(integer_set &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ public:
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+ private:
+  HierarchicalBitmap bits_;
+  size_type size_ = 0;
+
+  iterator MakeIterator(size_t position) const;
+};
+
+//////////////////////////////////////////////////////
+
+// For IntegerSetIterator
+template <typename Key>
+IntegerSetIterator<Key> &IntegerSetIterator<Key>::operator++() {
+  position_ = position_ == HierarchicalBitmap::kNone
+                  ? bits_->Next(0)
+                  : bits_->Next(position_ + 1);
+  key_ = static_cast<Key>(position_);
+  return *this;
+}
+
+// Decrementing end() yields the largest key
+template <typename Key>
+IntegerSetIterator<Key> &IntegerSetIterator<Key>::operator--() {
+  position_ = position_ == 0 ? HierarchicalBitmap::kNone
+                             : bits_->Prev(position_ - 1);
+  key_ = static_cast<Key>(position_);
+  return *this;
+}
+
+template <typename Key>
+IntegerSetIterator<Key> IntegerSetIterator<Key>::operator++(int) {
+  IntegerSetIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key>
+IntegerSetIterator<Key> IntegerSetIterator<Key>::operator--(int) {
+  IntegerSetIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key>
+bool IntegerSetIterator<Key>::operator==(
+    const IntegerSetIterator &other) const {
+  return bits_ == other.bits_ && position_ == other.position_;
+}
+
+template <typename Key>
+bool IntegerSetIterator<Key>::operator!=(
+    const IntegerSetIterator &other) const {
+  return !(*this == other);
+}
+
+//////////////////////////////////////////////////////
+
+// For integer_set
+template <typename Key>
+integer_set<Key>::integer_set() = default;
+
+template <typename Key>
+integer_set<Key>::integer_set(std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key>
+integer_set<Key>::integer_set(const integer_set &other)
+    : bits_(other.bits_), size_(other.size_) {}
+
+template <typename Key>
+integer_set<Key>::integer_set(integer_set &&other) noexcept {
+  swap(other);
+}
+
+template <typename Key>
+integer_set<Key>::~integer_set() = default;
+
+template <typename Key>
+integer_set<Key> &integer_set<Key>::operator=(const integer_set &other) {
+  if (this != &other) {
+    bits_ = other.bits_;
+    size_ = other.size_;
+  }
+  return *this;
+}
+
+template <typename Key>
+integer_set<Key> &integer_set<Key>::operator=(integer_set &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::begin() const {
+  return MakeIterator(bits_.Next(0));
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::end() const {
+  return MakeIterator(HierarchicalBitmap::kNone);
+}
+
+template <typename Key>
+bool integer_set<Key>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key>
+typename integer_set<Key>::size_type integer_set<Key>::size() const {
+  return size_;
+}
+
+template <typename Key>
+typename integer_set<Key>::size_type integer_set<Key>::max_size() const {
+  return static_cast<size_type>(std::numeric_limits<Key>::max());
+}
+
+template <typename Key>
+typename integer_set<Key>::size_type integer_set<Key>::memory_usage() const {
+  return bits_.memory_usage();
+}
+
+template <typename Key>
+void integer_set<Key>::clear() {
+  bits_.Clear();
+  size_ = 0;
+}
+
+template <typename Key>
+std::pair<typename integer_set<Key>::iterator, bool> integer_set<Key>::insert(
+    const value_type &value) {
+  bool inserted = bits_.Set(value);
+  if (inserted) {
+    ++size_;
+  }
+  return std::make_pair(MakeIterator(value), inserted);
+}
+
+template <typename Key>
+void integer_set<Key>::erase(iterator pos) {
+  erase(*pos);
+}
+
+template <typename Key>
+typename integer_set<Key>::size_type integer_set<Key>::erase(const Key &key) {
+  if (!bits_.Reset(key)) {
+    return 0;
+  }
+  --size_;
+  return 1;
+}
+
+template <typename Key>
+void integer_set<Key>::swap(integer_set &other) {
+  bits_.Swap(other.bits_);
+  std::swap(size_, other.size_);
+}
+
+// Word-wise: the keys of other missing here move over, the rest stay
+template <typename Key>
+void integer_set<Key>::merge(integer_set &other) {
+  if (this == &other) {
+    return;
+  }
+  size_type moved = bits_.Merge(other.bits_);
+  size_ += moved;
+  other.size_ -= moved;
+}
+
+template <typename Key>
+template <typename... Args>
+s21::vector<std::pair<typename integer_set<Key>::iterator, bool>>
+integer_set<Key>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  (result_vector.push_back(insert(std::forward<Args>(args))), ...);
+  return result_vector;
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::find(
+    const Key &key) const {
+  return bits_.Test(key) ? MakeIterator(key) : end();
+}
+
+template <typename Key>
+bool integer_set<Key>::contains(const Key &key) const {
+  return bits_.Test(key);
+}
+
+template <typename Key>
+typename integer_set<Key>::size_type integer_set<Key>::count(
+    const Key &key) const {
+  return bits_.Test(key) ? 1 : 0;
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::lower_bound(
+    const Key &key) const {
+  return MakeIterator(bits_.Next(key));
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::upper_bound(
+    const Key &key) const {
+  if (key == std::numeric_limits<Key>::max()) {
+    return end();
+  }
+  return MakeIterator(bits_.Next(static_cast<size_t>(key) + 1));
+}
+
+template <typename Key>
+typename integer_set<Key>::iterator integer_set<Key>::MakeIterator(
+    size_t position) const {
+  return iterator(&bits_, position);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_INTEGER_SET_INTEGER_SET_H_
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <limits>
 
+#include "../s21_reclaimer/Reclaimer.h"
 #include "s21_iterator_and_node.h"
 
 namespace s21 {
@@ -49,6 +50,9 @@ class list {
 
   // modifiers
   void clear();
+  // Like clear, but O(1): the nodes are handed to a background thread that
+  // destroys and frees them later, see Reclaimer
+  void clear_async();
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void push_back(const_reference value);
@@ -220,6 +224,40 @@ void list<value_type>::clear() {
   }
 }
 
+// Node chain detached by clear_async, freed on the Reclaimer thread
+template <typename value_type>
+class DetachedListNodes : public ReclaimJob {
+ public:
+  DetachedListNodes(node<value_type> *head, size_t size)
+      : head_(head), size_(size){};
+
+  // Counted rather than run up to nullptr, as the tail's next_node is not
+  // reset by pop_back
+  void Run() override {
+    for (; size_ > 0; --size_) {
+      node<value_type> *next = head_->next_node;
+      delete head_;
+      head_ = next;
+    }
+  }
+
+ private:
+  node<value_type> *head_;
+  size_t size_;
+};
+
+template <typename value_type>
+void list<value_type>::clear_async() {
+  if (empty()) {
+    return;
+  }
+  Reclaimer::Instance().Post(
+      new DetachedListNodes<value_type>(_head_l, _size_l));
+  _head_l = nullptr;
+  _tail_l = nullptr;
+  _size_l = 0;
+}
+
 template <typename value_type>
 typename list<value_type>::iterator list<value_type>::insert(
     iterator pos, const_reference value) {
@@ -1,22 +1,27 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_MAP_MAP_H_
 #define CPP2_S21_CONTAINERS_1_S21_MAP_MAP_H_
 
+#include "../s21_frozen_map/s21_frozen_map.h"
 #include "../s21_red_black_tree/RedBlackTree.h"
 #include "../s21_vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Balance = RedBlackBalance>
 class map {
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
   using reference = value_type &;
   using const_reference = const value_type &;
 
-  using iterator = typename RedBlackTree<value_type>::iterator;
-  using const_iterator = typename RedBlackTree<value_type>::const_iterator;
+  using tree_type = RedBlackTree<value_type, key_compare,
+                                 SelectFirst<value_type>, Balance>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   //Конструкторы и основные операторы
@@ -24,11 +29,14 @@ class map {
   map();
   map(std::initializer_list<value_type> const &items);
   map(const map &m);
+  // Copies m on up to threads threads (0: one per core), see
+  // RedBlackTree(const RedBlackTree &, size_t)
+  map(const map &m, size_t threads);
   map(map &&m) noexcept;
   ~map();
 
-  map<Key, T> &operator=(const map &m);
-  map<Key, T> &operator=(map &&m);
+  map<Key, T, Compare, Balance> &operator=(const map &m);
+  map<Key, T, Compare, Balance> &operator=(map &&m);
   T &at(const Key &key);
   T &operator[](const Key &key);
 
@@ -42,58 +50,163 @@ class map {
   size_type size();
   size_type max_size();
   void clear();
+  // Like clear, but O(1): the elements are destroyed and their memory is
+  // freed later on a background thread, see Reclaimer
+  void clear_async();
 
   std::pair<iterator, bool> insert(const value_type &value);
   std::pair<iterator, bool> insert(const Key &key, const T &obj);
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
-
-  void erase(iterator pos);
+  // Inserts the elements of [first, last) whose keys are not present yet,
+  // one by one for a small batch and by merging a large one with the
+  // contents in one pass (see RedBlackTree::InsertUnique)
+  template <typename ForwardIt>
+  ForwardIteratorT<ForwardIt, void> insert(ForwardIt first, ForwardIt last);
+
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
   void swap(map &other);
+  // Removes the elements pred(const value_type &) holds for and returns
+  // how many went, rebuilding the tree in one pass when that is cheaper
+  // (see RedBlackTree::EraseIf)
+  template <typename K, typename V, typename C, typename B, typename Pred>
+  friend size_t erase_if(map<K, V, C, B> &m, Pred pred);
   void merge(map &other);
   bool contains(const Key &key);
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  // Batched lookup of the keys in [first, last): writes one iterator (end()
+  // on a miss) or one bool per key to out, in order, and returns the
+  // advanced out. Faster than a find() loop on batches of dozens of keys.
+ public:
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out);
+
+  // Immutable, read-optimized snapshot of the current contents
+ public:
+  frozen_map<Key, T, Compare> freeze() const;
+
+  // Parallel traversal on up to threads threads (0: one per core), see
+  // RedBlackTree::ParallelForEach. f runs concurrently on different
+  // elements in no particular order; parallel_reduce folds with op from
+  // identity, which must be an identity of op, and combines in key order.
+ public:
+  template <typename Function>
+  void parallel_for_each(Function f, size_t threads = 0);
+  // The three-argument reduce uses op to combine partial results too, so
+  // op(R, R) has to be valid; map elements are pairs, so it usually needs
+  // the four-argument form.
+  template <typename R, typename Op>
+  R parallel_reduce(R identity, Op op, size_t threads = 0) const;
+  template <typename R, typename Op, typename Combine>
+  R parallel_reduce(R identity, Op op, Combine combine,
+                    size_t threads) const;
+  // Splits the map into k consecutive ranges [first, last) of roughly
+  // equal size without visiting or copying the elements, for handing one
+  // range to each worker of a thread pool (see RedBlackTree::Partition)
+  s21::vector<std::pair<iterator, iterator>> partition(size_type k);
+
+  // Memory layout
+ public:
+  // Moves every node into one contiguous block, laid out in key order or
+  // in van Emde Boas order, to restore locality after heavy churn. The
+  // elements are unchanged; iterators and references are invalidated.
+  void compact(NodeLayout layout = NodeLayout::kInOrder);
+  // Preallocates node storage for size elements in one block, so that
+  // inserting up to that many allocates nothing; shrink_to_fit frees the
+  // storage no element uses any more. clear() frees all of it.
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  // Localized lookups
+ public:
+  // Searches from finger rather than from the root, in O(log d) for a key
+  // d elements away; finger may be end()
+  iterator find_from(iterator finger, const Key &key);
+  // With the cache on, find, at, operator[], contains and erase by key
+  // first check the element found last and otherwise search from it, which
+  // suits sequential and clustered access. Off by default; while on,
+  // lookups on the same map must not run concurrently.
+  void set_lookup_cache(bool enabled);
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
+ public:
+  size_type count(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+  // Heterogeneous lookup, available when Compare::is_transparent is defined
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> find(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, bool> contains(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> count(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> lower_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> upper_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> erase(const K &key);
+
  private:
-  RedBlackTree<value_type> tree_;
-  iterator FindByKey(const Key &key);
+  tree_type tree_;
+  template <typename K>
+  iterator FindByKey(const K &key);
+  template <typename K>
+  size_type EraseByKey(const K &key);
   void ClearElements();
 };
 
 /////////////////////////////////////////////////////////
 
-template <typename Key, typename T>
-map<Key, T>::map() = default;
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::map() = default;
 
-template <typename Key, typename T>
-map<Key, T>::map(std::initializer_list<value_type> const &items) {
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::map(
+    std::initializer_list<value_type> const &items) {
   for (const auto &item : items) {
     insert(item);
   }
 }
 
-template <typename Key, typename T>
-map<Key, T>::map(const map &m) : tree_(m.tree_) {}
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::map(const map &m) : tree_(m.tree_) {}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::map(const map &m, size_t threads)
+    : tree_(m.tree_, threads) {}
 
-template <typename Key, typename T>
-map<Key, T>::map(map &&other) noexcept {
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::map(map &&other) noexcept {
   this->tree_ = std::move(other.tree_);
 }
 
-template <typename Key, typename T>
-map<Key, T>::~map() = default;
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance>::~map() = default;
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(const map &m) {
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance> &map<Key, T, Compare, Balance>::operator=(
+    const map &m) {
   if (this != &m) {
     tree_ = m.tree_;
   }
   return *this;
 }
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(map &&m) {
+template <typename Key, typename T, typename Compare, typename Balance>
+map<Key, T, Compare, Balance> &map<Key, T, Compare, Balance>::operator=(
+    map &&m) {
   if (this != &m) {
     tree_.ClearNodes(tree_.GetRoot());
     tree_ = std::move(m.tree_);
@@ -101,8 +214,8 @@ map<Key, T> &map<Key, T>::operator=(map &&m) {
   return *this;
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::at(const Key &key) {
+template <typename Key, typename T, typename Compare, typename Balance>
+T &map<Key, T, Compare, Balance>::at(const Key &key) {
   iterator it = find(key);
   if (it == end()) {
     throw std::out_of_range("Key not found");
@@ -110,78 +223,93 @@ T &map<Key, T>::at(const Key &key) {
   return it->second;
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::operator[](const Key &key) {
+template <typename Key, typename T, typename Compare, typename Balance>
+T &map<Key, T, Compare, Balance>::operator[](const Key &key) {
   iterator it = find(key);
   if (it == end()) {
-    insert(std::make_pair(key, mapped_type()));
-    it = find(key);
+    it = insert(std::make_pair(key, mapped_type())).first;
     return it->second;
   } else {
     return it->second;
   }
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::begin() {
   return iterator(tree_.MinNode(tree_.GetRoot()), tree_.GetNil());
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::end() {
   return iterator(tree_.GetNil(), tree_.GetNil());
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::find(const Key &key) {
   return FindByKey(key);
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::FindByKey(const Key &key) {
-  iterator it;
-  for (it = begin(); it != end(); ++it) {
-    if (it->first == key) {
-      return it;
-    }
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename map<Key, T, Compare, Balance>::iterator>
+map<Key, T, Compare, Balance>::find(const K &key) {
+  return FindByKey(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::FindByKey(const K &key) {
+  auto *node = tree_.LookupNode(key);
+  if (node == nullptr) {
+    return end();
   }
-  return end();
+  return iterator(node, tree_.GetNil());
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::empty() {
+template <typename Key, typename T, typename Compare, typename Balance>
+bool map<Key, T, Compare, Balance>::empty() {
   return begin() == end();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::size() {
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::size_type
+map<Key, T, Compare, Balance>::size() {
   return tree_.GetSize();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::max_size() {
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::size_type
+map<Key, T, Compare, Balance>::max_size() {
   return tree_.GetMaxSize();
 }
 
-template <typename Key, typename T>
-void map<Key, T>::clear() {
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::clear() {
   ClearElements();
   tree_.SetRoot(tree_.GetNil());
 }
 
-template <typename Key, typename T>
-void map<Key, T>::ClearElements() {
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::clear_async() {
+  tree_.ClearAsync();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::ClearElements() {
   tree_.ClearNodes(tree_.GetRoot());
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type &value) {
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename map<Key, T, Compare, Balance>::iterator, bool>
+map<Key, T, Compare, Balance>::insert(const value_type &value) {
   iterator it = find(value.first);
   bool flag = true;
   if (it == end()) {
-    tree_.Insert(value);
-    it = find(value.first);
+    it = iterator(tree_.Insert(value), tree_.GetNil());
     flag = true;
   } else {
     flag = false;
@@ -189,28 +317,35 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
   return std::make_pair(it, flag);
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  return map<Key, T>::insert(std::make_pair(key, obj));
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename map<Key, T, Compare, Balance>::iterator, bool>
+map<Key, T, Compare, Balance>::insert(const Key &key, const T &obj) {
+  return insert(std::make_pair(key, obj));
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename map<Key, T, Compare, Balance>::iterator, bool>
+map<Key, T, Compare, Balance>::insert_or_assign(const Key &key, const T &obj) {
   iterator it = find(key);
   if (it != end()) {
     it->second = obj;
     return std::make_pair(it, false);
   } else {
-    return map<Key, T>::insert(key, obj);
+    return insert(key, obj);
   }
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename ForwardIt>
+ForwardIteratorT<ForwardIt, void> map<Key, T, Compare, Balance>::insert(
+    ForwardIt first, ForwardIt last) {
+  tree_.InsertUnique(first, last);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
 template <typename... Args>
-s21::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args &&...args) {
+s21::vector<std::pair<typename map<Key, T, Compare, Balance>::iterator, bool>>
+map<Key, T, Compare, Balance>::insert_many(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result_vector;
   std::initializer_list<value_type> init_list = {std::forward<Args>(args)...};
 
@@ -222,21 +357,52 @@ map<Key, T>::insert_many(Args &&...args) {
   return result_vector;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::erase(iterator pos) {
-  iterator it = find(pos->first);
-  if (it != end()) {
-    tree_.RemoveNode(tree_.FindNode(*it));
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::erase(iterator pos) {
+  return iterator(tree_.EraseNode(pos.GetNode()), tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::erase(iterator first, iterator last) {
+  return iterator(tree_.EraseNodes(first.GetNode(), last.GetNode()),
+                  tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::size_type
+map<Key, T, Compare, Balance>::erase(const Key &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename map<Key, T, Compare, Balance>::size_type>
+map<Key, T, Compare, Balance>::erase(const K &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+typename map<Key, T, Compare, Balance>::size_type
+map<Key, T, Compare, Balance>::EraseByKey(const K &key) {
+  auto *node = tree_.LookupNode(key);
+  if (node == nullptr) {
+    return 0;
   }
+  tree_.RemoveNode(node);
+  return 1;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::swap(map &other) {
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::swap(map &other) {
   std::swap(tree_, other.tree_);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::merge(map &other) {
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::merge(map &other) {
   iterator it = other.begin();
   while (it != other.end()) {
     iterator next = std::next(it);
@@ -247,14 +413,164 @@ void map<Key, T>::merge(map &other) {
   }
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::contains(const Key &key) {
-  typename map<Key, T>::iterator it = find(key);
-  if (it == end()) {
-    return false;
-  } else {
-    return true;
+template <typename Key, typename T, typename Compare, typename Balance>
+bool map<Key, T, Compare, Balance>::contains(const Key &key) {
+  return tree_.LookupNode(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, bool> map<Key, T, Compare, Balance>::contains(
+    const K &key) {
+  return tree_.LookupNode(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::size_type
+map<Key, T, Compare, Balance>::count(const Key &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename map<Key, T, Compare, Balance>::size_type>
+map<Key, T, Compare, Balance>::count(const K &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::lower_bound(const Key &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename map<Key, T, Compare, Balance>::iterator>
+map<Key, T, Compare, Balance>::lower_bound(const K &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::upper_bound(const Key &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename map<Key, T, Compare, Balance>::iterator>
+map<Key, T, Compare, Balance>::upper_bound(const K &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename ForwardIt, typename OutputIt>
+OutputIt map<Key, T, Compare, Balance>::find_many(ForwardIt first,
+                                                  ForwardIt last,
+                                                  OutputIt out) {
+  tree_.FindNodes(first, last, [this, &out](auto *node) {
+    *out++ = node == nullptr ? end() : iterator(node, tree_.GetNil());
+  });
+  return out;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename ForwardIt, typename OutputIt>
+OutputIt map<Key, T, Compare, Balance>::contains_many(ForwardIt first,
+                                                      ForwardIt last,
+                                                      OutputIt out) {
+  tree_.FindNodes(first, last,
+                  [&out](auto *node) { *out++ = node != nullptr; });
+  return out;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+frozen_map<Key, T, Compare> map<Key, T, Compare, Balance>::freeze() const {
+  return frozen_map<Key, T, Compare>(tree_.begin(), tree_.GetSize());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::compact(NodeLayout layout) {
+  tree_.Compact(layout);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::reserve(size_type size) {
+  tree_.Reserve(size);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename map<Key, T, Compare, Balance>::iterator
+map<Key, T, Compare, Balance>::find_from(iterator finger, const Key &key) {
+  auto *node = tree_.FindNodeFrom(finger.GetNode(), key);
+  if (node == nullptr) {
+    return end();
   }
+  return iterator(node, tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void map<Key, T, Compare, Balance>::set_lookup_cache(bool enabled) {
+  tree_.SetLookupCache(enabled);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+TreeStats map<Key, T, Compare, Balance>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+bool map<Key, T, Compare, Balance>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename Function>
+void map<Key, T, Compare, Balance>::parallel_for_each(Function f,
+                                                      size_t threads) {
+  tree_.ParallelForEach(f, threads);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename R, typename Op>
+R map<Key, T, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                                 size_t threads) const {
+  return tree_.ParallelReduce(identity, op, op, threads);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename R, typename Op, typename Combine>
+R map<Key, T, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                                 Combine combine,
+                                                 size_t threads) const {
+  return tree_.ParallelReduce(identity, op, combine, threads);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+s21::vector<std::pair<typename map<Key, T, Compare, Balance>::iterator,
+                      typename map<Key, T, Compare, Balance>::iterator>>
+map<Key, T, Compare, Balance>::partition(size_type k) {
+  s21::vector<typename tree_type::node_type *> bounds = tree_.Partition(k);
+  s21::vector<std::pair<iterator, iterator>> ranges;
+  ranges.reserve(k);
+  for (size_type i = 0; i < k; ++i) {
+    ranges.push_back(std::make_pair(iterator(bounds[i], tree_.GetNil()),
+                                    iterator(bounds[i + 1], tree_.GetNil())));
+  }
+  return ranges;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance,
+          typename Pred>
+size_t erase_if(map<Key, T, Compare, Balance> &m, Pred pred) {
+  return m.tree_.EraseIf(pred);
 }
 
 }  // namespace s21
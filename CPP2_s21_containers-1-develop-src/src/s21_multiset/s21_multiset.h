@@ -6,15 +6,19 @@
 
 namespace s21 {
 
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          typename Balance = RedBlackBalance>
 class multiset {
  public:
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RedBlackTree<value_type>::iterator;
-  using const_iterator = typename RedBlackTree<value_type>::const_iterator;
+  using tree_type = RedBlackTree<value_type, key_compare, Identity<value_type>,
+                                 Balance>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   // Multiset Constructors and operators
@@ -22,11 +26,14 @@ class multiset {
   multiset();
   multiset(std::initializer_list<value_type> const &items);
   multiset(const multiset &ms);
+  // Copies ms on up to threads threads (0: one per core), see
+  // RedBlackTree(const RedBlackTree &, size_t)
+  multiset(const multiset &ms, size_t threads);
   multiset(multiset &&ms);
   ~multiset();
 
-  multiset<Key> &operator=(const multiset &ms);
-  multiset<Key> &operator=(multiset &&ms);
+  multiset<Key, Compare, Balance> &operator=(const multiset &ms);
+  multiset<Key, Compare, Balance> &operator=(multiset &&ms);
 
   // Multiset Main Iterators
  public:
@@ -40,9 +47,19 @@ class multiset {
   size_type max_size();
 
   void clear();
+  // Like clear, but O(1): the elements are destroyed and their memory is
+  // freed later on a background thread, see Reclaimer
+  void clear_async();
   iterator insert(const value_type &value);
-  void erase(iterator pos);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
   void swap(multiset &other);
+  // Removes the elements pred(const value_type &) holds for and returns
+  // how many went, rebuilding the tree in one pass when that is cheaper
+  // (see RedBlackTree::EraseIf)
+  template <typename K, typename C, typename B, typename Pred>
+  friend size_t erase_if(multiset<K, C, B> &s, Pred pred);
   void merge(multiset &other);
 
   // Multiset Lookup
@@ -54,47 +71,112 @@ class multiset {
   iterator lower_bound(const Key &key);
   iterator upper_bound(const Key &key);
 
+  // Heterogeneous lookup, available when Compare::is_transparent is defined
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> count(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> find(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, bool> contains(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, std::pair<iterator, iterator>> equal_range(
+      const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> lower_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> upper_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> erase(const K &key);
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  // Parallel traversal on up to threads threads (0: one per core), see
+  // RedBlackTree::ParallelForEach. f runs concurrently on different
+  // elements in no particular order; parallel_reduce folds with op from
+  // identity, which must be an identity of op, and combines in key order.
+ public:
+  template <typename Function>
+  void parallel_for_each(Function f, size_t threads = 0);
+  // The three-argument reduce also combines the partial results with op.
+  template <typename R, typename Op>
+  R parallel_reduce(R identity, Op op, size_t threads = 0) const;
+  template <typename R, typename Op, typename Combine>
+  R parallel_reduce(R identity, Op op, Combine combine,
+                    size_t threads) const;
+  // Splits the multiset into k consecutive ranges [first, last) of roughly
+  // equal size without visiting or copying the elements, for handing one
+  // range to each worker of a thread pool (see RedBlackTree::Partition)
+  s21::vector<std::pair<iterator, iterator>> partition(size_type k);
+
+  // Memory layout
+ public:
+  // Moves every node into one contiguous block, laid out in key order or
+  // in van Emde Boas order, to restore locality after heavy churn. The
+  // elements are unchanged; iterators and references are invalidated.
+  void compact(NodeLayout layout = NodeLayout::kInOrder);
+  // Preallocates node storage for size elements in one block, so that
+  // inserting up to that many allocates nothing; shrink_to_fit frees the
+  // storage no element uses any more. clear() frees all of it.
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
  private:
-  RedBlackTree<value_type> tree_;
-  iterator FindByKey(const Key &key);
+  tree_type tree_;
+  template <typename K>
+  iterator FindByKey(const K &key);
+  template <typename K>
+  size_type CountByKey(const K &key);
+  template <typename K>
+  size_type EraseByKey(const K &key);
   // iterator GetMaxKey();
   iterator GetMinKey();
 };
 
-template <typename Key>
-multiset<Key>::multiset() = default;
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::multiset() = default;
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<value_type> const &items) {
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::multiset(
+    std::initializer_list<value_type> const &items) {
   for (const auto &item : items) {
     insert(item);
   }
 }
 
-template <typename Key>
-multiset<Key>::multiset(const multiset &ms) : tree_(ms.tree_) {}
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::multiset(
+    const multiset &ms) : tree_(ms.tree_) {}
+
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::multiset(const multiset &ms, size_t threads)
+    : tree_(ms.tree_, threads) {}
 
-template <typename Key>
-multiset<Key>::multiset(multiset &&ms) {
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::multiset(multiset &&ms) {
   this->tree_ = std::move(ms.tree_);
 }
 
-template <typename Key>
-multiset<Key>::~multiset() = default;
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance>::~multiset() = default;
 
-template <typename Key>
-multiset<Key> &multiset<Key>::operator=(const multiset &ms) {
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance> &multiset<Key, Compare, Balance>::operator=(
+    const multiset &ms) {
   if (this != &ms) {
     tree_ = ms.tree_;
   }
   return *this;
 }
 
-template <typename Key>
-multiset<Key> &multiset<Key>::operator=(multiset &&ms) {
+template <typename Key, typename Compare, typename Balance>
+multiset<Key, Compare, Balance> &multiset<Key, Compare, Balance>::operator=(
+    multiset &&ms) {
   if (this != &ms) {
     tree_.ClearNodes(tree_.GetRoot());
     tree_ = std::move(ms.tree_);
@@ -102,48 +184,56 @@ multiset<Key> &multiset<Key>::operator=(multiset &&ms) {
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::begin() {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::begin() {
   return GetMinKey();
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::end() {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::end() {
   return iterator(tree_.GetNil(), tree_.GetNil());
 }
 
-template <typename Key>
-bool multiset<Key>::empty() {
+template <typename Key, typename Compare, typename Balance>
+bool multiset<Key, Compare, Balance>::empty() {
   return begin() == end();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::size() {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::size() {
   return tree_.GetSize();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::max_size() {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::max_size() {
   return tree_.GetMaxSize();
 }
 
-template <typename Key>
-void multiset<Key>::clear() {
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::clear() {
   tree_.ClearNodes(tree_.GetRoot());
   tree_.SetRoot(tree_.GetNil());
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
-    const value_type &value) {
-  tree_.Insert(value);
-  return find(value);
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::clear_async() {
+  tree_.ClearAsync();
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::insert(const value_type &value) {
+  return iterator(tree_.Insert(value), tree_.GetNil());
 }
 
-template <typename Key>
+template <typename Key, typename Compare, typename Balance>
 template <typename... Args>
-s21::vector<std::pair<typename multiset<Key>::iterator, bool>>
-multiset<Key>::insert_many(Args &&...args) {
+s21::vector<std::pair<typename multiset<Key, Compare, Balance>::iterator, bool>>
+multiset<Key, Compare, Balance>::insert_many(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result_vector;
   s21::vector<value_type> new_vector;
 
@@ -156,22 +246,55 @@ multiset<Key>::insert_many(Args &&...args) {
   return result_vector;
 }
 
-template <typename Key>
-void multiset<Key>::erase(iterator pos) {
-  iterator it = find(*pos);
-  if (it != end()) {
-    tree_.RemoveNode(tree_.FindNode(*it));
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::erase(iterator pos) {
+  return iterator(tree_.EraseNode(pos.GetNode()), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::erase(iterator first, iterator last) {
+  return iterator(tree_.EraseNodes(first.GetNode(), last.GetNode()),
+                  tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::erase(const Key &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename multiset<Key, Compare, Balance>::size_type>
+multiset<Key, Compare, Balance>::erase(const K &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::EraseByKey(const K &key) {
+  size_type count = 0;
+  auto *node = tree_.FindNode(key);
+  while (node != nullptr) {
+    tree_.RemoveNode(node);
+    node = tree_.FindNode(key);
+    ++count;
   }
+  return count;
 }
 
-template <typename Key>
-void multiset<Key>::swap(multiset &other) {
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::swap(multiset &other) {
   std::swap(tree_, other.tree_);
 }
 
 //--------------------------------------------//
-template <typename Key>
-void multiset<Key>::merge(multiset &other) {
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::merge(multiset &other) {
   iterator it;
   for (it = other.begin(); it != other.end(); ++it) {
     insert(*it);
@@ -179,76 +302,192 @@ void multiset<Key>::merge(multiset &other) {
   other.clear();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key &key) {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::count(const Key &key) {
+  return CountByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename multiset<Key, Compare, Balance>::size_type>
+multiset<Key, Compare, Balance>::count(const K &key) {
+  return CountByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+typename multiset<Key, Compare, Balance>::size_type
+multiset<Key, Compare, Balance>::CountByKey(const K &key) {
   size_type count = 0;
-  for (iterator it = begin(); it != end(); ++it) {
-    if (*it == key) {
-      ++count;
-    }
+  iterator last = iterator(tree_.UpperBoundNode(key), tree_.GetNil());
+  for (iterator it = lower_bound(key); it != last; ++it) {
+    ++count;
   }
   return count;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::find(const Key &key) {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::find(const Key &key) {
   return FindByKey(key);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::FindByKey(const Key &key) {
-  for (iterator it = begin(); it != end(); ++it) {
-    if (*it == key) {
-      return it;
-    }
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename multiset<Key, Compare, Balance>::iterator>
+multiset<Key, Compare, Balance>::find(const K &key) {
+  return FindByKey(key);
+}
+
+// Returns the first of the equal elements, as std::multiset does
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::FindByKey(const K &key) {
+  auto *node = tree_.LowerBoundNode(key);
+  if (node == tree_.GetNil() || key_compare()(key, node->data_)) {
+    return end();
   }
-  return end();
+  return iterator(node, tree_.GetNil());
 }
 
-template <typename Key>
-bool multiset<Key>::contains(const Key &key) {
-  iterator it = find(key);
-  bool result = !(it == end());
-  return result;
+template <typename Key, typename Compare, typename Balance>
+bool multiset<Key, Compare, Balance>::contains(const Key &key) {
+  return tree_.FindNode(key) != nullptr;
 }
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key &key) {
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, bool> multiset<Key, Compare, Balance>::contains(
+    const K &key) {
+  return tree_.FindNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare, typename Balance>
+std::pair<typename multiset<Key, Compare, Balance>::iterator,
+          typename multiset<Key, Compare, Balance>::iterator>
+multiset<Key, Compare, Balance>::equal_range(const Key &key) {
   return {lower_bound(key), upper_bound(key)};
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key &key) {
-  iterator it;
-  for (it = begin(); it != end(); ++it) {
-    if (!(*it < key)) {
-      return it;
-    }
-  }
-  return end();
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<
+    Compare, K,
+    std::pair<typename multiset<Key, Compare, Balance>::iterator,
+              typename multiset<Key, Compare, Balance>::iterator>>
+multiset<Key, Compare, Balance>::equal_range(const K &key) {
+  return {lower_bound(key), upper_bound(key)};
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key &key) {
-  for (iterator it = begin(); it != end(); ++it) {
-    if (*it > key) {
-      return it;
-    }
-  }
-  return end();
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::lower_bound(const Key &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename multiset<Key, Compare, Balance>::iterator>
+multiset<Key, Compare, Balance>::lower_bound(const K &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::upper_bound(const Key &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K,
+                   typename multiset<Key, Compare, Balance>::iterator>
+multiset<Key, Compare, Balance>::upper_bound(const K &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
 }
 
-// template <typename Key>
+// template <typename Key, typename Compare, typename Balance>
 // typename multiset<Key>::iterator multiset<Key>::GetMaxKey() {
 //   return iterator(tree_.MaxNode(tree_.GetRoot()), tree_.GetNil());
 // }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::GetMinKey() {
+template <typename Key, typename Compare, typename Balance>
+typename multiset<Key, Compare, Balance>::iterator
+multiset<Key, Compare, Balance>::GetMinKey() {
   return iterator(tree_.MinNode(tree_.GetRoot()), tree_.GetNil());
 }
 
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::compact(NodeLayout layout) {
+  tree_.Compact(layout);
+}
+
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::reserve(size_type size) {
+  tree_.Reserve(size);
+}
+
+template <typename Key, typename Compare, typename Balance>
+void multiset<Key, Compare, Balance>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename Key, typename Compare, typename Balance>
+TreeStats multiset<Key, Compare, Balance>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename Compare, typename Balance>
+bool multiset<Key, Compare, Balance>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename Function>
+void multiset<Key, Compare, Balance>::parallel_for_each(Function f,
+                                                        size_t threads) {
+  tree_.ParallelForEach(f, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename R, typename Op>
+R multiset<Key, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                                   size_t threads) const {
+  return tree_.ParallelReduce(identity, op, op, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename R, typename Op, typename Combine>
+R multiset<Key, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                                   Combine combine,
+                                                   size_t threads) const {
+  return tree_.ParallelReduce(identity, op, combine, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+s21::vector<std::pair<typename multiset<Key, Compare, Balance>::iterator,
+                      typename multiset<Key, Compare, Balance>::iterator>>
+multiset<Key, Compare, Balance>::partition(size_type k) {
+  s21::vector<typename tree_type::node_type *> bounds = tree_.Partition(k);
+  s21::vector<std::pair<iterator, iterator>> ranges;
+  ranges.reserve(k);
+  for (size_type i = 0; i < k; ++i) {
+    ranges.push_back(std::make_pair(iterator(bounds[i], tree_.GetNil()),
+                                    iterator(bounds[i + 1], tree_.GetNil())));
+  }
+  return ranges;
+}
+
+template <typename Key, typename Compare, typename Balance, typename Pred>
+size_t erase_if(multiset<Key, Compare, Balance> &s, Pred pred) {
+  return s.tree_.EraseIf(pred);
+}
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_S21_MULTISET_MULTISET_H_
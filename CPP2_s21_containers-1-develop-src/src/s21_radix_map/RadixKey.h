@@ -0,0 +1,113 @@
+#ifndef CPP2_S21_CONTAINERS_1_RADIX_KEY_H_
+#define CPP2_S21_CONTAINERS_1_RADIX_KEY_H_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace s21 {
+
+// Byte string a radix_map indexes a key by. String keys are viewed in
+// place; integer keys are stored inline big-endian with the sign bit
+// flipped, so that byte-wise order always matches the key order.
+class RadixKey {
+ public:
+  RadixKey(const char *data, size_t size)
+      : data_(reinterpret_cast<const unsigned char *>(data)), size_(size){};
+  RadixKey(const RadixKey &other);
+  RadixKey &operator=(const RadixKey &other) = delete;
+
+  template <typename Integer>
+  static RadixKey FromInteger(Integer value);
+
+  size_t size() const { return size_; }
+  unsigned char operator[](size_t pos) const { return Bytes()[pos]; }
+
+  // <0, 0 or >0 as in memcmp, a proper prefix ordering first
+  static int Compare(const RadixKey &lhs, const RadixKey &rhs);
+  static bool HasPrefix(const RadixKey &key, const RadixKey &prefix);
+  // Number of equal bytes of lhs and rhs starting at from
+  static size_t CommonPrefix(const RadixKey &lhs, const RadixKey &rhs,
+                             size_t from);
+
+ private:
+  RadixKey() : data_(nullptr), size_(0), inline_{} {};
+
+  const unsigned char *Bytes() const {
+    return data_ != nullptr ? data_ : inline_;
+  }
+
+  const unsigned char *data_;  // nullptr when the bytes are in inline_
+  size_t size_;
+  unsigned char inline_[sizeof(unsigned long long)];
+};
+
+template <typename Key, typename = void>
+struct RadixKeyTraits {};
+
+template <>
+struct RadixKeyTraits<std::string> {
+  static RadixKey Encode(const std::string &key) {
+    return RadixKey(key.data(), key.size());
+  }
+};
+
+template <typename Key>
+struct RadixKeyTraits<Key, std::enable_if_t<std::is_integral<Key>::value &&
+                                            !std::is_same<Key, bool>::value>> {
+  static RadixKey Encode(Key key) { return RadixKey::FromInteger(key); }
+};
+
+//////////////////////////////////////////////////////
+
+inline RadixKey::RadixKey(const RadixKey &other)
+    : data_(other.data_), size_(other.size_) {
+  std::memcpy(inline_, other.inline_, sizeof(inline_));
+}
+
+template <typename Integer>
+RadixKey RadixKey::FromInteger(Integer value) {
+  static_assert(sizeof(Integer) <= sizeof(unsigned long long),
+                "integer keys wider than 64 bits are not supported");
+  using Unsigned = std::make_unsigned_t<Integer>;
+  Unsigned bits = static_cast<Unsigned>(value);
+  if (std::is_signed<Integer>::value) {
+    bits ^= static_cast<Unsigned>(Unsigned(1) << (sizeof(Integer) * 8 - 1));
+  }
+  RadixKey key;
+  key.size_ = sizeof(Integer);
+  for (size_t i = sizeof(Integer); i-- > 0;) {
+    key.inline_[i] = static_cast<unsigned char>(bits & 0xFF);
+    bits = static_cast<Unsigned>(bits >> 8);
+  }
+  return key;
+}
+
+inline int RadixKey::Compare(const RadixKey &lhs, const RadixKey &rhs) {
+  size_t common = lhs.size_ < rhs.size_ ? lhs.size_ : rhs.size_;
+  int result = common == 0 ? 0 : std::memcmp(lhs.Bytes(), rhs.Bytes(), common);
+  if (result != 0) {
+    return result;
+  }
+  return lhs.size_ < rhs.size_ ? -1 : (lhs.size_ > rhs.size_ ? 1 : 0);
+}
+
+inline bool RadixKey::HasPrefix(const RadixKey &key, const RadixKey &prefix) {
+  return key.size_ >= prefix.size_ &&
+         (prefix.size_ == 0 ||
+          std::memcmp(key.Bytes(), prefix.Bytes(), prefix.size_) == 0);
+}
+
+inline size_t RadixKey::CommonPrefix(const RadixKey &lhs, const RadixKey &rhs,
+                                     size_t from) {
+  size_t pos = from;
+  while (pos < lhs.size_ && pos < rhs.size_ && lhs[pos] == rhs[pos]) {
+    ++pos;
+  }
+  return pos - from;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_RADIX_KEY_H_
@@ -0,0 +1,515 @@
+#ifndef CPP2_S21_CONTAINERS_1_RADIX_NODE_H_
+#define CPP2_S21_CONTAINERS_1_RADIX_NODE_H_
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+enum class RadixKind : unsigned char {
+  kLeaf,
+  kNode4,
+  kNode16,
+  kNode48,
+  kNode256,
+};
+
+struct RadixNode {
+  RadixKind kind_;
+
+  explicit RadixNode(RadixKind kind) : kind_(kind){};
+};
+
+// Leaves are also chained in key order, which gives O(1) iterator steps
+struct RadixListLink {
+  RadixListLink *prev_;
+  RadixListLink *next_;
+
+  RadixListLink() : prev_(this), next_(this){};
+};
+
+template <typename Value>
+struct RadixLeaf : RadixNode, RadixListLink {
+  Value data_;
+
+  explicit RadixLeaf(const Value &data)
+      : RadixNode(RadixKind::kLeaf), data_(data){};
+};
+
+// Header shared by the four inner node sizes. The compressed path is kept
+// optimistically: prefix_len_ counts every skipped byte but only the first
+// kMaxPrefix of them are stored, the rest are read back from any leaf below.
+struct RadixInner : RadixNode {
+  static constexpr uint32_t kMaxPrefix = 8;
+
+  uint16_t count_;
+  uint32_t prefix_len_;
+  unsigned char prefix_[kMaxPrefix];
+  RadixNode *terminal_;  // leaf whose key ends right after the prefix
+
+  explicit RadixInner(RadixKind kind)
+      : RadixNode(kind),
+        count_(0),
+        prefix_len_(0),
+        prefix_{},
+        terminal_(nullptr){};
+};
+
+struct RadixNode4 : RadixInner {
+  static constexpr uint16_t kCapacity = 4;
+  unsigned char keys_[kCapacity];
+  RadixNode *children_[kCapacity];
+
+  RadixNode4() : RadixInner(RadixKind::kNode4), keys_{}, children_{} {};
+};
+
+struct RadixNode16 : RadixInner {
+  static constexpr uint16_t kCapacity = 16;
+  unsigned char keys_[kCapacity];
+  RadixNode *children_[kCapacity];
+
+  RadixNode16() : RadixInner(RadixKind::kNode16), keys_{}, children_{} {};
+};
+
+// index_[byte] is the child slot plus one, 0 for no child
+struct RadixNode48 : RadixInner {
+  static constexpr uint16_t kCapacity = 48;
+  unsigned char index_[256];
+  RadixNode *children_[kCapacity];
+
+  RadixNode48() : RadixInner(RadixKind::kNode48), index_{}, children_{} {};
+};
+
+struct RadixNode256 : RadixInner {
+  RadixNode *children_[256];
+
+  RadixNode256() : RadixInner(RadixKind::kNode256), children_{} {};
+};
+
+// Child bookkeeping of the inner nodes, independent of the mapped types.
+// Add and Remove take the slot holding the node, because growing, shrinking
+// or collapsing a node replaces it with a different one.
+struct RadixChildren {
+  static RadixNode **Find(RadixInner *node, unsigned char byte);
+  // Smallest child (and its byte), or the first child above byte
+  static RadixNode *First(const RadixInner *node, unsigned char *byte);
+  static RadixNode *After(const RadixInner *node, unsigned char byte);
+  template <typename Visit>
+  static void ForEach(const RadixInner *node, Visit visit);
+
+  static void Add(RadixNode **slot, unsigned char byte, RadixNode *child);
+  static void Remove(RadixNode **slot, unsigned char byte);
+  // Restores the size class of *slot after a child or the terminal leaf was
+  // dropped: shrinks it, or replaces it by its only remaining entry
+  static void Compact(RadixNode **slot);
+
+  static void Delete(RadixInner *node);
+
+ private:
+  template <typename Small>
+  static void InsertSorted(Small *node, unsigned char byte, RadixNode *child);
+  template <typename Small>
+  static void EraseSorted(Small *node, unsigned char byte);
+  static void CopyHeader(RadixInner *to, const RadixInner *from);
+  static void MergePrefix(const RadixInner *parent, unsigned char byte,
+                          RadixInner *child);
+  static RadixInner *Grow(RadixInner *node);
+  static RadixInner *Shrink(RadixInner *node);
+};
+
+//////////////////////////////////////////////////////
+
+inline RadixNode **RadixChildren::Find(RadixInner *node, unsigned char byte) {
+  switch (node->kind_) {
+    case RadixKind::kNode4: {
+      RadixNode4 *small = static_cast<RadixNode4 *>(node);
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        if (small->keys_[i] == byte) {
+          return &small->children_[i];
+        }
+      }
+      return nullptr;
+    }
+    case RadixKind::kNode16: {
+      RadixNode16 *small = static_cast<RadixNode16 *>(node);
+#if defined(__SSE2__)
+      __m128i keys =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(small->keys_));
+      __m128i match =
+          _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+      int mask = _mm_movemask_epi8(match) & ((1 << small->count_) - 1);
+      return mask != 0 ? &small->children_[__builtin_ctz(mask)] : nullptr;
+#else
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        if (small->keys_[i] == byte) {
+          return &small->children_[i];
+        }
+      }
+      return nullptr;
+#endif
+    }
+    case RadixKind::kNode48: {
+      RadixNode48 *wide = static_cast<RadixNode48 *>(node);
+      unsigned char index = wide->index_[byte];
+      return index != 0 ? &wide->children_[index - 1] : nullptr;
+    }
+    case RadixKind::kNode256: {
+      RadixNode256 *wide = static_cast<RadixNode256 *>(node);
+      return wide->children_[byte] != nullptr ? &wide->children_[byte]
+                                              : nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+inline RadixNode *RadixChildren::First(const RadixInner *node,
+                                       unsigned char *byte) {
+  RadixNode *first = nullptr;
+  ForEach(node, [&](unsigned char key, RadixNode *child) {
+    if (first == nullptr) {
+      first = child;
+      *byte = key;
+    }
+  });
+  return first;
+}
+
+inline RadixNode *RadixChildren::After(const RadixInner *node,
+                                       unsigned char byte) {
+  switch (node->kind_) {
+    case RadixKind::kNode4: {
+      const RadixNode4 *small = static_cast<const RadixNode4 *>(node);
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        if (small->keys_[i] > byte) {
+          return small->children_[i];
+        }
+      }
+      return nullptr;
+    }
+    case RadixKind::kNode16: {
+      const RadixNode16 *small = static_cast<const RadixNode16 *>(node);
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        if (small->keys_[i] > byte) {
+          return small->children_[i];
+        }
+      }
+      return nullptr;
+    }
+    case RadixKind::kNode48: {
+      const RadixNode48 *wide = static_cast<const RadixNode48 *>(node);
+      for (unsigned next = byte + 1u; next < 256; ++next) {
+        if (wide->index_[next] != 0) {
+          return wide->children_[wide->index_[next] - 1];
+        }
+      }
+      return nullptr;
+    }
+    case RadixKind::kNode256: {
+      const RadixNode256 *wide = static_cast<const RadixNode256 *>(node);
+      for (unsigned next = byte + 1u; next < 256; ++next) {
+        if (wide->children_[next] != nullptr) {
+          return wide->children_[next];
+        }
+      }
+      return nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+// Calls visit(byte, child) for every child in byte order
+template <typename Visit>
+void RadixChildren::ForEach(const RadixInner *node, Visit visit) {
+  switch (node->kind_) {
+    case RadixKind::kNode4: {
+      const RadixNode4 *small = static_cast<const RadixNode4 *>(node);
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        visit(small->keys_[i], small->children_[i]);
+      }
+      break;
+    }
+    case RadixKind::kNode16: {
+      const RadixNode16 *small = static_cast<const RadixNode16 *>(node);
+      for (uint16_t i = 0; i < small->count_; ++i) {
+        visit(small->keys_[i], small->children_[i]);
+      }
+      break;
+    }
+    case RadixKind::kNode48: {
+      const RadixNode48 *wide = static_cast<const RadixNode48 *>(node);
+      for (unsigned byte = 0; byte < 256; ++byte) {
+        if (wide->index_[byte] != 0) {
+          visit(static_cast<unsigned char>(byte),
+                wide->children_[wide->index_[byte] - 1]);
+        }
+      }
+      break;
+    }
+    case RadixKind::kNode256: {
+      const RadixNode256 *wide = static_cast<const RadixNode256 *>(node);
+      for (unsigned byte = 0; byte < 256; ++byte) {
+        if (wide->children_[byte] != nullptr) {
+          visit(static_cast<unsigned char>(byte), wide->children_[byte]);
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+inline void RadixChildren::Add(RadixNode **slot, unsigned char byte,
+                               RadixNode *child) {
+  RadixInner *node = static_cast<RadixInner *>(*slot);
+  bool full = (node->kind_ == RadixKind::kNode4 &&
+               node->count_ == RadixNode4::kCapacity) ||
+              (node->kind_ == RadixKind::kNode16 &&
+               node->count_ == RadixNode16::kCapacity) ||
+              (node->kind_ == RadixKind::kNode48 &&
+               node->count_ == RadixNode48::kCapacity);
+  if (full) {
+    node = Grow(node);
+    *slot = node;
+  }
+
+  switch (node->kind_) {
+    case RadixKind::kNode4:
+      InsertSorted(static_cast<RadixNode4 *>(node), byte, child);
+      break;
+    case RadixKind::kNode16:
+      InsertSorted(static_cast<RadixNode16 *>(node), byte, child);
+      break;
+    case RadixKind::kNode48: {
+      // Slots are kept dense, so the first free one is at count_
+      RadixNode48 *wide = static_cast<RadixNode48 *>(node);
+      wide->children_[wide->count_] = child;
+      wide->index_[byte] = static_cast<unsigned char>(wide->count_ + 1);
+      ++wide->count_;
+      break;
+    }
+    case RadixKind::kNode256:
+      static_cast<RadixNode256 *>(node)->children_[byte] = child;
+      ++node->count_;
+      break;
+    default:
+      break;
+  }
+}
+
+inline void RadixChildren::Remove(RadixNode **slot, unsigned char byte) {
+  RadixInner *node = static_cast<RadixInner *>(*slot);
+  switch (node->kind_) {
+    case RadixKind::kNode4:
+      EraseSorted(static_cast<RadixNode4 *>(node), byte);
+      break;
+    case RadixKind::kNode16:
+      EraseSorted(static_cast<RadixNode16 *>(node), byte);
+      break;
+    case RadixKind::kNode48: {
+      RadixNode48 *wide = static_cast<RadixNode48 *>(node);
+      unsigned char freed = wide->index_[byte];
+      wide->index_[byte] = 0;
+      --wide->count_;
+      // Move the last slot into the hole to keep the slots dense
+      if (freed - 1 != wide->count_) {
+        for (unsigned other = 0; other < 256; ++other) {
+          if (wide->index_[other] == wide->count_ + 1) {
+            wide->index_[other] = freed;
+            break;
+          }
+        }
+        wide->children_[freed - 1] = wide->children_[wide->count_];
+      }
+      wide->children_[wide->count_] = nullptr;
+      break;
+    }
+    case RadixKind::kNode256:
+      static_cast<RadixNode256 *>(node)->children_[byte] = nullptr;
+      --node->count_;
+      break;
+    default:
+      break;
+  }
+  Compact(slot);
+}
+
+inline void RadixChildren::Compact(RadixNode **slot) {
+  RadixInner *node = static_cast<RadixInner *>(*slot);
+  if (node->count_ == 0) {
+    *slot = node->terminal_;
+    Delete(node);
+  } else if (node->count_ == 1 && node->terminal_ == nullptr) {
+    unsigned char byte = 0;
+    RadixNode *child = First(node, &byte);
+    if (child->kind_ != RadixKind::kLeaf) {
+      MergePrefix(node, byte, static_cast<RadixInner *>(child));
+    }
+    *slot = child;
+    Delete(node);
+  } else {
+    RadixInner *shrunk = Shrink(node);
+    if (shrunk != node) {
+      *slot = shrunk;
+    }
+  }
+}
+
+inline void RadixChildren::Delete(RadixInner *node) {
+  switch (node->kind_) {
+    case RadixKind::kNode4:
+      delete static_cast<RadixNode4 *>(node);
+      break;
+    case RadixKind::kNode16:
+      delete static_cast<RadixNode16 *>(node);
+      break;
+    case RadixKind::kNode48:
+      delete static_cast<RadixNode48 *>(node);
+      break;
+    case RadixKind::kNode256:
+      delete static_cast<RadixNode256 *>(node);
+      break;
+    default:
+      break;
+  }
+}
+
+template <typename Small>
+void RadixChildren::InsertSorted(Small *node, unsigned char byte,
+                                 RadixNode *child) {
+  uint16_t pos = 0;
+  while (pos < node->count_ && node->keys_[pos] < byte) {
+    ++pos;
+  }
+  for (uint16_t i = node->count_; i > pos; --i) {
+    node->keys_[i] = node->keys_[i - 1];
+    node->children_[i] = node->children_[i - 1];
+  }
+  node->keys_[pos] = byte;
+  node->children_[pos] = child;
+  ++node->count_;
+}
+
+template <typename Small>
+void RadixChildren::EraseSorted(Small *node, unsigned char byte) {
+  uint16_t pos = 0;
+  while (pos < node->count_ && node->keys_[pos] != byte) {
+    ++pos;
+  }
+  for (uint16_t i = pos; i + 1 < node->count_; ++i) {
+    node->keys_[i] = node->keys_[i + 1];
+    node->children_[i] = node->children_[i + 1];
+  }
+  --node->count_;
+  node->keys_[node->count_] = 0;
+  node->children_[node->count_] = nullptr;
+}
+
+inline void RadixChildren::CopyHeader(RadixInner *to, const RadixInner *from) {
+  to->prefix_len_ = from->prefix_len_;
+  std::memcpy(to->prefix_, from->prefix_, RadixInner::kMaxPrefix);
+  to->terminal_ = from->terminal_;
+}
+
+// child absorbs parent's path and the byte leading to it
+inline void RadixChildren::MergePrefix(const RadixInner *parent,
+                                       unsigned char byte, RadixInner *child) {
+  unsigned char merged[RadixInner::kMaxPrefix];
+  uint32_t size = 0;
+  for (uint32_t i = 0;
+       i < parent->prefix_len_ && size < RadixInner::kMaxPrefix; ++i) {
+    merged[size++] = parent->prefix_[i];
+  }
+  if (size < RadixInner::kMaxPrefix) {
+    merged[size++] = byte;
+  }
+  for (uint32_t i = 0;
+       i < child->prefix_len_ && size < RadixInner::kMaxPrefix; ++i) {
+    merged[size++] = child->prefix_[i];
+  }
+  std::memcpy(child->prefix_, merged, size);
+  child->prefix_len_ += parent->prefix_len_ + 1;
+}
+
+inline RadixInner *RadixChildren::Grow(RadixInner *node) {
+  RadixInner *grown = nullptr;
+  if (node->kind_ == RadixKind::kNode4) {
+    RadixNode4 *small = static_cast<RadixNode4 *>(node);
+    RadixNode16 *bigger = new RadixNode16();
+    std::memcpy(bigger->keys_, small->keys_, small->count_);
+    std::memcpy(bigger->children_, small->children_,
+                small->count_ * sizeof(RadixNode *));
+    grown = bigger;
+  } else if (node->kind_ == RadixKind::kNode16) {
+    RadixNode16 *small = static_cast<RadixNode16 *>(node);
+    RadixNode48 *bigger = new RadixNode48();
+    for (uint16_t i = 0; i < small->count_; ++i) {
+      bigger->index_[small->keys_[i]] = static_cast<unsigned char>(i + 1);
+      bigger->children_[i] = small->children_[i];
+    }
+    grown = bigger;
+  } else {
+    RadixNode48 *wide = static_cast<RadixNode48 *>(node);
+    RadixNode256 *bigger = new RadixNode256();
+    for (unsigned byte = 0; byte < 256; ++byte) {
+      if (wide->index_[byte] != 0) {
+        bigger->children_[byte] = wide->children_[wide->index_[byte] - 1];
+      }
+    }
+    grown = bigger;
+  }
+  CopyHeader(grown, node);
+  grown->count_ = node->count_;
+  Delete(node);
+  return grown;
+}
+
+// Shrinks with some hysteresis so that a node hovering around a class
+// boundary does not reallocate on every insert/erase pair
+inline RadixInner *RadixChildren::Shrink(RadixInner *node) {
+  RadixInner *shrunk = nullptr;
+  if (node->kind_ == RadixKind::kNode256 && node->count_ <= 37) {
+    RadixNode256 *wide = static_cast<RadixNode256 *>(node);
+    RadixNode48 *smaller = new RadixNode48();
+    uint16_t slot = 0;
+    for (unsigned byte = 0; byte < 256; ++byte) {
+      if (wide->children_[byte] != nullptr) {
+        smaller->children_[slot] = wide->children_[byte];
+        smaller->index_[byte] = static_cast<unsigned char>(++slot);
+      }
+    }
+    shrunk = smaller;
+  } else if (node->kind_ == RadixKind::kNode48 && node->count_ <= 12) {
+    RadixNode16 *smaller = new RadixNode16();
+    uint16_t pos = 0;
+    ForEach(node, [&](unsigned char byte, RadixNode *child) {
+      smaller->keys_[pos] = byte;
+      smaller->children_[pos] = child;
+      ++pos;
+    });
+    shrunk = smaller;
+  } else if (node->kind_ == RadixKind::kNode16 && node->count_ <= 3) {
+    RadixNode16 *small = static_cast<RadixNode16 *>(node);
+    RadixNode4 *smaller = new RadixNode4();
+    std::memcpy(smaller->keys_, small->keys_, small->count_);
+    std::memcpy(smaller->children_, small->children_,
+                small->count_ * sizeof(RadixNode *));
+    shrunk = smaller;
+  } else {
+    return node;
+  }
+  CopyHeader(shrunk, node);
+  shrunk->count_ = node->count_;
+  Delete(node);
+  return shrunk;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_RADIX_NODE_H_
@@ -0,0 +1,746 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_RADIX_MAP_RADIX_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_RADIX_MAP_RADIX_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "RadixKey.h"
+#include "RadixNode.h"
+
+namespace s21 {
+
+template <typename Value, bool IsConst>
+class RadixMapIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = Value;
+  using pointer = std::conditional_t<IsConst, const Value *, Value *>;
+  using reference = std::conditional_t<IsConst, const Value &, Value &>;
+
+ public:
+  RadixMapIterator() = default;
+  explicit RadixMapIterator(RadixListLink *link) : link_(link){};
+  // iterator converts to const_iterator
+  template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+  RadixMapIterator(const RadixMapIterator<Value, WasConst> &other)
+      : link_(other.link_){};
+
+ public:
+  reference operator*() const;
+  pointer operator->() const;
+
+  RadixMapIterator &operator++();
+  RadixMapIterator &operator--();
+  RadixMapIterator operator++(int);
+  RadixMapIterator operator--(int);
+
+  bool operator==(const RadixMapIterator &other) const;
+  bool operator!=(const RadixMapIterator &other) const;
+
+ private:
+  template <typename, bool>
+  friend class RadixMapIterator;
+
+  RadixListLink *link_ = nullptr;
+};
+
+// Ordered map over an adaptive radix tree: a lookup walks one node per key
+// byte (fewer with path compression) whatever the number of keys, and never
+// compares whole keys except once at the leaf. Inner nodes come in four
+// sizes (4/16/48/256 children) and are resized as children come and go.
+// Keys are std::string or integers; others can be indexed by supplying
+// Traits::Encode returning the RadixKey bytes, which must be ordered like
+// the keys themselves.
+template <typename Key, typename T, typename Traits = RadixKeyTraits<Key>>
+class radix_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = RadixMapIterator<value_type, false>;
+  using const_iterator = RadixMapIterator<value_type, true>;
+  using size_type = size_t;
+
+ public:
+  radix_map();
+  radix_map(std::initializer_list<value_type> const &items);
+  radix_map(const radix_map &other);
+  radix_map(radix_map &&other) noexcept;
+  ~radix_map();
+
+  radix_map &operator=(const radix_map &other);
+  radix_map &operator=(radix_map &&other) noexcept;
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+ public:
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(radix_map &other);
+
+ public:
+  iterator find(const Key &key);
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+  // Every key whose encoding starts with the encoding of prefix, i.e. the
+  // plain string prefix for string keys
+  std::pair<iterator, iterator> prefix_range(const Key &prefix);
+
+ private:
+  using Leaf = RadixLeaf<value_type>;
+
+  enum class Bound {
+    kNotLess,     // first key >= probe
+    kGreater,     // first key > probe
+    kPastPrefix,  // first key > probe not starting with probe
+  };
+
+  RadixNode *root_;
+  RadixListLink *head_;  // sentinel of the circular leaf list
+  size_type size_;
+
+  static RadixKey KeyOf(const Leaf *leaf) {
+    return Traits::Encode(leaf->data_.first);
+  }
+  static Leaf *AsLeaf(RadixNode *node) { return static_cast<Leaf *>(node); }
+  static Leaf *MinLeaf(RadixNode *node);
+
+  static size_t PrefixMismatch(const RadixInner *node, const RadixKey &key,
+                               size_t depth);
+  static unsigned char PrefixByte(const RadixInner *node, size_t depth,
+                                  size_t pos);
+  static RadixNode4 *SplitPrefix(RadixInner *node, size_t depth,
+                                 size_t mismatch);
+  static void PlaceUnder(RadixNode4 *node, RadixNode *child,
+                         const RadixKey &key, size_t depth);
+
+  Leaf *FindLeaf(const RadixKey &key) const;
+  Leaf *BoundLeaf(RadixNode *node, const RadixKey &key, size_t depth,
+                  Bound bound) const;
+  std::pair<Leaf *, bool> InsertLeaf(const value_type &value);
+  Leaf *EraseLeaf(RadixNode **slot, const RadixKey &key, size_t depth);
+
+  iterator MakeIterator(Leaf *leaf);
+  void LinkBefore(Leaf *leaf, RadixListLink *next);
+  void FreeTree(RadixNode *node);
+};
+
+//////////////////////////////////////////////////////
+
+// For RadixMapIterator
+template <typename Value, bool IsConst>
+typename RadixMapIterator<Value, IsConst>::reference
+RadixMapIterator<Value, IsConst>::operator*() const {
+  return static_cast<RadixLeaf<Value> *>(link_)->data_;
+}
+
+template <typename Value, bool IsConst>
+typename RadixMapIterator<Value, IsConst>::pointer
+RadixMapIterator<Value, IsConst>::operator->() const {
+  return &static_cast<RadixLeaf<Value> *>(link_)->data_;
+}
+
+template <typename Value, bool IsConst>
+RadixMapIterator<Value, IsConst>
+    &RadixMapIterator<Value, IsConst>::operator++() {
+  link_ = link_->next_;
+  return *this;
+}
+
+template <typename Value, bool IsConst>
+RadixMapIterator<Value, IsConst>
+    &RadixMapIterator<Value, IsConst>::operator--() {
+  link_ = link_->prev_;
+  return *this;
+}
+
+template <typename Value, bool IsConst>
+RadixMapIterator<Value, IsConst> RadixMapIterator<Value, IsConst>::operator++(
+    int) {
+  RadixMapIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Value, bool IsConst>
+RadixMapIterator<Value, IsConst> RadixMapIterator<Value, IsConst>::operator--(
+    int) {
+  RadixMapIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Value, bool IsConst>
+bool RadixMapIterator<Value, IsConst>::operator==(
+    const RadixMapIterator &other) const {
+  return link_ == other.link_;
+}
+
+template <typename Value, bool IsConst>
+bool RadixMapIterator<Value, IsConst>::operator!=(
+    const RadixMapIterator &other) const {
+  return link_ != other.link_;
+}
+
+//////////////////////////////////////////////////////
+
+// For radix_map
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits>::radix_map()
+    : root_(nullptr), head_(new RadixListLink()), size_(0) {}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits>::radix_map(
+    std::initializer_list<value_type> const &items)
+    : radix_map() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits>::radix_map(const radix_map &other) : radix_map() {
+  for (const auto &item : other) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits>::radix_map(radix_map &&other) noexcept
+    : root_(other.root_), head_(other.head_), size_(other.size_) {
+  other.root_ = nullptr;
+  other.head_ = new RadixListLink();
+  other.size_ = 0;
+}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits>::~radix_map() {
+  FreeTree(root_);
+  delete head_;
+}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits> &radix_map<Key, T, Traits>::operator=(
+    const radix_map &other) {
+  if (this != &other) {
+    radix_map copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Traits>
+radix_map<Key, T, Traits> &radix_map<Key, T, Traits>::operator=(
+    radix_map &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Traits>
+T &radix_map<Key, T, Traits>::at(const Key &key) {
+  Leaf *leaf = FindLeaf(Traits::Encode(key));
+  if (leaf == nullptr) {
+    throw std::out_of_range("Key not found");
+  }
+  return leaf->data_.second;
+}
+
+template <typename Key, typename T, typename Traits>
+T &radix_map<Key, T, Traits>::operator[](const Key &key) {
+  return InsertLeaf(value_type(key, T())).first->data_.second;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator
+radix_map<Key, T, Traits>::begin() {
+  return iterator(head_->next_);
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator radix_map<Key, T, Traits>::end() {
+  return iterator(head_);
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::const_iterator
+radix_map<Key, T, Traits>::begin() const {
+  return const_iterator(head_->next_);
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::const_iterator
+radix_map<Key, T, Traits>::end() const {
+  return const_iterator(head_);
+}
+
+template <typename Key, typename T, typename Traits>
+bool radix_map<Key, T, Traits>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::size_type radix_map<Key, T, Traits>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::size_type
+radix_map<Key, T, Traits>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Leaf);
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::clear() {
+  FreeTree(root_);
+  root_ = nullptr;
+  head_->prev_ = head_;
+  head_->next_ = head_;
+  size_ = 0;
+}
+
+template <typename Key, typename T, typename Traits>
+std::pair<typename radix_map<Key, T, Traits>::iterator, bool>
+radix_map<Key, T, Traits>::insert(const value_type &value) {
+  std::pair<Leaf *, bool> inserted = InsertLeaf(value);
+  return {MakeIterator(inserted.first), inserted.second};
+}
+
+template <typename Key, typename T, typename Traits>
+std::pair<typename radix_map<Key, T, Traits>::iterator, bool>
+radix_map<Key, T, Traits>::insert(const Key &key, const T &obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Traits>
+std::pair<typename radix_map<Key, T, Traits>::iterator, bool>
+radix_map<Key, T, Traits>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<Leaf *, bool> inserted = InsertLeaf(value_type(key, obj));
+  if (!inserted.second) {
+    inserted.first->data_.second = obj;
+  }
+  return {MakeIterator(inserted.first), inserted.second};
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::erase(iterator pos) {
+  erase(pos->first);
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::size_type radix_map<Key, T, Traits>::erase(
+    const Key &key) {
+  Leaf *leaf = EraseLeaf(&root_, Traits::Encode(key), 0);
+  if (leaf == nullptr) {
+    return 0;
+  }
+  leaf->prev_->next_ = leaf->next_;
+  leaf->next_->prev_ = leaf->prev_;
+  delete leaf;
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::swap(radix_map &other) {
+  std::swap(root_, other.root_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator radix_map<Key, T, Traits>::find(
+    const Key &key) {
+  return MakeIterator(FindLeaf(Traits::Encode(key)));
+}
+
+template <typename Key, typename T, typename Traits>
+bool radix_map<Key, T, Traits>::contains(const Key &key) const {
+  return FindLeaf(Traits::Encode(key)) != nullptr;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::size_type radix_map<Key, T, Traits>::count(
+    const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator
+radix_map<Key, T, Traits>::lower_bound(const Key &key) {
+  return MakeIterator(
+      BoundLeaf(root_, Traits::Encode(key), 0, Bound::kNotLess));
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator
+radix_map<Key, T, Traits>::upper_bound(const Key &key) {
+  return MakeIterator(
+      BoundLeaf(root_, Traits::Encode(key), 0, Bound::kGreater));
+}
+
+template <typename Key, typename T, typename Traits>
+std::pair<typename radix_map<Key, T, Traits>::iterator,
+          typename radix_map<Key, T, Traits>::iterator>
+radix_map<Key, T, Traits>::prefix_range(const Key &prefix) {
+  RadixKey bytes = Traits::Encode(prefix);
+  return {MakeIterator(BoundLeaf(root_, bytes, 0, Bound::kNotLess)),
+          MakeIterator(BoundLeaf(root_, bytes, 0, Bound::kPastPrefix))};
+}
+
+////////////////////////////////////////////////////////
+// For private
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::Leaf *radix_map<Key, T, Traits>::MinLeaf(
+    RadixNode *node) {
+  while (node->kind_ != RadixKind::kLeaf) {
+    RadixInner *inner = static_cast<RadixInner *>(node);
+    if (inner->terminal_ != nullptr) {
+      return AsLeaf(inner->terminal_);
+    }
+    unsigned char byte = 0;
+    node = RadixChildren::First(inner, &byte);
+  }
+  return AsLeaf(node);
+}
+
+// Length of the part of node's compressed path matching key from depth;
+// equals prefix_len_ only on a full match
+template <typename Key, typename T, typename Traits>
+size_t radix_map<Key, T, Traits>::PrefixMismatch(const RadixInner *node,
+                                                 const RadixKey &key,
+                                                 size_t depth) {
+  size_t limit = key.size() - depth;
+  if (limit > node->prefix_len_) {
+    limit = node->prefix_len_;
+  }
+  size_t stored = node->prefix_len_ < RadixInner::kMaxPrefix
+                      ? node->prefix_len_
+                      : RadixInner::kMaxPrefix;
+  size_t pos = 0;
+  for (; pos < limit && pos < stored; ++pos) {
+    if (node->prefix_[pos] != key[depth + pos]) {
+      return pos;
+    }
+  }
+  if (pos < limit) {
+    RadixKey full = KeyOf(MinLeaf(const_cast<RadixInner *>(node)));
+    for (; pos < limit; ++pos) {
+      if (full[depth + pos] != key[depth + pos]) {
+        return pos;
+      }
+    }
+  }
+  return limit;
+}
+
+template <typename Key, typename T, typename Traits>
+unsigned char radix_map<Key, T, Traits>::PrefixByte(const RadixInner *node,
+                                                    size_t depth, size_t pos) {
+  if (pos < RadixInner::kMaxPrefix) {
+    return node->prefix_[pos];
+  }
+  return KeyOf(MinLeaf(const_cast<RadixInner *>(node)))[depth + pos];
+}
+
+// Cuts node's path at mismatch: returns a new parent holding the matched
+// part, with node hanging below it under the first differing byte
+template <typename Key, typename T, typename Traits>
+RadixNode4 *radix_map<Key, T, Traits>::SplitPrefix(RadixInner *node,
+                                                   size_t depth,
+                                                   size_t mismatch) {
+  RadixNode4 *parent = new RadixNode4();
+  parent->prefix_len_ = static_cast<uint32_t>(mismatch);
+  std::memcpy(parent->prefix_, node->prefix_,
+              mismatch < RadixInner::kMaxPrefix ? mismatch
+                                                : RadixInner::kMaxPrefix);
+
+  unsigned char byte = 0;
+  uint32_t rest = node->prefix_len_ - static_cast<uint32_t>(mismatch) - 1;
+  uint32_t stored = rest < RadixInner::kMaxPrefix ? rest
+                                                  : RadixInner::kMaxPrefix;
+  if (node->prefix_len_ <= RadixInner::kMaxPrefix) {
+    byte = node->prefix_[mismatch];
+    std::memmove(node->prefix_, node->prefix_ + mismatch + 1, stored);
+  } else {
+    RadixKey full = KeyOf(MinLeaf(node));
+    byte = full[depth + mismatch];
+    for (uint32_t i = 0; i < stored; ++i) {
+      node->prefix_[i] = full[depth + mismatch + 1 + i];
+    }
+  }
+  node->prefix_len_ = rest;
+
+  RadixNode *slot = parent;
+  RadixChildren::Add(&slot, byte, node);
+  return parent;
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::PlaceUnder(RadixNode4 *node,
+                                           RadixNode *child,
+                                           const RadixKey &key, size_t depth) {
+  if (key.size() == depth) {
+    node->terminal_ = child;
+  } else {
+    RadixNode *slot = node;
+    RadixChildren::Add(&slot, key[depth], child);
+  }
+}
+
+// Skips compressed paths without reading them; the single key comparison
+// at the leaf catches any mismatch inside them
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::Leaf *radix_map<Key, T, Traits>::FindLeaf(
+    const RadixKey &key) const {
+  RadixNode *node = root_;
+  size_t depth = 0;
+  while (node != nullptr) {
+    if (node->kind_ == RadixKind::kLeaf) {
+      Leaf *leaf = AsLeaf(node);
+      return RadixKey::Compare(KeyOf(leaf), key) == 0 ? leaf : nullptr;
+    }
+    RadixInner *inner = static_cast<RadixInner *>(node);
+    depth += inner->prefix_len_;
+    if (depth > key.size()) {
+      return nullptr;
+    }
+    if (depth == key.size()) {
+      node = inner->terminal_;
+      continue;
+    }
+    RadixNode **child = RadixChildren::Find(inner, key[depth]);
+    node = child != nullptr ? *child : nullptr;
+    ++depth;
+  }
+  return nullptr;
+}
+
+// First leaf of the subtree at node satisfying bound, or nullptr if every
+// key there is on the wrong side of key
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::Leaf *radix_map<Key, T, Traits>::BoundLeaf(
+    RadixNode *node, const RadixKey &key, size_t depth, Bound bound) const {
+  if (node == nullptr) {
+    return nullptr;
+  }
+  if (node->kind_ == RadixKind::kLeaf) {
+    Leaf *leaf = AsLeaf(node);
+    RadixKey leaf_key = KeyOf(leaf);
+    int order = RadixKey::Compare(leaf_key, key);
+    bool fits = bound == Bound::kNotLess ? order >= 0 : order > 0;
+    if (bound == Bound::kPastPrefix && RadixKey::HasPrefix(leaf_key, key)) {
+      fits = false;
+    }
+    return fits ? leaf : nullptr;
+  }
+
+  RadixInner *inner = static_cast<RadixInner *>(node);
+  size_t mismatch = PrefixMismatch(inner, key, depth);
+  if (mismatch < inner->prefix_len_) {
+    if (depth + mismatch == key.size()) {
+      // key ends inside the path: the whole subtree extends key
+      return bound == Bound::kPastPrefix ? nullptr : MinLeaf(node);
+    }
+    bool greater = PrefixByte(inner, depth, mismatch) > key[depth + mismatch];
+    return greater ? MinLeaf(node) : nullptr;
+  }
+  depth += inner->prefix_len_;
+
+  unsigned char byte = 0;
+  if (depth == key.size()) {
+    if (bound == Bound::kPastPrefix) {
+      return nullptr;
+    }
+    if (bound == Bound::kNotLess && inner->terminal_ != nullptr) {
+      return AsLeaf(inner->terminal_);
+    }
+    RadixNode *first = RadixChildren::First(inner, &byte);
+    return first != nullptr ? MinLeaf(first) : nullptr;
+  }
+
+  // The terminal leaf, if any, is a proper prefix of key and orders first
+  byte = key[depth];
+  RadixNode **child = RadixChildren::Find(inner, byte);
+  if (child != nullptr) {
+    Leaf *found = BoundLeaf(*child, key, depth + 1, bound);
+    if (found != nullptr) {
+      return found;
+    }
+  }
+  RadixNode *next = RadixChildren::After(inner, byte);
+  return next != nullptr ? MinLeaf(next) : nullptr;
+}
+
+template <typename Key, typename T, typename Traits>
+std::pair<typename radix_map<Key, T, Traits>::Leaf *, bool>
+radix_map<Key, T, Traits>::InsertLeaf(const value_type &value) {
+  RadixKey key = Traits::Encode(value.first);
+  RadixNode **slot = &root_;
+  size_t depth = 0;
+  Leaf *leaf = nullptr;
+
+  while (leaf == nullptr) {
+    RadixNode *node = *slot;
+    if (node == nullptr) {
+      leaf = new Leaf(value);
+      *slot = leaf;
+    } else if (node->kind_ == RadixKind::kLeaf) {
+      // Two keys meet: a Node4 takes their common bytes as its path
+      Leaf *existing = AsLeaf(node);
+      RadixKey existing_key = KeyOf(existing);
+      if (RadixKey::Compare(existing_key, key) == 0) {
+        return {existing, false};
+      }
+      size_t common = RadixKey::CommonPrefix(existing_key, key, depth);
+      leaf = new Leaf(value);
+      RadixNode4 *parent = new RadixNode4();
+      parent->prefix_len_ = static_cast<uint32_t>(common);
+      for (size_t i = 0; i < common && i < RadixInner::kMaxPrefix; ++i) {
+        parent->prefix_[i] = key[depth + i];
+      }
+      PlaceUnder(parent, existing, existing_key, depth + common);
+      PlaceUnder(parent, leaf, key, depth + common);
+      *slot = parent;
+    } else {
+      RadixInner *inner = static_cast<RadixInner *>(node);
+      size_t mismatch = PrefixMismatch(inner, key, depth);
+      if (mismatch < inner->prefix_len_) {
+        leaf = new Leaf(value);
+        RadixNode4 *parent = SplitPrefix(inner, depth, mismatch);
+        PlaceUnder(parent, leaf, key, depth + mismatch);
+        *slot = parent;
+        break;
+      }
+      depth += inner->prefix_len_;
+      if (depth == key.size()) {
+        if (inner->terminal_ != nullptr) {
+          return {AsLeaf(inner->terminal_), false};
+        }
+        leaf = new Leaf(value);
+        inner->terminal_ = leaf;
+        break;
+      }
+      RadixNode **child = RadixChildren::Find(inner, key[depth]);
+      if (child == nullptr) {
+        leaf = new Leaf(value);
+        RadixChildren::Add(slot, key[depth], leaf);
+        break;
+      }
+      slot = child;
+      ++depth;
+    }
+  }
+
+  Leaf *next = BoundLeaf(root_, key, 0, Bound::kGreater);
+  LinkBefore(leaf, next != nullptr ? next : head_);
+  ++size_;
+  return {leaf, true};
+}
+
+// Unhooks the leaf holding key from the tree, compacting the nodes on the
+// way back up; the caller unlinks and frees it
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::Leaf *radix_map<Key, T, Traits>::EraseLeaf(
+    RadixNode **slot, const RadixKey &key, size_t depth) {
+  RadixNode *node = *slot;
+  if (node == nullptr) {
+    return nullptr;
+  }
+  if (node->kind_ == RadixKind::kLeaf) {
+    Leaf *leaf = AsLeaf(node);
+    if (RadixKey::Compare(KeyOf(leaf), key) != 0) {
+      return nullptr;
+    }
+    *slot = nullptr;
+    return leaf;
+  }
+
+  RadixInner *inner = static_cast<RadixInner *>(node);
+  depth += inner->prefix_len_;
+  if (depth > key.size()) {
+    return nullptr;
+  }
+  if (depth == key.size()) {
+    if (inner->terminal_ == nullptr ||
+        RadixKey::Compare(KeyOf(AsLeaf(inner->terminal_)), key) != 0) {
+      return nullptr;
+    }
+    Leaf *leaf = AsLeaf(inner->terminal_);
+    inner->terminal_ = nullptr;
+    RadixChildren::Compact(slot);
+    return leaf;
+  }
+
+  unsigned char byte = key[depth];
+  RadixNode **child = RadixChildren::Find(inner, byte);
+  if (child == nullptr) {
+    return nullptr;
+  }
+  Leaf *leaf = EraseLeaf(child, key, depth + 1);
+  if (leaf != nullptr && *child == nullptr) {
+    RadixChildren::Remove(slot, byte);
+  }
+  return leaf;
+}
+
+template <typename Key, typename T, typename Traits>
+typename radix_map<Key, T, Traits>::iterator
+radix_map<Key, T, Traits>::MakeIterator(Leaf *leaf) {
+  return leaf != nullptr ? iterator(leaf) : end();
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::LinkBefore(Leaf *leaf, RadixListLink *next) {
+  leaf->next_ = next;
+  leaf->prev_ = next->prev_;
+  next->prev_->next_ = leaf;
+  next->prev_ = leaf;
+}
+
+template <typename Key, typename T, typename Traits>
+void radix_map<Key, T, Traits>::FreeTree(RadixNode *node) {
+  if (node == nullptr) {
+    return;
+  }
+  if (node->kind_ == RadixKind::kLeaf) {
+    delete AsLeaf(node);
+    return;
+  }
+  RadixInner *inner = static_cast<RadixInner *>(node);
+  RadixChildren::ForEach(
+      inner, [this](unsigned char, RadixNode *child) { FreeTree(child); });
+  FreeTree(inner->terminal_);
+  RadixChildren::Delete(inner);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_RADIX_MAP_RADIX_MAP_H_
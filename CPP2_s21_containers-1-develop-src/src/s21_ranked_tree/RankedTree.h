@@ -0,0 +1,432 @@
+#ifndef CPP2_S21_CONTAINERS_1_RANKED_TREE_H_
+#define CPP2_S21_CONTAINERS_1_RANKED_TREE_H_
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <utility>
+
+#include "../s21_red_black_tree/NodePool.h"
+#include "../s21_red_black_tree/RedBlackTree.h"
+
+namespace s21 {
+
+template <typename T>
+struct RankedNode {
+  T data_;
+  RankedNode *left_ = nullptr;
+  RankedNode *right_ = nullptr;
+  int height_ = 1;
+  // Number of nodes in the subtree rooted here
+  size_t size_ = 1;
+
+  explicit RankedNode(const T &data) : data_(data){};
+};
+
+// Order-statistic AVL tree of unique values behind scored_set. Every node
+// counts its subtree, so a value's position (Rank) and the value at a
+// position (Select) are both found in O(log n), and a run of m positions is
+// visited in O(log n + m). The counts are updated by the same bottom-up pass
+// that fixes the heights; the recursion is at most 1.44 log2(n) deep. Nodes
+// come from a NodePool, as in RedBlackTree. There are no iterators: the
+// values are reached by position.
+template <typename T, typename Compare = std::less<T>>
+class RankedTree {
+ public:
+  using node_type = RankedNode<T>;
+
+ public:
+  RankedTree() = default;
+  explicit RankedTree(const Compare &comp) : comp_(comp){};
+  RankedTree(const RankedTree &other);
+  RankedTree(RankedTree &&other) noexcept;
+  ~RankedTree();
+
+  RankedTree &operator=(const RankedTree &other);
+  RankedTree &operator=(RankedTree &&other) noexcept;
+
+  size_t GetSize() const { return Size(root_); }
+
+  void Clear();
+  // Both return whether the tree changed
+  bool Insert(const T &value);
+  bool Erase(const T &value);
+  void Swap(RankedTree &other) noexcept;
+
+  // Number of values pred holds for; pred must hold for a prefix of the
+  // values in order, as [&](const T &v) { return comp(v, key); } does
+  template <typename Pred>
+  size_t PartitionPoint(Pred pred) const;
+  // Number of values less than value, whether or not it is present
+  size_t Rank(const T &value) const;
+  // The value at position rank, which must be less than GetSize()
+  const T &Select(size_t rank) const;
+  // Calls visit(value) for the values at positions [first, last) in order
+  template <typename Visit>
+  void VisitRange(size_t first, size_t last, Visit visit) const;
+
+  // black_height stays 0: the tree has no colors
+  TreeStats GetStats() const;
+  bool Validate() const;
+
+ private:
+  node_type *root_ = nullptr;
+  NodePool<node_type> pool_;
+  Compare comp_;
+
+  static size_t Size(const node_type *node) {
+    return node != nullptr ? node->size_ : 0;
+  }
+  static int Height(const node_type *node) {
+    return node != nullptr ? node->height_ : 0;
+  }
+  static void Update(node_type *node);
+  static void RotateLeft(node_type *&node);
+  static void RotateRight(node_type *&node);
+  static void Rebalance(node_type *&node);
+  static node_type *DetachMin(node_type *&node);
+
+  node_type *CreateNode(const T &data);
+  void DestroyNode(node_type *node);
+  void DestroySubtree(node_type *node);
+  node_type *CopySubtree(const node_type *node);
+  bool Insert(node_type *&node, const T &value);
+  bool Erase(node_type *&node, const T &value);
+  template <typename Visit>
+  static void VisitRange(const node_type *node, size_t first, size_t last,
+                         Visit &visit);
+  // Height of the subtree, or -1 if it breaks an invariant; the values must
+  // lie strictly between low and high where those are not null
+  int ValidateSubtree(const node_type *node, const T *low,
+                      const T *high) const;
+};
+
+//////////////////////////////////////////////////////
+
+template <typename T, typename Compare>
+RankedTree<T, Compare>::RankedTree(const RankedTree &other)
+    : comp_(other.comp_) {
+  root_ = CopySubtree(other.root_);
+}
+
+template <typename T, typename Compare>
+RankedTree<T, Compare>::RankedTree(RankedTree &&other) noexcept
+    : root_(other.root_), comp_(other.comp_) {
+  pool_.Swap(other.pool_);
+  other.root_ = nullptr;
+}
+
+template <typename T, typename Compare>
+RankedTree<T, Compare>::~RankedTree() {
+  Clear();
+}
+
+template <typename T, typename Compare>
+RankedTree<T, Compare> &RankedTree<T, Compare>::operator=(
+    const RankedTree &other) {
+  if (this != &other) {
+    RankedTree copy(other);
+    Swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+RankedTree<T, Compare> &RankedTree<T, Compare>::operator=(
+    RankedTree &&other) noexcept {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::Clear() {
+  DestroySubtree(root_);
+  root_ = nullptr;
+  pool_.Clear();
+}
+
+template <typename T, typename Compare>
+bool RankedTree<T, Compare>::Insert(const T &value) {
+  return Insert(root_, value);
+}
+
+template <typename T, typename Compare>
+bool RankedTree<T, Compare>::Erase(const T &value) {
+  return Erase(root_, value);
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::Swap(RankedTree &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(comp_, other.comp_);
+  pool_.Swap(other.pool_);
+}
+
+// Every node on the path that satisfies pred puts itself and its left
+// subtree before the partition point
+template <typename T, typename Compare>
+template <typename Pred>
+size_t RankedTree<T, Compare>::PartitionPoint(Pred pred) const {
+  size_t count = 0;
+  const node_type *node = root_;
+  while (node != nullptr) {
+    if (pred(node->data_)) {
+      count += Size(node->left_) + 1;
+      node = node->right_;
+    } else {
+      node = node->left_;
+    }
+  }
+  return count;
+}
+
+template <typename T, typename Compare>
+size_t RankedTree<T, Compare>::Rank(const T &value) const {
+  return PartitionPoint(
+      [this, &value](const T &other) { return comp_(other, value); });
+}
+
+template <typename T, typename Compare>
+const T &RankedTree<T, Compare>::Select(size_t rank) const {
+  const node_type *node = root_;
+  while (rank != Size(node->left_)) {
+    if (rank < Size(node->left_)) {
+      node = node->left_;
+    } else {
+      rank -= Size(node->left_) + 1;
+      node = node->right_;
+    }
+  }
+  return node->data_;
+}
+
+template <typename T, typename Compare>
+template <typename Visit>
+void RankedTree<T, Compare>::VisitRange(size_t first, size_t last,
+                                        Visit visit) const {
+  last = std::min(last, GetSize());
+  if (first < last) {
+    VisitRange(root_, first, last, visit);
+  }
+}
+
+template <typename T, typename Compare>
+TreeStats RankedTree<T, Compare>::GetStats() const {
+  TreeStats stats;
+  stats.height = static_cast<size_t>(Height(root_));
+  stats.node_count = GetSize();
+  stats.bytes_used = pool_.Capacity() * sizeof(node_type);
+  return stats;
+}
+
+template <typename T, typename Compare>
+bool RankedTree<T, Compare>::Validate() const {
+  return ValidateSubtree(root_, nullptr, nullptr) >= 0;
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::Update(node_type *node) {
+  node->height_ = std::max(Height(node->left_), Height(node->right_)) + 1;
+  node->size_ = Size(node->left_) + Size(node->right_) + 1;
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::RotateLeft(node_type *&node) {
+  node_type *right = node->right_;
+  node->right_ = right->left_;
+  right->left_ = node;
+  Update(node);
+  Update(right);
+  node = right;
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::RotateRight(node_type *&node) {
+  node_type *left = node->left_;
+  node->left_ = left->right_;
+  left->right_ = node;
+  Update(node);
+  Update(left);
+  node = left;
+}
+
+// Restores the balance of a node whose subtrees differ in height by at most
+// two, and refreshes its height and size either way
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::Rebalance(node_type *&node) {
+  int balance = Height(node->left_) - Height(node->right_);
+  if (balance > 1) {
+    if (Height(node->left_->left_) < Height(node->left_->right_)) {
+      RotateLeft(node->left_);
+    }
+    RotateRight(node);
+  } else if (balance < -1) {
+    if (Height(node->right_->right_) < Height(node->right_->left_)) {
+      RotateRight(node->right_);
+    }
+    RotateLeft(node);
+  } else {
+    Update(node);
+  }
+}
+
+// Unlinks the smallest node of a non-empty subtree, rebalancing on the way
+// back up, and returns it
+template <typename T, typename Compare>
+typename RankedTree<T, Compare>::node_type *RankedTree<T, Compare>::DetachMin(
+    node_type *&node) {
+  if (node->left_ == nullptr) {
+    node_type *min = node;
+    node = node->right_;
+    return min;
+  }
+  node_type *min = DetachMin(node->left_);
+  Rebalance(node);
+  return min;
+}
+
+template <typename T, typename Compare>
+typename RankedTree<T, Compare>::node_type *RankedTree<T, Compare>::CreateNode(
+    const T &data) {
+  void *slot = pool_.Allocate();
+  try {
+    return new (slot) node_type(data);
+  } catch (...) {
+    pool_.Deallocate(slot);
+    throw;
+  }
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::DestroyNode(node_type *node) {
+  node->~node_type();
+  pool_.Deallocate(node);
+}
+
+template <typename T, typename Compare>
+void RankedTree<T, Compare>::DestroySubtree(node_type *node) {
+  while (node != nullptr) {
+    DestroySubtree(node->left_);
+    node_type *right = node->right_;
+    DestroyNode(node);
+    node = right;
+  }
+}
+
+// A copy keeps the shape of the source, so the heights and sizes carry over
+template <typename T, typename Compare>
+typename RankedTree<T, Compare>::node_type *
+RankedTree<T, Compare>::CopySubtree(const node_type *node) {
+  if (node == nullptr) {
+    return nullptr;
+  }
+  node_type *copy = CreateNode(node->data_);
+  try {
+    copy->left_ = CopySubtree(node->left_);
+    copy->right_ = CopySubtree(node->right_);
+  } catch (...) {
+    DestroySubtree(copy);
+    throw;
+  }
+  copy->height_ = node->height_;
+  copy->size_ = node->size_;
+  return copy;
+}
+
+template <typename T, typename Compare>
+bool RankedTree<T, Compare>::Insert(node_type *&node, const T &value) {
+  if (node == nullptr) {
+    node = CreateNode(value);
+    return true;
+  }
+  bool inserted = false;
+  if (comp_(value, node->data_)) {
+    inserted = Insert(node->left_, value);
+  } else if (comp_(node->data_, value)) {
+    inserted = Insert(node->right_, value);
+  }
+  if (inserted) {
+    Rebalance(node);
+  }
+  return inserted;
+}
+
+// A node with two children is replaced by its successor, which is relinked
+// rather than copied, so T needs no assignment
+template <typename T, typename Compare>
+bool RankedTree<T, Compare>::Erase(node_type *&node, const T &value) {
+  if (node == nullptr) {
+    return false;
+  }
+  bool erased = true;
+  if (comp_(value, node->data_)) {
+    erased = Erase(node->left_, value);
+  } else if (comp_(node->data_, value)) {
+    erased = Erase(node->right_, value);
+  } else {
+    node_type *doomed = node;
+    if (node->left_ == nullptr) {
+      node = node->right_;
+    } else if (node->right_ == nullptr) {
+      node = node->left_;
+    } else {
+      node_type *successor = DetachMin(node->right_);
+      successor->left_ = node->left_;
+      successor->right_ = node->right_;
+      node = successor;
+    }
+    DestroyNode(doomed);
+  }
+  if (erased && node != nullptr) {
+    Rebalance(node);
+  }
+  return erased;
+}
+
+// Skips the subtrees that lie wholly outside [first, last), whose positions
+// are relative to node's subtree
+template <typename T, typename Compare>
+template <typename Visit>
+void RankedTree<T, Compare>::VisitRange(const node_type *node, size_t first,
+                                        size_t last, Visit &visit) {
+  while (node != nullptr && first < last) {
+    size_t left_size = Size(node->left_);
+    if (first < left_size) {
+      VisitRange(node->left_, first, std::min(last, left_size), visit);
+    }
+    if (first <= left_size && left_size < last) {
+      visit(node->data_);
+    }
+    first = first > left_size ? first - left_size - 1 : 0;
+    last = last > left_size ? last - left_size - 1 : 0;
+    node = node->right_;
+  }
+}
+
+template <typename T, typename Compare>
+int RankedTree<T, Compare>::ValidateSubtree(const node_type *node,
+                                            const T *low,
+                                            const T *high) const {
+  if (node == nullptr) {
+    return 0;
+  }
+  if ((low != nullptr && !comp_(*low, node->data_)) ||
+      (high != nullptr && !comp_(node->data_, *high))) {
+    return -1;
+  }
+  int left = ValidateSubtree(node->left_, low, &node->data_);
+  int right = ValidateSubtree(node->right_, &node->data_, high);
+  if (left < 0 || right < 0 || left - right > 1 || right - left > 1 ||
+      node->height_ != std::max(left, right) + 1 ||
+      node->size_ != Size(node->left_) + Size(node->right_) + 1) {
+    return -1;
+  }
+  return node->height_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_RANKED_TREE_H_
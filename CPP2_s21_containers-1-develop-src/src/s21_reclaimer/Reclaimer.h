@@ -0,0 +1,136 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_RECLAIMER_RECLAIMER_H_
+#define CPP2_S21_CONTAINERS_1_S21_RECLAIMER_RECLAIMER_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace s21 {
+
+// Work handed to the Reclaimer; Run frees whatever the job owns
+class ReclaimJob {
+ public:
+  virtual ~ReclaimJob() = default;
+  virtual void Run() = 0;
+
+ private:
+  friend class Reclaimer;
+  ReclaimJob *next_ = nullptr;
+};
+
+// Background thread behind the containers' clear_async(). Jobs run one at a
+// time in the order they were posted. The thread is started by the first
+// job, and when the program exits the jobs still queued run before it is
+// joined, so clear_async must not be called from the destructors of
+// objects with static storage duration.
+class Reclaimer {
+ public:
+  static Reclaimer &Instance();
+
+  Reclaimer(const Reclaimer &other) = delete;
+  Reclaimer &operator=(const Reclaimer &other) = delete;
+  ~Reclaimer();
+
+  // Takes ownership of job. If no thread can be started, the job runs on
+  // the calling thread instead.
+  void Post(ReclaimJob *job);
+  // Blocks until every job posted so far has run
+  void Drain();
+
+ private:
+  Reclaimer() = default;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable idle_;
+  ReclaimJob *head_ = nullptr;
+  ReclaimJob *tail_ = nullptr;
+  bool busy_ = false;
+  bool stopping_ = false;
+  std::thread thread_;
+
+  void Loop();
+  static void RunAndDelete(ReclaimJob *job);
+};
+
+//////////////////////////////////////////////////////
+
+inline Reclaimer &Reclaimer::Instance() {
+  static Reclaimer instance;
+  return instance;
+}
+
+inline Reclaimer::~Reclaimer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+inline void Reclaimer::Post(ReclaimJob *job) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!thread_.joinable()) {
+    try {
+      thread_ = std::thread(&Reclaimer::Loop, this);
+    } catch (const std::system_error &) {
+      lock.unlock();
+      RunAndDelete(job);
+      return;
+    }
+  }
+  if (tail_ != nullptr) {
+    tail_->next_ = job;
+  } else {
+    head_ = job;
+  }
+  tail_ = job;
+  lock.unlock();
+  wake_.notify_one();
+}
+
+inline void Reclaimer::Drain() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock, [this] { return head_ == nullptr && !busy_; });
+}
+
+inline void Reclaimer::Loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this] { return head_ != nullptr || stopping_; });
+    if (head_ == nullptr) {
+      return;
+    }
+    ReclaimJob *job = head_;
+    head_ = job->next_;
+    if (head_ == nullptr) {
+      tail_ = nullptr;
+    }
+    busy_ = true;
+    lock.unlock();
+    RunAndDelete(job);
+    lock.lock();
+    busy_ = false;
+    if (head_ == nullptr) {
+      idle_.notify_all();
+    }
+  }
+}
+
+// Destructors are not supposed to throw; if one does anyway, the rest of
+// that job's memory is leaked rather than taking the thread down
+inline void Reclaimer::RunAndDelete(ReclaimJob *job) {
+  try {
+    job->Run();
+  } catch (...) {
+  }
+  delete job;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_RECLAIMER_RECLAIMER_H_
@@ -0,0 +1,342 @@
+#ifndef CPP2_S21_CONTAINERS_1_BALANCE_POLICY_H_
+#define CPP2_S21_CONTAINERS_1_BALANCE_POLICY_H_
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Node.h"
+
+namespace s21 {
+
+// A balance policy owns the per-node bookkeeping (NodeBase) and restores the
+// tree shape after the structural part of an insert or removal. The tree
+// befriends its policy so the hooks can rotate and re-root it:
+//
+//   AfterInsert(tree, node)                   node is freshly linked as leaf
+//   AfterRemove(tree, x, x_parent, removed)   x took the spliced-out slot
+//                                             (possibly nil), x_parent is its
+//                                             parent, removed is the old
+//                                             bookkeeping of that slot
+//   ValidateRoot(root, nil)                   invariants of root and sentinel
+//   ValidateNode(node, left, right)           rank of a subtree from the
+//                                             ranks of its children, -1 when
+//                                             an invariant is broken
+//   BlackHeight(root, nil)                    reported through TreeStats
+//   AfterBuild(node, height, bottom)          node was linked by a bulk
+//                                             build of a size-balanced tree;
+//                                             height is that of its subtree,
+//                                             bottom is set on the last,
+//                                             incomplete level
+
+struct RedBlackBalance {
+  using NodeBase = RedBlackNodeBase;
+
+  template <typename Tree, typename NodeT>
+  static void AfterInsert(Tree &tree, NodeT *node);
+  template <typename Tree, typename NodeT>
+  static void AfterRemove(Tree &tree, NodeT *x, NodeT *x_parent,
+                          const NodeBase &removed);
+
+  template <typename NodeT>
+  static bool ValidateRoot(const NodeT *root, const NodeT *nil);
+  template <typename NodeT>
+  static int ValidateNode(const NodeT *node, int left, int right);
+  template <typename NodeT>
+  static size_t BlackHeight(const NodeT *root, const NodeT *nil);
+  template <typename NodeT>
+  static void AfterBuild(NodeT *node, size_t height, bool bottom);
+
+ private:
+  template <typename Tree, typename NodeT>
+  static void FixInsert(Tree &tree, NodeT *k);
+  template <typename Tree, typename NodeT>
+  static void FixDelete(Tree &tree, NodeT *x);
+};
+
+// Height-balanced alternative: subtrees differ in height by at most one, so
+// the tree is never deeper than ~1.44 log2(n) against ~2 log2(n) for
+// red-black, at the cost of more rotations on update-heavy workloads.
+struct AvlBalance {
+  using NodeBase = AvlNodeBase;
+
+  template <typename Tree, typename NodeT>
+  static void AfterInsert(Tree &tree, NodeT *node);
+  template <typename Tree, typename NodeT>
+  static void AfterRemove(Tree &tree, NodeT *x, NodeT *x_parent,
+                          const NodeBase &removed);
+
+  template <typename NodeT>
+  static bool ValidateRoot(const NodeT *root, const NodeT *nil);
+  template <typename NodeT>
+  static int ValidateNode(const NodeT *node, int left, int right);
+  template <typename NodeT>
+  static size_t BlackHeight(const NodeT *root, const NodeT *nil);
+  template <typename NodeT>
+  static void AfterBuild(NodeT *node, size_t height, bool bottom);
+
+ private:
+  template <typename NodeT>
+  static int Height(const NodeT *node) {
+    return node->height_;
+  }
+  template <typename NodeT>
+  static void Update(NodeT *node);
+  template <typename Tree, typename NodeT>
+  static NodeT *Rebalance(Tree &tree, NodeT *node);
+  template <typename Tree, typename NodeT>
+  static void Retrace(Tree &tree, NodeT *node);
+};
+
+//////////////////////////////////////////////////////
+
+// For RedBlackBalance
+template <typename Tree, typename NodeT>
+void RedBlackBalance::AfterInsert(Tree &tree, NodeT *node) {
+  if (node->parent_ == nullptr) {
+    node->color_ = Color::kBlack;
+    return;
+  }
+
+  if (node->parent_->parent_ == nullptr) {
+    return;
+  }
+
+  FixInsert(tree, node);
+}
+
+template <typename Tree, typename NodeT>
+void RedBlackBalance::AfterRemove(Tree &tree, NodeT *x, NodeT *,
+                                  const NodeBase &removed) {
+  if (removed.color_ == Color::kBlack) {
+    FixDelete(tree, x);
+  }
+}
+
+template <typename Tree, typename NodeT>
+void RedBlackBalance::FixInsert(Tree &tree, NodeT *k) {
+  NodeT *u;
+  while (k->parent_->color_ == Color::kRed) {
+    if (k->parent_ == k->parent_->parent_->left_) {
+      u = k->parent_->parent_->right_;
+      if (u->color_ == Color::kRed) {
+        k->parent_->color_ = Color::kBlack;
+        u->color_ = Color::kBlack;
+        k->parent_->parent_->color_ = Color::kRed;
+        k = k->parent_->parent_;
+      } else {
+        if (k == k->parent_->right_) {
+          k = k->parent_;
+          tree.RotateLeft(k);
+        }
+        k->parent_->color_ = Color::kBlack;
+        k->parent_->parent_->color_ = Color::kRed;
+        tree.RotateRight(k->parent_->parent_);
+      }
+    } else {
+      u = k->parent_->parent_->left_;
+      if (u->color_ == Color::kRed) {
+        k->parent_->color_ = Color::kBlack;
+        u->color_ = Color::kBlack;
+        k->parent_->parent_->color_ = Color::kRed;
+        k = k->parent_->parent_;
+      } else {
+        if (k == k->parent_->left_) {
+          k = k->parent_;
+          tree.RotateRight(k);
+        }
+        k->parent_->color_ = Color::kBlack;
+        k->parent_->parent_->color_ = Color::kRed;
+        tree.RotateLeft(k->parent_->parent_);
+      }
+    }
+    if (k == tree.root_) {
+      break;
+    }
+  }
+  tree.root_->color_ = Color::kBlack;
+}
+
+template <typename Tree, typename NodeT>
+void RedBlackBalance::FixDelete(Tree &tree, NodeT *x) {
+  while (x != tree.root_ && x->color_ == Color::kBlack) {
+    if (x == x->parent_->left_) {
+      NodeT *w = x->parent_->right_;
+      if (w->color_ == Color::kRed) {
+        w->color_ = Color::kBlack;
+        x->parent_->color_ = Color::kRed;
+        tree.RotateLeft(x->parent_);
+        w = x->parent_->right_;
+      }
+      if (w->left_->color_ == Color::kBlack &&
+          w->right_->color_ == Color::kBlack) {
+        w->color_ = Color::kRed;
+        x = x->parent_;
+      } else {
+        if (w->right_->color_ == Color::kBlack) {
+          w->left_->color_ = Color::kBlack;
+          w->color_ = Color::kRed;
+          tree.RotateRight(w);
+          w = x->parent_->right_;
+        }
+        w->color_ = x->parent_->color_;
+        x->parent_->color_ = Color::kBlack;
+        w->right_->color_ = Color::kBlack;
+        tree.RotateLeft(x->parent_);
+        x = tree.root_;
+      }
+    } else {
+      NodeT *w = x->parent_->left_;
+      if (w->color_ == Color::kRed) {
+        w->color_ = Color::kBlack;
+        x->parent_->color_ = Color::kRed;
+        tree.RotateRight(x->parent_);
+        w = x->parent_->left_;
+      }
+      if (w->right_->color_ == Color::kBlack &&
+          w->left_->color_ == Color::kBlack) {
+        w->color_ = Color::kRed;
+        x = x->parent_;
+      } else {
+        if (w->left_->color_ == Color::kBlack) {
+          w->right_->color_ = Color::kBlack;
+          w->color_ = Color::kRed;
+          tree.RotateLeft(w);
+          w = x->parent_->left_;
+        }
+        w->color_ = x->parent_->color_;
+        x->parent_->color_ = Color::kBlack;
+        w->left_->color_ = Color::kBlack;
+        tree.RotateRight(x->parent_);
+        x = tree.root_;
+      }
+    }
+  }
+  x->color_ = Color::kBlack;
+}
+
+template <typename NodeT>
+bool RedBlackBalance::ValidateRoot(const NodeT *root, const NodeT *nil) {
+  return nil->color_ == Color::kBlack && root->color_ == Color::kBlack;
+}
+
+// Rank of a red-black subtree is its black height
+template <typename NodeT>
+int RedBlackBalance::ValidateNode(const NodeT *node, int left, int right) {
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  if (node->color_ == Color::kRed && (node->left_->color_ == Color::kRed ||
+                                      node->right_->color_ == Color::kRed)) {
+    return -1;
+  }
+  return left + (node->color_ == Color::kBlack ? 1 : 0);
+}
+
+template <typename NodeT>
+size_t RedBlackBalance::BlackHeight(const NodeT *root, const NodeT *nil) {
+  size_t black_height = 0;
+  for (const NodeT *node = root; node != nil; node = node->left_) {
+    if (node->color_ == Color::kBlack) {
+      ++black_height;
+    }
+  }
+  return black_height;
+}
+
+// Every level above the last is complete, so colouring the nodes of the
+// incomplete last level red gives every path the same black height
+template <typename NodeT>
+void RedBlackBalance::AfterBuild(NodeT *node, size_t, bool bottom) {
+  node->color_ = bottom ? Color::kRed : Color::kBlack;
+}
+
+//////////////////////////////////////////////////////
+
+// For AvlBalance
+template <typename Tree, typename NodeT>
+void AvlBalance::AfterInsert(Tree &tree, NodeT *node) {
+  Retrace(tree, node->parent_);
+}
+
+template <typename Tree, typename NodeT>
+void AvlBalance::AfterRemove(Tree &tree, NodeT *, NodeT *x_parent,
+                             const NodeBase &) {
+  Retrace(tree, x_parent);
+}
+
+// Walks towards the root fixing heights; stops as soon as a subtree keeps
+// its previous height, since nothing above it can have changed
+template <typename Tree, typename NodeT>
+void AvlBalance::Retrace(Tree &tree, NodeT *node) {
+  while (node != nullptr) {
+    int old_height = Height(node);
+    Update(node);
+    node = Rebalance(tree, node);
+    if (Height(node) == old_height) {
+      break;
+    }
+    node = node->parent_;
+  }
+}
+
+template <typename NodeT>
+void AvlBalance::Update(NodeT *node) {
+  node->height_ = 1 + std::max(Height(node->left_), Height(node->right_));
+}
+
+// Returns the root of the subtree after the (double) rotation, if any
+template <typename Tree, typename NodeT>
+NodeT *AvlBalance::Rebalance(Tree &tree, NodeT *node) {
+  int balance = Height(node->left_) - Height(node->right_);
+  if (balance > 1) {
+    NodeT *left = node->left_;
+    if (Height(left->left_) < Height(left->right_)) {
+      tree.RotateLeft(left);
+      Update(left);
+      Update(left->parent_);
+    }
+    tree.RotateRight(node);
+  } else if (balance < -1) {
+    NodeT *right = node->right_;
+    if (Height(right->right_) < Height(right->left_)) {
+      tree.RotateRight(right);
+      Update(right);
+      Update(right->parent_);
+    }
+    tree.RotateLeft(node);
+  } else {
+    return node;
+  }
+  Update(node);
+  Update(node->parent_);
+  return node->parent_;
+}
+
+template <typename NodeT>
+bool AvlBalance::ValidateRoot(const NodeT *, const NodeT *nil) {
+  return Height(nil) == 0;
+}
+
+// Rank of an AVL subtree is its height, which must also be the cached one
+template <typename NodeT>
+int AvlBalance::ValidateNode(const NodeT *node, int left, int right) {
+  if (left < 0 || right < 0 || left - right > 1 || right - left > 1) {
+    return -1;
+  }
+  int height = 1 + std::max(left, right);
+  return Height(node) == height ? height : -1;
+}
+
+template <typename NodeT>
+size_t AvlBalance::BlackHeight(const NodeT *, const NodeT *) {
+  return 0;
+}
+
+template <typename NodeT>
+void AvlBalance::AfterBuild(NodeT *node, size_t height, bool) {
+  node->height_ = static_cast<int>(height);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_BALANCE_POLICY_H_
@@ -0,0 +1,720 @@
+#ifndef CPP2_S21_CONTAINERS_1_INDEXED_RED_BLACK_TREE_H_
+#define CPP2_S21_CONTAINERS_1_INDEXED_RED_BLACK_TREE_H_
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+#include "RedBlackTree.h"
+
+namespace s21 {
+
+// Node of an IndexedRedBlackTree. The links are positions in the tree's
+// arena instead of pointers, and position 0 is the black nil sentinel. An
+// erased slot is marked Color::kNone and chained into the free list through
+// left_.
+template <typename T>
+struct IndexedNode {
+  T data_{};
+  uint32_t parent_ = 0;
+  uint32_t left_ = 0;
+  uint32_t right_ = 0;
+  Color color_ = Color::kBlack;
+};
+
+// Holds the tree and a position rather than a node address, so growing the
+// arena does not invalidate it
+template <typename Tree>
+class IndexedTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = typename Tree::value_type;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+ public:
+  IndexedTreeIterator() = default;
+  IndexedTreeIterator(const Tree *tree, uint32_t index)
+      : tree_(tree), index_(index){};
+
+ public:
+  reference operator*() const { return tree_->NodeAt(index_).data_; }
+  pointer operator->() const { return &**this; }
+
+  IndexedTreeIterator &operator++();
+  IndexedTreeIterator &operator--();
+  IndexedTreeIterator operator++(int);
+  IndexedTreeIterator operator--(int);
+
+  bool operator==(const IndexedTreeIterator &other) const;
+  bool operator!=(const IndexedTreeIterator &other) const;
+
+ private:
+  friend Tree;
+
+  const Tree *tree_ = nullptr;
+  uint32_t index_ = 0;
+};
+
+// Red-black tree of unique keys whose nodes live in one s21::vector and
+// link to each other with 32-bit positions. For small keys a node shrinks
+// from 32 to 20 bytes, and neighbouring nodes share cache lines. Erased
+// slots are reused through a free list before the arena grows. Copying the
+// tree copies the arena in a single pass with no link fix-ups. The price is
+// a limit of 2^32 - 1 elements and iterators that are invalidated by
+// Swap() and moves, which is why only set-like trees are offered on top of
+// it (the vector also needs an assignable T, which rules out map pairs).
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
+class IndexedRedBlackTree {
+ public:
+  using value_type = T;
+  using node_type = IndexedNode<T>;
+  using index_type = uint32_t;
+  using const_iterator = IndexedTreeIterator<IndexedRedBlackTree>;
+  using iterator = const_iterator;
+
+  static constexpr index_type kNil = 0;
+  static constexpr size_t kMaxSize = std::numeric_limits<index_type>::max();
+
+ public:
+  IndexedRedBlackTree() = default;
+  explicit IndexedRedBlackTree(const Compare &comp) : comp_(comp){};
+  IndexedRedBlackTree(const IndexedRedBlackTree &other) = default;
+  IndexedRedBlackTree(IndexedRedBlackTree &&other) noexcept;
+  ~IndexedRedBlackTree() = default;
+
+  IndexedRedBlackTree &operator=(const IndexedRedBlackTree &other) = default;
+  IndexedRedBlackTree &operator=(IndexedRedBlackTree &&other) noexcept;
+
+  const_iterator begin() const { return const_iterator(this, Min(root_)); }
+  const_iterator end() const { return const_iterator(this, kNil); }
+
+  size_t GetSize() const { return size_; }
+  const Compare &GetComparator() const { return comp_; }
+
+  // Destroys the elements but keeps the arena's memory
+  void Clear();
+  // Makes room for count elements without growing the arena
+  void Reserve(size_t count);
+  std::pair<iterator, bool> Insert(const T &value);
+  void Erase(const_iterator pos);
+  template <typename K>
+  size_t Erase(const K &key);
+  void Swap(IndexedRedBlackTree &other);
+
+  template <typename K>
+  const_iterator Find(const K &key) const;
+  template <typename K>
+  const_iterator LowerBound(const K &key) const;
+  template <typename K>
+  const_iterator UpperBound(const K &key) const;
+
+  // bytes_used counts every arena slot handed out so far, free ones too
+  TreeStats GetStats() const;
+  bool Validate() const;
+
+  // Used by the iterators
+  const node_type &NodeAt(index_type index) const {
+    return nodes_.data()[index];
+  }
+  index_type Next(index_type index) const;
+  index_type Prev(index_type index) const;
+
+ private:
+  // Empty until the first insert; from then on nodes_[0] is the sentinel
+  s21::vector<node_type> nodes_;
+  index_type root_ = kNil;
+  index_type free_ = kNil;
+  size_t size_ = 0;
+  Compare comp_;
+
+  static const auto &KeyOf(const T &value) { return KeyOfValue()(value); }
+
+  node_type *Nodes() { return nodes_.data(); }
+  const node_type *Nodes() const { return nodes_.data(); }
+
+  index_type Allocate(const T &value);
+  void Release(index_type index);
+  void EraseNode(index_type z);
+
+  index_type Min(index_type index) const;
+  index_type Max(index_type index) const;
+  void RotateLeft(index_type x);
+  void RotateRight(index_type x);
+  void Transplant(index_type u, index_type v);
+  void FixInsert(index_type z);
+  void FixErase(index_type x);
+
+  size_t GetHeight(index_type index) const;
+  int ValidateSubtree(index_type index, index_type parent) const;
+};
+
+//////////////////////////////////////////////////////
+
+// For IndexedTreeIterator
+template <typename Tree>
+IndexedTreeIterator<Tree> &IndexedTreeIterator<Tree>::operator++() {
+  index_ = tree_->Next(index_);
+  return *this;
+}
+
+template <typename Tree>
+IndexedTreeIterator<Tree> &IndexedTreeIterator<Tree>::operator--() {
+  index_ = tree_->Prev(index_);
+  return *this;
+}
+
+template <typename Tree>
+IndexedTreeIterator<Tree> IndexedTreeIterator<Tree>::operator++(int) {
+  IndexedTreeIterator result = *this;
+  ++*this;
+  return result;
+}
+
+template <typename Tree>
+IndexedTreeIterator<Tree> IndexedTreeIterator<Tree>::operator--(int) {
+  IndexedTreeIterator result = *this;
+  --*this;
+  return result;
+}
+
+template <typename Tree>
+bool IndexedTreeIterator<Tree>::operator==(
+    const IndexedTreeIterator &other) const {
+  return index_ == other.index_ && tree_ == other.tree_;
+}
+
+template <typename Tree>
+bool IndexedTreeIterator<Tree>::operator!=(
+    const IndexedTreeIterator &other) const {
+  return !(*this == other);
+}
+
+// For IndexedRedBlackTree
+template <typename T, typename Compare, typename KeyOfValue>
+IndexedRedBlackTree<T, Compare, KeyOfValue>::IndexedRedBlackTree(
+    IndexedRedBlackTree &&other) noexcept
+    : nodes_(std::move(other.nodes_)),
+      root_(other.root_),
+      free_(other.free_),
+      size_(other.size_),
+      comp_(std::move(other.comp_)) {
+  other.root_ = other.free_ = kNil;
+  other.size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+IndexedRedBlackTree<T, Compare, KeyOfValue> &
+IndexedRedBlackTree<T, Compare, KeyOfValue>::operator=(
+    IndexedRedBlackTree &&other) noexcept {
+  if (this != &other) {
+    nodes_ = std::move(other.nodes_);
+    root_ = other.root_;
+    free_ = other.free_;
+    size_ = other.size_;
+    comp_ = std::move(other.comp_);
+    other.root_ = other.free_ = kNil;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Clear() {
+  nodes_.clear();
+  root_ = free_ = kNil;
+  size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Reserve(size_t count) {
+  if (count > kMaxSize) {
+    throw std::length_error("IndexedRedBlackTree::Reserve: count too large");
+  }
+  nodes_.reserve(count + 1);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+std::pair<typename IndexedRedBlackTree<T, Compare, KeyOfValue>::iterator,
+          bool>
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Insert(const T &value) {
+  index_type parent = kNil;
+  index_type current = root_;
+  bool goes_left = false;
+  while (current != kNil) {
+    parent = current;
+    const node_type &node = Nodes()[current];
+    if (comp_(KeyOf(value), KeyOf(node.data_))) {
+      goes_left = true;
+      current = node.left_;
+    } else if (comp_(KeyOf(node.data_), KeyOf(value))) {
+      goes_left = false;
+      current = node.right_;
+    } else {
+      return {iterator(this, current), false};
+    }
+  }
+  // Allocate may move the arena, so nothing above is held by reference
+  index_type z = Allocate(value);
+  node_type *n = Nodes();
+  n[z].parent_ = parent;
+  if (parent == kNil) {
+    root_ = z;
+  } else if (goes_left) {
+    n[parent].left_ = z;
+  } else {
+    n[parent].right_ = z;
+  }
+  ++size_;
+  FixInsert(z);
+  return {iterator(this, z), true};
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Erase(const_iterator pos) {
+  if (pos.index_ != kNil) {
+    EraseNode(pos.index_);
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t IndexedRedBlackTree<T, Compare, KeyOfValue>::Erase(const K &key) {
+  const_iterator pos = Find(key);
+  if (pos == end()) {
+    return 0;
+  }
+  EraseNode(pos.index_);
+  return 1;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Swap(
+    IndexedRedBlackTree &other) {
+  nodes_.swap(other.nodes_);
+  std::swap(root_, other.root_);
+  std::swap(free_, other.free_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::const_iterator
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Find(const K &key) const {
+  const_iterator pos = LowerBound(key);
+  if (pos == end() || comp_(key, KeyOf(*pos))) {
+    return end();
+  }
+  return pos;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::const_iterator
+IndexedRedBlackTree<T, Compare, KeyOfValue>::LowerBound(const K &key) const {
+  const node_type *n = Nodes();
+  index_type result = kNil;
+  index_type current = root_;
+  while (current != kNil) {
+    if (!comp_(KeyOf(n[current].data_), key)) {
+      result = current;
+      current = n[current].left_;
+    } else {
+      current = n[current].right_;
+    }
+  }
+  return const_iterator(this, result);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::const_iterator
+IndexedRedBlackTree<T, Compare, KeyOfValue>::UpperBound(const K &key) const {
+  const node_type *n = Nodes();
+  index_type result = kNil;
+  index_type current = root_;
+  while (current != kNil) {
+    if (comp_(key, KeyOf(n[current].data_))) {
+      result = current;
+      current = n[current].left_;
+    } else {
+      current = n[current].right_;
+    }
+  }
+  return const_iterator(this, result);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+TreeStats IndexedRedBlackTree<T, Compare, KeyOfValue>::GetStats() const {
+  TreeStats stats;
+  stats.height = GetHeight(root_);
+  for (index_type i = root_; i != kNil; i = Nodes()[i].left_) {
+    if (Nodes()[i].color_ == Color::kBlack) {
+      ++stats.black_height;
+    }
+  }
+  stats.node_count = size_;
+  stats.bytes_used = nodes_.size() * sizeof(node_type);
+  return stats;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+bool IndexedRedBlackTree<T, Compare, KeyOfValue>::Validate() const {
+  if (root_ == kNil) {
+    return size_ == 0;
+  }
+  const node_type *n = Nodes();
+  if (n[kNil].color_ != Color::kBlack || n[root_].color_ != Color::kBlack ||
+      n[root_].parent_ != kNil || ValidateSubtree(root_, kNil) < 0) {
+    return false;
+  }
+  size_t free_slots = 0;
+  for (index_type i = free_; i != kNil; i = n[i].left_) {
+    if (n[i].color_ != Color::kNone || ++free_slots > nodes_.size()) {
+      return false;
+    }
+  }
+  size_t count = 0;
+  for (const_iterator it = begin(), prev = begin(); it != end();
+       prev = it++) {
+    if (++count > size_ || comp_(KeyOf(*it), KeyOf(*prev))) {
+      return false;
+    }
+  }
+  return count == size_ && free_slots + size_ + 1 == nodes_.size();
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::index_type
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Next(index_type index) const {
+  if (index == kNil) {
+    return kNil;
+  }
+  const node_type *n = Nodes();
+  if (n[index].right_ != kNil) {
+    return Min(n[index].right_);
+  }
+  index_type parent = n[index].parent_;
+  while (parent != kNil && index == n[parent].right_) {
+    index = parent;
+    parent = n[parent].parent_;
+  }
+  return parent;
+}
+
+// end() steps back to the largest element
+template <typename T, typename Compare, typename KeyOfValue>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::index_type
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Prev(index_type index) const {
+  if (index == kNil) {
+    return Max(root_);
+  }
+  const node_type *n = Nodes();
+  if (n[index].left_ != kNil) {
+    return Max(n[index].left_);
+  }
+  index_type parent = n[index].parent_;
+  while (parent != kNil && index == n[parent].left_) {
+    index = parent;
+    parent = n[parent].parent_;
+  }
+  return parent;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::index_type
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Allocate(const T &value) {
+  if (nodes_.size() == 0) {
+    nodes_.push_back(node_type());
+  }
+  if (free_ != kNil) {
+    index_type index = free_;
+    node_type &node = Nodes()[index];
+    free_ = node.left_;
+    node.data_ = value;
+    node.parent_ = node.left_ = node.right_ = kNil;
+    node.color_ = Color::kRed;
+    return index;
+  }
+  if (nodes_.size() > kMaxSize) {
+    throw std::length_error("IndexedRedBlackTree: too many elements");
+  }
+  node_type node;
+  node.data_ = value;
+  node.color_ = Color::kRed;
+  nodes_.push_back(node);
+  return static_cast<index_type>(nodes_.size() - 1);
+}
+
+// The slot's value is reset so whatever it owns is freed now rather than
+// when the slot is reused
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Release(index_type index) {
+  node_type &node = Nodes()[index];
+  node.data_ = T();
+  node.color_ = Color::kNone;
+  node.parent_ = node.right_ = kNil;
+  node.left_ = free_;
+  free_ = index;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::EraseNode(index_type z) {
+  node_type *n = Nodes();
+  index_type y = z;
+  index_type x = kNil;
+  Color removed_color = n[y].color_;
+  if (n[z].left_ == kNil) {
+    x = n[z].right_;
+    Transplant(z, x);
+  } else if (n[z].right_ == kNil) {
+    x = n[z].left_;
+    Transplant(z, x);
+  } else {
+    y = Min(n[z].right_);
+    removed_color = n[y].color_;
+    x = n[y].right_;
+    if (n[y].parent_ == z) {
+      n[x].parent_ = y;
+    } else {
+      Transplant(y, x);
+      n[y].right_ = n[z].right_;
+      n[n[y].right_].parent_ = y;
+    }
+    Transplant(z, y);
+    n[y].left_ = n[z].left_;
+    n[n[y].left_].parent_ = y;
+    n[y].color_ = n[z].color_;
+  }
+  if (removed_color == Color::kBlack) {
+    FixErase(x);
+  }
+  Release(z);
+  --size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::index_type
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Min(index_type index) const {
+  if (index != kNil) {
+    while (Nodes()[index].left_ != kNil) {
+      index = Nodes()[index].left_;
+    }
+  }
+  return index;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename IndexedRedBlackTree<T, Compare, KeyOfValue>::index_type
+IndexedRedBlackTree<T, Compare, KeyOfValue>::Max(index_type index) const {
+  if (index != kNil) {
+    while (Nodes()[index].right_ != kNil) {
+      index = Nodes()[index].right_;
+    }
+  }
+  return index;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::RotateLeft(index_type x) {
+  node_type *n = Nodes();
+  index_type y = n[x].right_;
+  n[x].right_ = n[y].left_;
+  if (n[y].left_ != kNil) {
+    n[n[y].left_].parent_ = x;
+  }
+  n[y].parent_ = n[x].parent_;
+  if (n[x].parent_ == kNil) {
+    root_ = y;
+  } else if (x == n[n[x].parent_].left_) {
+    n[n[x].parent_].left_ = y;
+  } else {
+    n[n[x].parent_].right_ = y;
+  }
+  n[y].left_ = x;
+  n[x].parent_ = y;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::RotateRight(index_type x) {
+  node_type *n = Nodes();
+  index_type y = n[x].left_;
+  n[x].left_ = n[y].right_;
+  if (n[y].right_ != kNil) {
+    n[n[y].right_].parent_ = x;
+  }
+  n[y].parent_ = n[x].parent_;
+  if (n[x].parent_ == kNil) {
+    root_ = y;
+  } else if (x == n[n[x].parent_].right_) {
+    n[n[x].parent_].right_ = y;
+  } else {
+    n[n[x].parent_].left_ = y;
+  }
+  n[y].right_ = x;
+  n[x].parent_ = y;
+}
+
+// Puts v where u was. v may be the sentinel, whose parent_ then records
+// where FixErase has to start.
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::Transplant(index_type u,
+                                                             index_type v) {
+  node_type *n = Nodes();
+  index_type parent = n[u].parent_;
+  if (parent == kNil) {
+    root_ = v;
+  } else if (u == n[parent].left_) {
+    n[parent].left_ = v;
+  } else {
+    n[parent].right_ = v;
+  }
+  n[v].parent_ = parent;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::FixInsert(index_type z) {
+  node_type *n = Nodes();
+  while (n[n[z].parent_].color_ == Color::kRed) {
+    index_type parent = n[z].parent_;
+    index_type grandparent = n[parent].parent_;
+    if (parent == n[grandparent].left_) {
+      index_type uncle = n[grandparent].right_;
+      if (n[uncle].color_ == Color::kRed) {
+        n[parent].color_ = n[uncle].color_ = Color::kBlack;
+        n[grandparent].color_ = Color::kRed;
+        z = grandparent;
+        continue;
+      }
+      if (z == n[parent].right_) {
+        z = parent;
+        RotateLeft(z);
+        parent = n[z].parent_;
+      }
+      n[parent].color_ = Color::kBlack;
+      n[grandparent].color_ = Color::kRed;
+      RotateRight(grandparent);
+    } else {
+      index_type uncle = n[grandparent].left_;
+      if (n[uncle].color_ == Color::kRed) {
+        n[parent].color_ = n[uncle].color_ = Color::kBlack;
+        n[grandparent].color_ = Color::kRed;
+        z = grandparent;
+        continue;
+      }
+      if (z == n[parent].left_) {
+        z = parent;
+        RotateRight(z);
+        parent = n[z].parent_;
+      }
+      n[parent].color_ = Color::kBlack;
+      n[grandparent].color_ = Color::kRed;
+      RotateLeft(grandparent);
+    }
+  }
+  n[root_].color_ = Color::kBlack;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void IndexedRedBlackTree<T, Compare, KeyOfValue>::FixErase(index_type x) {
+  node_type *n = Nodes();
+  while (x != root_ && n[x].color_ == Color::kBlack) {
+    index_type parent = n[x].parent_;
+    if (x == n[parent].left_) {
+      index_type sibling = n[parent].right_;
+      if (n[sibling].color_ == Color::kRed) {
+        n[sibling].color_ = Color::kBlack;
+        n[parent].color_ = Color::kRed;
+        RotateLeft(parent);
+        sibling = n[parent].right_;
+      }
+      if (n[n[sibling].left_].color_ == Color::kBlack &&
+          n[n[sibling].right_].color_ == Color::kBlack) {
+        n[sibling].color_ = Color::kRed;
+        x = parent;
+        continue;
+      }
+      if (n[n[sibling].right_].color_ == Color::kBlack) {
+        n[n[sibling].left_].color_ = Color::kBlack;
+        n[sibling].color_ = Color::kRed;
+        RotateRight(sibling);
+        sibling = n[parent].right_;
+      }
+      n[sibling].color_ = n[parent].color_;
+      n[parent].color_ = Color::kBlack;
+      n[n[sibling].right_].color_ = Color::kBlack;
+      RotateLeft(parent);
+    } else {
+      index_type sibling = n[parent].left_;
+      if (n[sibling].color_ == Color::kRed) {
+        n[sibling].color_ = Color::kBlack;
+        n[parent].color_ = Color::kRed;
+        RotateRight(parent);
+        sibling = n[parent].left_;
+      }
+      if (n[n[sibling].left_].color_ == Color::kBlack &&
+          n[n[sibling].right_].color_ == Color::kBlack) {
+        n[sibling].color_ = Color::kRed;
+        x = parent;
+        continue;
+      }
+      if (n[n[sibling].left_].color_ == Color::kBlack) {
+        n[n[sibling].right_].color_ = Color::kBlack;
+        n[sibling].color_ = Color::kRed;
+        RotateLeft(sibling);
+        sibling = n[parent].left_;
+      }
+      n[sibling].color_ = n[parent].color_;
+      n[parent].color_ = Color::kBlack;
+      n[n[sibling].left_].color_ = Color::kBlack;
+      RotateRight(parent);
+    }
+    x = root_;
+  }
+  n[x].color_ = Color::kBlack;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+size_t IndexedRedBlackTree<T, Compare, KeyOfValue>::GetHeight(
+    index_type index) const {
+  if (index == kNil) {
+    return 0;
+  }
+  return 1 + std::max(GetHeight(Nodes()[index].left_),
+                      GetHeight(Nodes()[index].right_));
+}
+
+// Returns the black height of the subtree, or -1 if an invariant is broken
+template <typename T, typename Compare, typename KeyOfValue>
+int IndexedRedBlackTree<T, Compare, KeyOfValue>::ValidateSubtree(
+    index_type index, index_type parent) const {
+  if (index == kNil) {
+    return 0;
+  }
+  const node_type &node = Nodes()[index];
+  if (node.parent_ != parent || node.color_ == Color::kNone) {
+    return -1;
+  }
+  if (node.color_ == Color::kRed &&
+      (Nodes()[node.left_].color_ == Color::kRed ||
+       Nodes()[node.right_].color_ == Color::kRed)) {
+    return -1;
+  }
+  int left = ValidateSubtree(node.left_, index);
+  int right = ValidateSubtree(node.right_, index);
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  return left + (node.color_ == Color::kBlack ? 1 : 0);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_INDEXED_RED_BLACK_TREE_H_
@@ -1,29 +1,54 @@
 #ifndef CPP2_S21_CONTAINERS_1_NODE_H_
 #define CPP2_S21_CONTAINERS_1_NODE_H_
 
+#include <utility>
+
 enum class Color {
   kNone = 0,
   kRed = 1 << 0,
   kBlack = 1 << 1,
 };
 
-template <typename T>
-struct Node {
-  T data_;
+// Selects the sentinel flavour of a node's balance bookkeeping
+struct SentinelTag {};
+
+// Balance bookkeeping of the red-black policy
+struct RedBlackNodeBase {
   Color color_;
+
+  RedBlackNodeBase() : color_(Color::kRed){};
+  explicit RedBlackNodeBase(SentinelTag) : color_(Color::kBlack){};
+};
+
+// Balance bookkeeping of the AVL policy: height of the subtree, 0 for nil
+struct AvlNodeBase {
+  int height_;
+
+  AvlNodeBase() : height_(1){};
+  explicit AvlNodeBase(SentinelTag) : height_(0){};
+};
+
+template <typename T, typename Base = RedBlackNodeBase>
+struct Node : Base {
+  T data_;
   Node *parent_;
   Node *left_;
   Node *right_;
 
   explicit Node(const T &data)
       : data_(data),
-        color_(Color::kRed),
         parent_(nullptr),
         left_(nullptr),
         right_(nullptr){};  //Инициализация красной вершины
 
+  explicit Node(T &&data)
+      : data_(std::move(data)),
+        parent_(nullptr),
+        left_(nullptr),
+        right_(nullptr){};
+
   Node()
-      : color_(Color::kBlack),
+      : Base(SentinelTag{}),
         parent_(nullptr),
         left_(nullptr),
         right_(nullptr){};  //Инициализация черной вершины
@@ -31,4 +56,4 @@ struct Node {
   ~Node() = default;  // destructor
 };
 
-#endif  // CPP2_S21_CONTAINERS_1_NODE_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_1_NODE_H_
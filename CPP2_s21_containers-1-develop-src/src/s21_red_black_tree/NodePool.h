@@ -0,0 +1,257 @@
+#ifndef CPP2_S21_CONTAINERS_1_NODE_POOL_H_
+#define CPP2_S21_CONTAINERS_1_NODE_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Node storage of one tree. Slots are carved out of blocks that grow
+// geometrically, and freed slots go onto a free list that the next
+// allocations reuse before the block is bumped any further. The pool only
+// hands out raw storage: constructing and destroying the Node is up to the
+// caller, and every node has to be destroyed before the pool is cleared.
+template <typename Node>
+class NodePool {
+ public:
+  NodePool() = default;
+  NodePool(const NodePool &other) = delete;
+  NodePool(NodePool &&other) noexcept;
+  ~NodePool();
+
+  NodePool &operator=(const NodePool &other) = delete;
+  NodePool &operator=(NodePool &&other) noexcept;
+
+  void *Allocate();
+  void Deallocate(void *slot);
+
+  // Makes sure the next count allocations need no new block. Whatever is
+  // missing is added as one block, so a pool that starts out empty hands
+  // the count slots out contiguously and in address order.
+  void Reserve(size_t count);
+  // Frees the blocks none of whose slots are allocated
+  void ReleaseUnused();
+  // Frees every block at once
+  void Clear();
+  void Swap(NodePool &other) noexcept;
+  // Takes over the blocks of other, allocated slots included, leaving
+  // other empty
+  void Splice(NodePool &other);
+
+  // Slots owned by the pool, allocated or not
+  size_t Capacity() const { return capacity_; }
+  // Slots that can be allocated without adding a block
+  size_t Available() const {
+    return free_count_ + static_cast<size_t>(limit_ - cursor_);
+  }
+
+ private:
+  union Slot;
+
+  struct BlockHeader {
+    Slot *next;
+    size_t count;
+  };
+
+  union Slot {
+    Slot *next;
+    BlockHeader header;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  static constexpr size_t kMinBlock = 16;
+  static constexpr size_t kMaxBlock = 4096;
+
+  // The first slot of a block holds a BlockHeader linking to the
+  // previously allocated block
+  Slot *blocks_ = nullptr;
+  Slot *free_ = nullptr;
+  Slot *cursor_ = nullptr;
+  Slot *limit_ = nullptr;
+  size_t free_count_ = 0;
+  size_t capacity_ = 0;
+
+  void AddBlock(size_t count);
+  void RetireCursor();
+};
+
+//////////////////////////////////////////////////////
+
+template <typename Node>
+NodePool<Node>::NodePool(NodePool &&other) noexcept {
+  Swap(other);
+}
+
+template <typename Node>
+NodePool<Node>::~NodePool() {
+  Clear();
+}
+
+template <typename Node>
+NodePool<Node> &NodePool<Node>::operator=(NodePool &&other) noexcept {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+template <typename Node>
+void *NodePool<Node>::Allocate() {
+  if (free_ != nullptr) {
+    Slot *slot = free_;
+    free_ = slot->next;
+    --free_count_;
+    return slot->storage;
+  }
+  if (cursor_ == limit_) {
+    size_t count = capacity_ < kMinBlock ? kMinBlock : capacity_;
+    AddBlock(count < kMaxBlock ? count : kMaxBlock);
+  }
+  return (cursor_++)->storage;
+}
+
+template <typename Node>
+void NodePool<Node>::Deallocate(void *slot) {
+  Slot *freed = static_cast<Slot *>(slot);
+  freed->next = free_;
+  free_ = freed;
+  ++free_count_;
+}
+
+template <typename Node>
+void NodePool<Node>::Reserve(size_t count) {
+  size_t available = Available();
+  if (available < count) {
+    AddBlock(count - available);
+  }
+}
+
+// Counts the free slots of every block, with the blocks sorted by address
+// so that a slot's block is found by binary search, then drops the blocks
+// that are entirely free together with their slots on the free list
+template <typename Node>
+void NodePool<Node>::ReleaseUnused() {
+  if (blocks_ == nullptr) {
+    return;
+  }
+  RetireCursor();
+  s21::vector<Slot *> blocks;
+  for (Slot *block = blocks_; block != nullptr; block = block->header.next) {
+    blocks.push_back(block);
+  }
+  Slot **first = blocks.data();
+  Slot **last = first + blocks.size();
+  std::sort(first, last, std::less<Slot *>());
+  s21::vector<size_t> free_slots(blocks.size());
+  size_t *counts = free_slots.data();
+  std::fill(counts, counts + blocks.size(), size_t(0));
+  auto block_of = [first, last](Slot *slot) {
+    return static_cast<size_t>(
+        std::upper_bound(first, last, slot, std::less<Slot *>()) - first - 1);
+  };
+  for (Slot *slot = free_; slot != nullptr; slot = slot->next) {
+    ++counts[block_of(slot)];
+  }
+
+  Slot **kept = &free_;
+  for (Slot *slot = free_; slot != nullptr; slot = slot->next) {
+    size_t index = block_of(slot);
+    if (counts[index] != first[index]->header.count) {
+      *kept = slot;
+      kept = &slot->next;
+    } else {
+      --free_count_;
+    }
+  }
+  *kept = nullptr;
+
+  blocks_ = nullptr;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (counts[i] == first[i]->header.count) {
+      capacity_ -= counts[i];
+      delete[] first[i];
+    } else {
+      first[i]->header.next = blocks_;
+      blocks_ = first[i];
+    }
+  }
+}
+
+template <typename Node>
+void NodePool<Node>::Clear() {
+  while (blocks_ != nullptr) {
+    Slot *next = blocks_->header.next;
+    delete[] blocks_;
+    blocks_ = next;
+  }
+  free_ = cursor_ = limit_ = nullptr;
+  free_count_ = 0;
+  capacity_ = 0;
+}
+
+template <typename Node>
+void NodePool<Node>::Swap(NodePool &other) noexcept {
+  std::swap(blocks_, other.blocks_);
+  std::swap(free_, other.free_);
+  std::swap(cursor_, other.cursor_);
+  std::swap(limit_, other.limit_);
+  std::swap(free_count_, other.free_count_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename Node>
+void NodePool<Node>::Splice(NodePool &other) {
+  if (other.blocks_ == nullptr || this == &other) {
+    return;
+  }
+  other.RetireCursor();
+  Slot *last_block = other.blocks_;
+  while (last_block->header.next != nullptr) {
+    last_block = last_block->header.next;
+  }
+  last_block->header.next = blocks_;
+  blocks_ = other.blocks_;
+  if (other.free_ != nullptr) {
+    Slot *last_free = other.free_;
+    while (last_free->next != nullptr) {
+      last_free = last_free->next;
+    }
+    last_free->next = free_;
+    free_ = other.free_;
+  }
+  free_count_ += other.free_count_;
+  capacity_ += other.capacity_;
+  other.blocks_ = other.free_ = nullptr;
+  other.free_count_ = other.capacity_ = 0;
+}
+
+template <typename Node>
+void NodePool<Node>::AddBlock(size_t count) {
+  Slot *block = new Slot[count + 1];
+  RetireCursor();
+  block->header.next = blocks_;
+  block->header.count = count;
+  blocks_ = block;
+  cursor_ = block + 1;
+  limit_ = cursor_ + count;
+  capacity_ += count;
+}
+
+// Moves the untouched tail of the current block onto the free list, lowest
+// address on top
+template <typename Node>
+void NodePool<Node>::RetireCursor() {
+  while (limit_ != cursor_) {
+    Deallocate((--limit_)->storage);
+  }
+  cursor_ = limit_ = nullptr;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_NODE_POOL_H_
@@ -0,0 +1,77 @@
+#ifndef CPP2_S21_CONTAINERS_1_PARALLEL_TASKS_H_
+#define CPP2_S21_CONTAINERS_1_PARALLEL_TASKS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Fork-join helper for the parallel tree algorithms. Run hands out task
+// indices from a shared counter to a group of threads that includes the
+// caller, so tasks of uneven cost still balance out, and joins them all
+// before returning.
+struct ParallelTasks {
+  // requested, or the hardware concurrency (at least 1) when it is 0
+  static size_t ThreadCount(size_t requested);
+
+  // Calls task(i) for every i in [0, count) on up to threads threads. If a
+  // task throws, the remaining tasks are skipped and the first exception is
+  // rethrown once every thread has stopped.
+  template <typename Task>
+  static void Run(size_t count, size_t threads, Task task);
+};
+
+//////////////////////////////////////////////////////
+
+inline size_t ParallelTasks::ThreadCount(size_t requested) {
+  if (requested != 0) {
+    return requested;
+  }
+  size_t hardware = std::thread::hardware_concurrency();
+  return hardware != 0 ? hardware : 1;
+}
+
+template <typename Task>
+void ParallelTasks::Run(size_t count, size_t threads, Task task) {
+  std::atomic<size_t> next{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&]() {
+    for (size_t index = next++; index < count && !failed; index = next++) {
+      try {
+        task(index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!failed.exchange(true)) {
+          error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  size_t helpers = ThreadCount(threads);
+  helpers = (helpers < count ? helpers : count);
+  helpers = helpers > 0 ? helpers - 1 : 0;
+  s21::vector<std::thread> pool(helpers);
+  for (size_t i = 0; i < helpers; ++i) {
+    pool[i] = std::thread(worker);
+  }
+  worker();
+  for (size_t i = 0; i < pool.size(); ++i) {
+    pool[i].join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_PARALLEL_TASKS_H_
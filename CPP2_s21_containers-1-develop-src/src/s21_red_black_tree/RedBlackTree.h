@@ -2,60 +2,172 @@
 #define CPP2_S21_CONTAINERS_1_RED_BLACK_TREE_H_
 
 #include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+#include "../s21_reclaimer/Reclaimer.h"
+#include "../s21_vector/s21_vector.h"
+#include "BalancePolicy.h"
 #include "Node.h"
+#include "NodePool.h"
+#include "ParallelTasks.h"
 
 namespace s21 {
 
+// Extracts the ordering key from a stored value: set-like trees store the key
+// itself, map-like trees store std::pair<const Key, T> and order by .first.
 template <typename T>
-class RedBlackTree {
+struct Identity {
+  const T &operator()(const T &value) const { return value; }
+};
+
+template <typename Pair>
+struct SelectFirst {
+  const typename Pair::first_type &operator()(const Pair &value) const {
+    return value.first;
+  }
+};
+
+// Resolves to R only for comparators declaring is_transparent, so that
+// heterogeneous lookup overloads drop out of overload resolution otherwise.
+template <typename Compare, typename K, typename R, typename = void>
+struct TransparentLookup {};
+
+template <typename Compare, typename K, typename R>
+struct TransparentLookup<Compare, K, R,
+                         std::void_t<typename Compare::is_transparent>> {
+  using type = R;
+};
+
+template <typename Compare, typename K, typename R>
+using TransparentLookupT = typename TransparentLookup<Compare, K, R>::type;
+
+// Resolves to R only for forward iterators, so that range overloads such as
+// insert(first, last) drop out for calls like map::insert(key, obj).
+template <typename It, typename R, typename = void>
+struct ForwardIteratorOnly {};
+
+template <typename It, typename R>
+struct ForwardIteratorOnly<
+    It, R,
+    std::enable_if_t<std::is_base_of_v<
+        std::forward_iterator_tag,
+        typename std::iterator_traits<It>::iterator_category>>> {
+  using type = R;
+};
+
+template <typename It, typename R>
+using ForwardIteratorT = typename ForwardIteratorOnly<It, R>::type;
+
+// Snapshot returned by RedBlackTree::GetStats(). The shape fields are always
+// filled in; the event counters stay zero unless S21_TREE_STATS is defined
+// before the first include, so release builds pay nothing for them.
+struct TreeStats {
+  size_t height = 0;
+  size_t black_height = 0;
+  size_t node_count = 0;
+  size_t bytes_used = 0;
+  size_t rotations = 0;
+  size_t comparisons = 0;
+  size_t allocations = 0;
+  size_t deallocations = 0;
+};
+
+// Order in which RedBlackTree::Compact() lays the nodes out in memory.
+// kInOrder suits scans; kVanEmdeBoas stores every subtree of about sqrt(n)
+// nodes in one run, so a lookup touches few cache lines at every level.
+enum class NodeLayout { kInOrder, kVanEmdeBoas };
+
+#ifndef S21_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define S21_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define S21_PREFETCH(address) ((void)0)
+#endif
+#endif
+
+#ifdef S21_TREE_STATS
+#define S21_TREE_COUNT(counter) (++counters_.counter)
+#else
+#define S21_TREE_COUNT(counter) ((void)0)
+#endif
+
+template <typename T, bool IsConst, typename NodeBase = RedBlackNodeBase>
+class RedBlackTreeIteratorBase {
  public:
-  template <bool IsConst>
-  class RedBlackTreeIteratorBase {
-   public:
-    using iterator_category = std::bidirectional_iterator_tag;
-    using difference_type = std::ptrdiff_t;
-    using value_type = T;
-    using pointer = std::conditional_t<IsConst, const T *, T *>;
-    using reference = std::conditional_t<IsConst, const T &, T &>;
-    using RedBlackTreeIterator = RedBlackTreeIteratorBase<false>;
-    using RedBlackTreeConstIterator = RedBlackTreeIteratorBase<true>;
-
-   public:
-    RedBlackTreeIteratorBase() = default;
-    explicit RedBlackTreeIteratorBase(Node<T> *node, Node<T> *nil)
-        : current_node_(node), nil_(nil){};
-
-   public:
-    reference operator*() const;
-    pointer operator->() const;
-
-    RedBlackTreeIteratorBase &operator++();
-    RedBlackTreeIteratorBase &operator--();
-    RedBlackTreeIteratorBase operator++(int);
-    RedBlackTreeIteratorBase operator--(int);
-
-    bool operator==(const RedBlackTreeIteratorBase &other) const;
-    bool operator!=(const RedBlackTreeIteratorBase &other) const;
-
-   private:
-    Node<T> *current_node_;
-    Node<T> *nil_;
-  };
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = T;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+  using RedBlackTreeIterator = RedBlackTreeIteratorBase<T, false, NodeBase>;
+  using RedBlackTreeConstIterator =
+      RedBlackTreeIteratorBase<T, true, NodeBase>;
+  using node_type = Node<T, NodeBase>;
+
+ public:
+  RedBlackTreeIteratorBase() = default;
+  explicit RedBlackTreeIteratorBase(node_type *node, node_type *nil)
+      : current_node_(node), nil_(nil){};
+
+ public:
+  reference operator*() const;
+  pointer operator->() const;
+
+  RedBlackTreeIteratorBase &operator++();
+  RedBlackTreeIteratorBase &operator--();
+  RedBlackTreeIteratorBase operator++(int);
+  RedBlackTreeIteratorBase operator--(int);
+
+  bool operator==(const RedBlackTreeIteratorBase &other) const;
+  bool operator!=(const RedBlackTreeIteratorBase &other) const;
+
+  node_type *GetNode() const { return current_node_; }
+
+ private:
+  node_type *current_node_;
+  node_type *nil_;
+};
+
+// Node layout of a tree balanced by the given policy
+template <typename T, typename Balance>
+using TreeNode = Node<T, typename Balance::NodeBase>;
 
+// Balance selects the rebalancing scheme (see BalancePolicy.h); the class
+// keeps its historical name since red-black is the default.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>,
+          typename Balance = RedBlackBalance>
+class RedBlackTree {
  public:
-  using iterator = RedBlackTreeIteratorBase<false>;
-  using const_iterator = RedBlackTreeIteratorBase<true>;
+  using node_type = TreeNode<T, Balance>;
+  using iterator =
+      RedBlackTreeIteratorBase<T, false, typename Balance::NodeBase>;
+  using const_iterator =
+      RedBlackTreeIteratorBase<T, true, typename Balance::NodeBase>;
 
   RedBlackTree();
   RedBlackTree(std::initializer_list<T> const &items);
   RedBlackTree(const RedBlackTree &other);
+  // Copies other on up to threads threads (0: one per core). The top levels
+  // are copied first; each subtree hanging below them is then copied by one
+  // task into a node pool of its own, and the pools are spliced into this
+  // tree's at the end. Small trees are copied on the calling thread.
+  RedBlackTree(const RedBlackTree &other, size_t threads);
   RedBlackTree(RedBlackTree &&other) noexcept;
   ~RedBlackTree();
 
+  // Reuses this tree's nodes for other's values and copies other's shape
+  // node for node, so a refresh costs a walk of each tree, with no
+  // rebalancing and no allocation unless other is larger. A failed copy
+  // leaves the tree empty.
   RedBlackTree &operator=(const RedBlackTree &other);
   RedBlackTree &operator=(RedBlackTree &&other) noexcept;
 
@@ -64,66 +176,235 @@ class RedBlackTree {
   const_iterator begin() const;
   const_iterator end() const;
 
-  Node<T> *GetRoot() const { return root_; }
-  Node<T> *GetNil() const { return nil_; }
-  void SetRoot(Node<T> *node) { root_ = node; }
-
-  Node<T> *MinNode(Node<T> *node) const;
-  Node<T> *MaxNode(Node<T> *node) const;
-  Node<T> *FindNode(const T &key) const;
-
-  void Insert(const T &data);
-
-  void RemoveNode(Node<T> *z);
-  void ClearNodes(Node<T> *node);
+  node_type *GetRoot() const { return root_; }
+  node_type *GetNil() const { return nil_; }
+  void SetRoot(node_type *node) { root_ = node; }
+
+  node_type *MinNode(node_type *node) const;
+  node_type *MaxNode(node_type *node) const;
+
+  // Lookups accept any K the comparator can order against the stored key.
+  // FindNode returns nullptr on a miss, the bound lookups return nil_.
+  template <typename K>
+  node_type *FindNode(const K &key) const;
+  template <typename K>
+  node_type *LowerBoundNode(const K &key) const;
+  template <typename K>
+  node_type *UpperBoundNode(const K &key) const;
+
+  // Finger search: climbs from finger until the subtree at hand brackets
+  // key and descends from there, so it costs O(log d) for a key d elements
+  // away from finger. Returns nullptr on a miss, like FindNode.
+  template <typename K>
+  node_type *FindNodeFrom(node_type *finger, const K &key) const;
+  // FindNode, or with the lookup cache enabled a check of the last node
+  // found followed by a finger search from it. The cache is meant for local
+  // access patterns; it makes lookups write to the tree, so concurrent
+  // lookups need outside synchronization while it is on.
+  template <typename K>
+  node_type *LookupNode(const K &key) const;
+  void SetLookupCache(bool enabled);
+
+  // Batched FindNode: descends for up to kLookupLanes keys in lockstep and
+  // prefetches every lane's next node, so the cache misses of one descent
+  // overlap with the comparisons of the others. Calls visit(node) once per
+  // key of [first, last), in order, with nullptr on a miss.
+  static constexpr size_t kLookupLanes = 16;
+  template <typename ForwardIt, typename Visit>
+  void FindNodes(ForwardIt first, ForwardIt last, Visit visit) const;
+
+  node_type *Insert(const T &data);
+  // Links a node for data unless its key is present, searching from finger
+  // as FindNodeFrom does (nullptr searches from the root). Returns the node
+  // holding the key and whether it is new.
+  std::pair<node_type *, bool> InsertUniqueFrom(node_type *finger,
+                                                const T &data);
+  // Inserts the values of [first, last) whose keys are not present yet,
+  // the first of equal keys in the batch winning, and returns how many went
+  // in. A batch of fewer than size / kMergeDivisor values goes in value by
+  // value, each searched for from the node of the one before it for as long
+  // as the batch ascends and from the root after that; a larger batch is
+  // sorted, merged with the tree in order and relinked into a balanced tree
+  // in O(n + m log m). Existing nodes never move. If a value fails to copy,
+  // a merged batch is not inserted at all.
+  template <typename ForwardIt>
+  size_t InsertUnique(ForwardIt first, ForwardIt last);
+
+  void RemoveNode(node_type *z);
+  // Destroys the subtree of node; clearing the whole tree this way also
+  // frees all node storage, reserved slots included, and skips the walk
+  // over the nodes when T is trivially destructible
+  void ClearNodes(node_type *node);
+  // Empties the tree in O(1): the nodes, the sentinel and the node pool are
+  // handed to the Reclaimer thread, which destroys and frees them later
+  void ClearAsync();
+  // Remove node, or the nodes of [first, last), and return the node after
+  // the removed ones. Removal relinks nodes rather than moving values, so
+  // nodes other than the removed ones stay valid.
+  node_type *EraseNode(node_type *node);
+  node_type *EraseNodes(node_type *first, node_type *last);
+  // Removes the elements pred holds for, visiting them in order, and
+  // returns how many went. The first 1/kSweepSampleDivisor of the elements
+  // are erased one by one; if at least kRebuildPercent of those went, the
+  // rest are swept without rebalancing and the survivors are relinked into
+  // a balanced tree in O(n). Surviving nodes never move, so their iterators
+  // stay valid. If pred throws, the elements it has not seen are kept.
+  template <typename Pred>
+  size_t EraseIf(Pred pred);
+
+  // Parallel in-order traversal on up to threads threads (0: one per core).
+  // The tree is cut into consecutive node ranges, several per thread, and
+  // each range is walked by one task. ParallelReduce folds every range with
+  // op starting from identity and then combines the partial results in key
+  // order, so op and combine have to be associative but not commutative.
+  template <typename Function>
+  void ParallelForEach(Function f, size_t threads);
+  template <typename R, typename Op, typename Combine>
+  R ParallelReduce(R identity, Op op, Combine combine, size_t threads) const;
+  // Cuts the tree into count consecutive ranges [bounds[i], bounds[i + 1])
+  // of roughly equal size, the last bound being nil_. Trees of up to
+  // kPartitionPieces * count nodes are walked and cut exactly; larger ones
+  // are cut in O(count log^2 n) from estimated subtree sizes.
+  s21::vector<node_type *> Partition(size_t count) const;
+
+  // Moves every node into one freshly allocated block, in the given order,
+  // and releases the blocks the nodes were scattered across. The contents
+  // and shape of the tree are unchanged, but iterators and node pointers
+  // are invalidated. Strong exception guarantee.
+  void Compact(NodeLayout layout);
+  // Node storage: Reserve makes room for count nodes in total, adding what
+  // is missing as a single block, and ShrinkToFit frees the blocks that no
+  // longer hold a node. Neither moves a node.
+  void Reserve(size_t count);
+  void ShrinkToFit();
 
   size_t GetSize() const;
   size_t GetMaxSize() const;
 
+  TreeStats GetStats() const;
+  void ResetStats();
+  // Checks ordering, parent links, the size counter and the invariants of
+  // the balance policy; meant for tests and debug assertions, it is O(n).
+  bool Validate() const;
+
  private:
-  Node<T> *root_;
-  Node<T> *nil_;
+  friend Balance;
+
+  node_type *root_;
+  node_type *nil_;
+  Compare comp_;
+  size_t size_ = 0;
+  NodePool<node_type> pool_;
+  bool cache_lookups_ = false;
+  mutable node_type *last_hit_ = nullptr;
+#ifdef S21_TREE_STATS
+  mutable TreeStats counters_;
+#endif
+
+  static const auto &KeyOf(const T &data) { return KeyOfValue()(data); }
+  template <typename A, typename B>
+  bool Less(const A &lhs, const B &rhs) const {
+    S21_TREE_COUNT(comparisons);
+    return comp_(lhs, rhs);
+  }
+
+  template <typename K>
+  node_type *FindNodeBelow(node_type *current, const K &key) const;
+  // Climbs from finger to the first node whose subtree brackets key
+  template <typename K>
+  node_type *ClimbFrom(node_type *finger, const K &key) const;
 
-  void RotateLeft(Node<T> *node);
-  void RotateRight(Node<T> *node);
-  void FixInsert(Node<T> *&node);
+  class DetachedNodes;
 
-  void Transplant(Node<T> *u, Node<T> *v);
-  void FixDelete(Node<T> *x);
+  node_type *CreateNode(const T &data);
+  void DestroyNode(node_type *node);
 
-  Node<T> *CopyTree(Node<T> *node, Node<T> *other_nil);
+  void RotateLeft(node_type *node);
+  void RotateRight(node_type *node);
 
-  size_t GetSize(Node<T> *node) const;
+  void Transplant(node_type *u, node_type *v);
+
+  node_type *CopyTree(node_type *node, node_type *other_nil);
+  void RecycleNodes(node_type *source, node_type *other_nil,
+                    node_type *parent, node_type **link, node_type *&spare);
+  void Reassign(node_type *node, const T &data);
+
+  struct CopyTask {
+    node_type *source;
+    node_type *parent;
+    node_type **link;
+  };
+  static constexpr size_t kParallelCopyMinSize = size_t(1) << 14;
+  void CopyNodes(node_type *source, node_type *other_nil, node_type *parent,
+                 node_type **link, NodePool<node_type> &pool, size_t &count,
+                 size_t depth, s21::vector<CopyTask> *tasks);
+  void CopySubtrees(node_type *other_nil, s21::vector<CopyTask> &tasks,
+                    size_t threads);
+
+  static constexpr size_t kSweepSampleDivisor = 16;
+  static constexpr size_t kRebuildPercent = 55;
+  // Red-black and AVL trees of 2^64 nodes are less than 128 levels deep
+  static constexpr size_t kMaxHeight = 128;
+  template <typename Pred>
+  void SweepAndRebuild(node_type *first, Pred &pred);
+  node_type *LinkBalanced(node_type *&head, size_t count, node_type *parent,
+                          size_t depth, size_t full_levels, size_t &height);
+  void LinkBalanced(node_type *head, size_t count);
+
+  static constexpr size_t kMergeDivisor = 2;
+  void MergeAndRebuild(s21::vector<node_type *> &batch);
+
+  void CollectVanEmdeBoas(node_type *node, size_t height,
+                          s21::vector<node_type *> &order) const;
+  void CollectSubtrees(node_type *node, size_t depth, size_t height,
+                       s21::vector<node_type *> &order) const;
+
+  static constexpr size_t kRangesPerThread = 8;
+  static constexpr size_t kPartitionPieces = 16;
+  static constexpr size_t kPartitionProbes = 4;
+  struct Piece {
+    node_type *first;
+    double size;
+  };
+  void CollectPieces(node_type *node, double limit,
+                     s21::vector<Piece> &pieces) const;
+  double EstimateSize(node_type *node, size_t seed) const;
+  s21::vector<node_type *> SplitRanges(size_t ranges) const;
+  void CollectBounds(node_type *node, size_t depth,
+                     s21::vector<node_type *> &bounds) const;
+  template <typename Visit>
+  void WalkRange(node_type *first, node_type *last, Visit visit) const;
+
+  size_t GetSize(node_type *node) const;
+  size_t GetHeight(node_type *node) const;
+  int ValidateSubtree(node_type *node, node_type *parent) const;
 
  public:
   iterator my_end();
   const_iterator my_end() const;
   // For working tests
   // void PrintTree();
-  // void PrintHelper(Node<T> *node, std::string indent, bool last);
+  // void PrintHelper(node_type *node, std::string indent, bool last);
 };
 
 //////////////////////////////////////////////////////
 
 // For RedBlackTreeIterator
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>::reference
-RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator*() const {
+template <typename T, bool IsConst, typename NodeBase>
+typename RedBlackTreeIteratorBase<T, IsConst, NodeBase>::reference
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator*() const {
   return current_node_->data_;
 }
 
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>::pointer
-RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator->() const {
+template <typename T, bool IsConst, typename NodeBase>
+typename RedBlackTreeIteratorBase<T, IsConst, NodeBase>::pointer
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator->() const {
   return &current_node_->data_;
 }
 
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
-    &RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator++() {
+template <typename T, bool IsConst, typename NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>
+    &RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator++() {
   if (current_node_ == nullptr || current_node_ == nil_ || nil_ == nullptr) {
     return *this;
   }
@@ -146,10 +427,9 @@ typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
   return *this;
 }
 
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
-    &RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator--() {
+template <typename T, bool IsConst, typename NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>
+    &RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator--() {
   if (current_node_ == nil_) {
     current_node_ = nil_->parent_;
     if (current_node_ == nullptr) {
@@ -171,34 +451,30 @@ typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
   return *this;
 }
 
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
-RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator++(int) {
+template <typename T, bool IsConst, typename NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator++(int) {
   RedBlackTreeIteratorBase temp = *this;
   ++(*this);
   return temp;
 }
 
-template <typename T>
-template <bool IsConst>
-typename RedBlackTree<T>::template RedBlackTreeIteratorBase<IsConst>
-RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator--(int) {
+template <typename T, bool IsConst, typename NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>
+RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator--(int) {
   RedBlackTreeIteratorBase temp = *this;
   --(*this);
   return temp;
 }
 
-template <typename T>
-template <bool IsConst>
-bool RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator==(
+template <typename T, bool IsConst, typename NodeBase>
+bool RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator==(
     const RedBlackTreeIteratorBase &other) const {
   return current_node_ == other.current_node_;
 }
 
-template <typename T>
-template <bool IsConst>
-bool RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator!=(
+template <typename T, bool IsConst, typename NodeBase>
+bool RedBlackTreeIteratorBase<T, IsConst, NodeBase>::operator!=(
     const RedBlackTreeIteratorBase &other) const {
   return current_node_ != other.current_node_;
 }
@@ -206,149 +482,460 @@ bool RedBlackTree<T>::RedBlackTreeIteratorBase<IsConst>::operator!=(
 
 // For RedBlackTree
 
-template <typename T>
-RedBlackTree<T>::RedBlackTree() {
-  nil_ = new Node<T>();
-  nil_->color_ = Color::kBlack;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::RedBlackTree() {
+  nil_ = new node_type();
   root_ = nil_;
 }
 
-template <typename T>
-RedBlackTree<T>::RedBlackTree(std::initializer_list<T> const &items) {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::RedBlackTree(
+    std::initializer_list<T> const &items)
+    : RedBlackTree() {
   for (const auto &item : items) {
     Insert(item);
   }
 }
 
-template <typename T>
-RedBlackTree<T>::RedBlackTree(const RedBlackTree &other) {
-  nil_ = new Node<T>{};
-  nil_->color_ = Color::kBlack;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::RedBlackTree(
+    const RedBlackTree &other)
+    : comp_(other.comp_), cache_lookups_(other.cache_lookups_) {
+  nil_ = new node_type{};
   root_ = CopyTree(other.root_, other.nil_);
 }
 
-template <typename T>
-RedBlackTree<T>::RedBlackTree(RedBlackTree &&other) noexcept
-    : root_(other.root_), nil_(other.nil_) {
+// A failed copy leaves every node made so far linked into the tree, since
+// CopyNodes links a node before copying its children, so clearing the tree
+// is all the cleanup needed
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::RedBlackTree(
+    const RedBlackTree &other, size_t threads)
+    : comp_(other.comp_), cache_lookups_(other.cache_lookups_) {
+  nil_ = new node_type{};
+  root_ = nil_;
+  size_t thread_count = ParallelTasks::ThreadCount(threads);
+  size_t depth = 0;
+  if (thread_count > 1 && other.size_ >= kParallelCopyMinSize) {
+    while ((size_t(1) << depth) < thread_count * kRangesPerThread) {
+      ++depth;
+    }
+  }
+  s21::vector<CopyTask> tasks;
+  try {
+    CopyNodes(other.root_, other.nil_, nullptr, &root_, pool_, size_, depth,
+              depth > 0 ? &tasks : nullptr);
+    if (tasks.size() > 0) {
+      CopySubtrees(other.nil_, tasks, thread_count);
+    }
+  } catch (...) {
+    ClearNodes(root_);
+    delete nil_;
+    throw;
+  }
+#ifdef S21_TREE_STATS
+  counters_.allocations += size_;
+#endif
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::RedBlackTree(
+    RedBlackTree &&other) noexcept
+    : root_(other.root_),
+      nil_(other.nil_),
+      comp_(other.comp_),
+      size_(other.size_),
+      pool_(std::move(other.pool_)),
+      cache_lookups_(other.cache_lookups_),
+      last_hit_(other.last_hit_) {
+  other.last_hit_ = nullptr;
   other.root_ = nullptr;
   other.nil_ = nullptr;
+  other.size_ = 0;
 }
 
-template <typename T>
-RedBlackTree<T>::~RedBlackTree() {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::~RedBlackTree() {
   ClearNodes(root_);
   delete nil_;
   nil_ = nullptr;
   root_ = nil_;
 }
 
-template <typename T>
-RedBlackTree<T> &RedBlackTree<T>::operator=(const RedBlackTree &other) {
-  if (this != &other) {
-    ClearNodes(root_);
-    const_iterator other_iter = other.begin();
-    while (other_iter != other.end()) {
-      Insert(*other_iter);
-      ++other_iter;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance> &
+RedBlackTree<T, Compare, KeyOfValue, Balance>::operator=(
+    const RedBlackTree &other) {
+  if (this == &other) {
+    return *this;
+  }
+  node_type *spare = nil_;
+  node_type **tail = &spare;
+  node_type *stack[kMaxHeight];
+  size_t depth = 0;
+  for (node_type *node = root_; node != nil_; node = node->left_) {
+    stack[depth++] = node;
+  }
+  while (depth > 0) {
+    node_type *node = stack[--depth];
+    for (node_type *child = node->right_; child != nil_;
+         child = child->left_) {
+      stack[depth++] = child;
     }
+    *tail = node;
+    tail = &node->right_;
+  }
+  *tail = nil_;
+  root_ = nil_;
+  last_hit_ = nullptr;
+  comp_ = other.comp_;
+  try {
+    RecycleNodes(other.root_, other.nil_, nullptr, &root_, spare);
+  } catch (...) {
+    while (spare != nil_) {
+      node_type *next = spare->right_;
+      DestroyNode(spare);
+      spare = next;
+    }
+    ClearNodes(root_);
+    root_ = nil_;
+    throw;
+  }
+  while (spare != nil_) {
+    node_type *next = spare->right_;
+    DestroyNode(spare);
+    spare = next;
   }
   return *this;
 }
 
-template <typename T>
-RedBlackTree<T> &RedBlackTree<T>::operator=(RedBlackTree<T> &&other) noexcept {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+RedBlackTree<T, Compare, KeyOfValue, Balance> &
+RedBlackTree<T, Compare, KeyOfValue, Balance>::operator=(
+    RedBlackTree &&other) noexcept {
   if (this != &other) {
     root_ = other.root_;
+    comp_ = other.comp_;
+    size_ = other.size_;
+    other.size_ = 0;
+    pool_ = std::move(other.pool_);
+    last_hit_ = other.last_hit_;
+    other.last_hit_ = nullptr;
     delete nil_; /* Need to free already allocated for nil_ memory */
     nil_ = other.nil_;
-    other.nil_ = new Node<T>{};
+    other.nil_ = new node_type{};
     other.root_ = other.nil_;
   }
   return *this;
 }
 
 ////////////iterators for RedBlackTree////////////////
-template <typename T>
-typename RedBlackTree<T>::iterator RedBlackTree<T>::begin() {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::begin() {
   return iterator(MinNode(root_), nil_);
 }
 
-template <typename T>
-typename RedBlackTree<T>::iterator RedBlackTree<T>::end() {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::end() {
   return iterator(nil_, nil_);
 }
 
-template <typename T>
-typename RedBlackTree<T>::const_iterator RedBlackTree<T>::begin() const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::const_iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::begin() const {
   return const_iterator(MinNode(root_), nil_);
 }
 
-template <typename T>
-typename RedBlackTree<T>::const_iterator RedBlackTree<T>::end() const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::const_iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::end() const {
   return const_iterator(nil_, nil_);
 }
 
-template <typename T>
-typename RedBlackTree<T>::iterator RedBlackTree<T>::my_end() {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::my_end() {
   return iterator(MaxNode(root_), nil_);
 }
 
-template <typename T>
-typename RedBlackTree<T>::const_iterator RedBlackTree<T>::my_end() const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::const_iterator
+RedBlackTree<T, Compare, KeyOfValue, Balance>::my_end() const {
   return const_iterator(MaxNode(root_), nil_);
 }
 
-template <typename T>
-Node<T> *RedBlackTree<T>::MinNode(Node<T> *node) const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::MinNode(node_type *node) const {
   while (node->left_ != nil_ && node->left_ != nullptr) {
     node = node->left_;
   }
   return node;
 }
 
-template <typename T>
-Node<T> *RedBlackTree<T>::MaxNode(Node<T> *node) const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::MaxNode(node_type *node) const {
   while (node->right_ != nil_ && node->right_ != nullptr) {
     node = node->right_;
   }
   return node;
 }
 
-template <typename T>
-Node<T> *RedBlackTree<T>::FindNode(const T &key) const {
-  Node<T> *current = root_;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::FindNode(const K &key) const {
+  return FindNodeBelow(root_, key);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::FindNodeBelow(
+    node_type *current, const K &key) const {
   while (current != nil_) {
-    if (key == current->data_) {
+    if (Less(key, KeyOf(current->data_))) {
+      current = current->left_;
+    } else if (Less(KeyOf(current->data_), key)) {
+      current = current->right_;
+    } else {
       return current;
-    } else if (key < current->data_) {
+    }
+  }
+  return nullptr;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::FindNodeFrom(
+    node_type *finger, const K &key) const {
+  if (finger == nullptr || finger == nil_) {
+    return FindNode(key);
+  }
+  return FindNodeBelow(ClimbFrom(finger, key), key);
+}
+
+// Climbing out of a left child keeps the subtree's lower bound, so when
+// key is smaller than the finger only the steps out of a right child need a
+// comparison, and symmetrically when it is larger
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::ClimbFrom(
+    node_type *finger, const K &key) const {
+  node_type *current = finger;
+  if (Less(key, KeyOf(current->data_))) {
+    while (current->parent_ != nullptr &&
+           (current == current->parent_->left_ ||
+            !Less(KeyOf(current->parent_->data_), key))) {
+      current = current->parent_;
+    }
+  } else if (Less(KeyOf(current->data_), key)) {
+    while (current->parent_ != nullptr &&
+           (current == current->parent_->right_ ||
+            !Less(key, KeyOf(current->parent_->data_)))) {
+      current = current->parent_;
+    }
+  }
+  return current;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::LookupNode(
+    const K &key) const {
+  if (!cache_lookups_) {
+    return FindNode(key);
+  }
+  node_type *node = FindNodeFrom(last_hit_, key);
+  if (node != nullptr) {
+    last_hit_ = node;
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::SetLookupCache(
+    bool enabled) {
+  cache_lookups_ = enabled;
+  last_hit_ = nullptr;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::LowerBoundNode(
+    const K &key) const {
+  node_type *current = root_;
+  node_type *result = nil_;
+  while (current != nil_) {
+    if (Less(KeyOf(current->data_), key)) {
+      current = current->right_;
+    } else {
+      result = current;
+      current = current->left_;
+    }
+  }
+  return result;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename K>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::UpperBoundNode(
+    const K &key) const {
+  node_type *current = root_;
+  node_type *result = nil_;
+  while (current != nil_) {
+    if (Less(key, KeyOf(current->data_))) {
+      result = current;
       current = current->left_;
     } else {
       current = current->right_;
     }
   }
-  return nullptr;
+  return result;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename ForwardIt, typename Visit>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::FindNodes(
+    ForwardIt first, ForwardIt last, Visit visit) const {
+  using KeyT = std::remove_reference_t<decltype(*first)>;
+  const KeyT *keys[kLookupLanes];
+  node_type *lanes[kLookupLanes];
+  bool found[kLookupLanes];
+
+  while (first != last) {
+    size_t count = 0;
+    for (; count < kLookupLanes && first != last; ++count, ++first) {
+      keys[count] = &*first;
+      lanes[count] = root_;
+      found[count] = false;
+    }
+
+    for (size_t active = count; active != 0;) {
+      active = 0;
+      for (size_t i = 0; i < count; ++i) {
+        node_type *node = lanes[i];
+        if (node == nil_ || found[i]) {
+          continue;
+        }
+        if (Less(*keys[i], KeyOf(node->data_))) {
+          node = node->left_;
+        } else if (Less(KeyOf(node->data_), *keys[i])) {
+          node = node->right_;
+        } else {
+          found[i] = true;
+          continue;
+        }
+        S21_PREFETCH(node);
+        lanes[i] = node;
+        ++active;
+      }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      visit(found[i] ? lanes[i] : nullptr);
+    }
+  }
 }
 ///////////////////////////////////////////
 
 ////////////////////////////////////////////////////////
 // For private
-template <typename T>
-void RedBlackTree<T>::ClearNodes(Node<T> *node) {
+// Node graph detached by ClearAsync, destroyed on the Reclaimer thread
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+class RedBlackTree<T, Compare, KeyOfValue, Balance>::DetachedNodes
+    : public ReclaimJob {
+ public:
+  DetachedNodes(node_type *root, node_type *nil, NodePool<node_type> &&pool)
+      : root_(root), nil_(nil), pool_(std::move(pool)){};
+  ~DetachedNodes() override { delete nil_; }
+
+  void Run() override {
+    if (!std::is_trivially_destructible<node_type>::value) {
+      Destroy(root_);
+    }
+    pool_.Clear();
+  }
+
+ private:
+  node_type *root_;
+  node_type *nil_;
+  NodePool<node_type> pool_;
+
+  void Destroy(node_type *node) {
+    if (node != nil_) {
+      Destroy(node->left_);
+      Destroy(node->right_);
+      node->~node_type();
+    }
+  }
+};
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::ClearAsync() {
+  if (size_ == 0) {
+    ClearNodes(root_);
+    root_ = nil_;
+    return;
+  }
+  node_type *nil = new node_type{};
+  DetachedNodes *detached;
+  try {
+    detached = new DetachedNodes(root_, nil_, std::move(pool_));
+  } catch (...) {
+    delete nil;
+    throw;
+  }
+#ifdef S21_TREE_STATS
+  counters_.deallocations += size_;
+#endif
+  nil_ = nil;
+  root_ = nil_;
+  size_ = 0;
+  last_hit_ = nullptr;
+  Reclaimer::Instance().Post(detached);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::ClearNodes(
+    node_type *node) {
+  if (node == root_ && std::is_trivially_destructible<node_type>::value) {
+#ifdef S21_TREE_STATS
+    counters_.deallocations += size_;
+#endif
+    size_ = 0;
+    last_hit_ = nullptr;
+    pool_.Clear();
+    return;
+  }
   if (node != nil_) {
     ClearNodes(node->left_);
     ClearNodes(node->right_);
-    delete node;
+    DestroyNode(node);
+  }
+  if (size_ == 0) {
+    pool_.Clear();
   }
 }
 
-template <typename T>
-Node<T> *RedBlackTree<T>::CopyTree(Node<T> *node, Node<T> *other_nil) {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::CopyTree(node_type *node,
+                                                       node_type *other_nil) {
   if (node == other_nil) {
     return nil_;
   }
 
-  Node<T> *new_node = new Node<T>{node->data_};
-  new_node->color_ = node->color_;
+  node_type *new_node = CreateNode(node->data_);
+  static_cast<typename Balance::NodeBase &>(*new_node) = *node;
   new_node->left_ = CopyTree(node->left_, other_nil);
   new_node->right_ = CopyTree(node->right_, other_nil);
 
@@ -362,9 +949,65 @@ Node<T> *RedBlackTree<T>::CopyTree(Node<T> *node, Node<T> *other_nil) {
   return new_node;
 }
 
-template <typename T>
-void RedBlackTree<T>::RotateLeft(Node<T> *node) {
-  Node<T> *y = node->right_;
+// Copies the subtree of source into *link, taking nodes off the spare
+// list, which runs through right_, before allocating. Every node is linked
+// before its children are copied, so a failed copy leaves a well-formed
+// partial tree behind. The right spine is a loop to keep the recursion as
+// deep as the longest chain of left links.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::RecycleNodes(
+    node_type *source, node_type *other_nil, node_type *parent,
+    node_type **link, node_type *&spare) {
+  for (; source != other_nil; source = source->right_) {
+    node_type *node;
+    if (spare != nil_) {
+      node = spare;
+      spare = spare->right_;
+      Reassign(node, source->data_);
+    } else {
+      node = CreateNode(source->data_);
+    }
+    static_cast<typename Balance::NodeBase &>(*node) = *source;
+    node->parent_ = parent;
+    node->left_ = nil_;
+    node->right_ = nil_;
+    *link = node;
+    RecycleNodes(source->left_, other_nil, node, &node->left_, spare);
+    parent = node;
+    link = &node->right_;
+  }
+}
+
+// Assigning lets values such as strings keep their buffers; map values,
+// whose key is const, are destroyed and copy-constructed in place instead.
+// A node whose value fails to copy is freed.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::Reassign(
+    node_type *node, const T &data) {
+  if constexpr (std::is_copy_assignable_v<T>) {
+    try {
+      node->data_ = data;
+    } catch (...) {
+      DestroyNode(node);
+      throw;
+    }
+  } else {
+    node->data_.~T();
+    try {
+      new (&node->data_) T(data);
+    } catch (...) {
+      pool_.Deallocate(node);
+      --size_;
+      throw;
+    }
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::RotateLeft(
+    node_type *node) {
+  S21_TREE_COUNT(rotations);
+  node_type *y = node->right_;
   node->right_ = y->left_;
   if (y->left_ != nil_) {
     y->left_->parent_ = node;
@@ -381,9 +1024,11 @@ void RedBlackTree<T>::RotateLeft(Node<T> *node) {
   node->parent_ = y;
 }
 
-template <typename T>
-void RedBlackTree<T>::RotateRight(Node<T> *node) {
-  Node<T> *x = node->left_;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::RotateRight(
+    node_type *node) {
+  S21_TREE_COUNT(rotations);
+  node_type *x = node->left_;
   node->left_ = x->right_;
 
   if (x->right_ != nil_) {
@@ -403,64 +1048,20 @@ void RedBlackTree<T>::RotateRight(Node<T> *node) {
   node->parent_ = x;
 }
 
-template <typename T>
-void RedBlackTree<T>::FixInsert(Node<T> *&k) {
-  Node<T> *u;
-  while (k->parent_->color_ == Color::kRed) {
-    if (k->parent_ == k->parent_->parent_->left_) {
-      u = k->parent_->parent_->right_;
-      if (u->color_ == Color::kRed) {
-        k->parent_->color_ = Color::kBlack;
-        u->color_ = Color::kBlack;
-        k->parent_->parent_->color_ = Color::kRed;
-        k = k->parent_->parent_;
-      } else {
-        if (k == k->parent_->right_) {
-          k = k->parent_;
-          RotateLeft(k);
-        }
-        k->parent_->color_ = Color::kBlack;
-        k->parent_->parent_->color_ = Color::kRed;
-        RotateRight(k->parent_->parent_);
-      }
-    } else {
-      u = k->parent_->parent_->left_;
-      if (u->color_ == Color::kRed) {
-        k->parent_->color_ = Color::kBlack;
-        u->color_ = Color::kBlack;
-        k->parent_->parent_->color_ = Color::kRed;
-        k = k->parent_->parent_;
-      } else {
-        if (k == k->parent_->left_) {
-          k = k->parent_;
-          RotateRight(k);
-        }
-        k->parent_->color_ = Color::kBlack;
-        k->parent_->parent_->color_ = Color::kRed;
-        RotateLeft(k->parent_->parent_);
-      }
-    }
-    if (k == root_) {
-      break;
-    }
-  }
-  root_->color_ = Color::kBlack;
-}
-
 // For public
-template <typename T>
-void RedBlackTree<T>::Insert(const T &data) {
-  Node<T> *node = new Node<T>(data);
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance> *RedBlackTree<T, Compare, KeyOfValue, Balance>::Insert(
+    const T &data) {
+  node_type *node = CreateNode(data);
   node->left_ = nil_;
   node->right_ = nil_;
-  node->color_ = Color::kRed;
 
-  Node<T> *y = nullptr;
-  Node<T> *root = root_;
+  node_type *y = nullptr;
+  node_type *root = root_;
 
   while (root != nil_) {
     y = root;
-    if (node->data_ < root->data_) {
+    if (Less(KeyOf(node->data_), KeyOf(root->data_))) {
       root = root->left_;
     } else {
       root = root->right_;
@@ -471,43 +1072,113 @@ void RedBlackTree<T>::Insert(const T &data) {
 
   if (y == nullptr) {
     root_ = node;
-  } else if (node->data_ < y->data_) {
+  } else if (Less(KeyOf(node->data_), KeyOf(y->data_))) {
     y->left_ = node;
   } else {
     y->right_ = node;
   }
 
-  if (node->parent_ == nullptr) {
-    node->color_ = Color::kRed;
-    return;
-  }
+  Balance::AfterInsert(*this, node);
+  return node;
+}
 
-  if (node->parent_->parent_ == nullptr) {
-    return;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+std::pair<TreeNode<T, Balance> *, bool>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::InsertUniqueFrom(
+    node_type *finger, const T &data) {
+  const auto &key = KeyOf(data);
+  node_type *current = root_;
+  if (finger != nullptr && finger != nil_) {
+    current = ClimbFrom(finger, key);
+  }
+  node_type *parent = nullptr;
+  bool left = false;
+  while (current != nil_) {
+    parent = current;
+    if (Less(key, KeyOf(current->data_))) {
+      left = true;
+      current = current->left_;
+    } else if (Less(KeyOf(current->data_), key)) {
+      left = false;
+      current = current->right_;
+    } else {
+      return std::make_pair(current, false);
+    }
+  }
+  node_type *node = CreateNode(data);
+  node->left_ = nil_;
+  node->right_ = nil_;
+  node->parent_ = parent;
+  if (parent == nullptr) {
+    root_ = node;
+  } else if (left) {
+    parent->left_ = node;
+  } else {
+    parent->right_ = node;
   }
+  Balance::AfterInsert(*this, node);
+  return std::make_pair(node, true);
+}
 
-  FixInsert(node);
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename ForwardIt>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::InsertUnique(
+    ForwardIt first, ForwardIt last) {
+  size_t old_size = size_;
+  size_t count = static_cast<size_t>(std::distance(first, last));
+  if (count * kMergeDivisor < size_) {
+    node_type *finger = nullptr;
+    bool ascending = true;
+    for (; first != last; ++first) {
+      node_type *node = InsertUniqueFrom(ascending ? finger : nullptr,
+                                         *first).first;
+      ascending = ascending && (finger == nullptr ||
+                                Less(KeyOf(finger->data_), KeyOf(node->data_)));
+      finger = node;
+    }
+    return size_ - old_size;
+  }
+  s21::vector<node_type *> batch;
+  batch.reserve(count);
+  try {
+    for (; first != last; ++first) {
+      batch.push_back(CreateNode(*first));
+    }
+  } catch (...) {
+    for (size_t i = 0; i < batch.size(); ++i) {
+      DestroyNode(batch.data()[i]);
+    }
+    throw;
+  }
+  MergeAndRebuild(batch);
+  return size_ - old_size;
 }
 
-template <typename T>
-void RedBlackTree<T>::RemoveNode(Node<T> *z) {
-  Node<T> *y = z;
-  Node<T> *x;
-  Color y_original_color = y->color_;
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::RemoveNode(node_type *z) {
+  using NodeBase = typename Balance::NodeBase;
+  node_type *y = z;
+  node_type *x;
+  node_type *x_parent;
+  NodeBase y_original = *y;
 
   if (z->left_ == nil_) {
     x = z->right_;
+    x_parent = z->parent_;
     Transplant(z, z->right_);
   } else if (z->right_ == nil_) {
     x = z->left_;
+    x_parent = z->parent_;
     Transplant(z, z->left_);
   } else {
     y = MinNode(z->right_);
-    y_original_color = y->color_;
+    y_original = *y;
     x = y->right_;
     if (y->parent_ == z) {
       x->parent_ = y;
+      x_parent = y;
     } else {
+      x_parent = y->parent_;
       Transplant(y, y->right_);
       y->right_ = z->right_;
       y->right_->parent_ = y;
@@ -515,18 +1186,347 @@ void RedBlackTree<T>::RemoveNode(Node<T> *z) {
     Transplant(z, y);
     y->left_ = z->left_;
     y->left_->parent_ = y;
-    y->color_ = z->color_;
+    static_cast<NodeBase &>(*y) = *z;
   }
 
-  delete z;
+  DestroyNode(z);
 
-  if (y_original_color == Color::kBlack) {
-    FixDelete(x);
+  Balance::AfterRemove(*this, x, x_parent, y_original);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::EraseNode(node_type *node) {
+  iterator next(node, nil_);
+  ++next;
+  RemoveNode(node);
+  return next.GetNode();
+}
+
+// Walking the range costs O(k) amortized and each removal O(1) amortized
+// rotations on top of the successor search, so the total is O(k + log n).
+// Erasing everything skips the rebalancing altogether.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::EraseNodes(node_type *first,
+                                                         node_type *last) {
+  if (first == MinNode(root_) && last == nil_) {
+    ClearNodes(root_);
+    root_ = nil_;
+    return nil_;
   }
+  while (first != last) {
+    first = EraseNode(first);
+  }
+  return last;
 }
 
-template <typename T>
-void RedBlackTree<T>::Transplant(Node<T> *u, Node<T> *v) {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename Pred>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::EraseIf(Pred pred) {
+  size_t old_size = size_;
+  size_t sample = std::max<size_t>(size_ / kSweepSampleDivisor, 1);
+  size_t seen = 0;
+  size_t removed = 0;
+  node_type *node = MinNode(root_);
+  for (; node != nil_ && seen < sample; ++seen) {
+    if (pred(static_cast<const T &>(node->data_))) {
+      node = EraseNode(node);
+      ++removed;
+    } else {
+      iterator next(node, nil_);
+      node = (++next).GetNode();
+    }
+  }
+  if (node != nil_ && removed * 100 >= seen * kRebuildPercent) {
+    SweepAndRebuild(node, pred);
+    return old_size - size_;
+  }
+  while (node != nil_) {
+    if (pred(static_cast<const T &>(node->data_))) {
+      node = EraseNode(node);
+    } else {
+      iterator next(node, nil_);
+      node = (++next).GetNode();
+    }
+  }
+  return old_size - size_;
+}
+
+// Walks the tree in order with an explicit stack, asking pred about first
+// and every node after it. A node's right link is read before the node is
+// freed or reused, so the walk never looks at a freed node: doomed nodes
+// are destroyed on the spot and survivors are chained through right_ for
+// LinkBalanced. An exception from pred is rethrown once the tree is whole.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename Pred>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::SweepAndRebuild(
+    node_type *first, Pred &pred) {
+  node_type *stack[kMaxHeight];
+  size_t depth = 0;
+  for (node_type *node = root_; node != nil_; node = node->left_) {
+    stack[depth++] = node;
+  }
+  node_type *head = nil_;
+  node_type **tail = &head;
+  size_t kept = 0;
+  bool asking = false;
+  std::exception_ptr error;
+  while (depth > 0) {
+    node_type *node = stack[--depth];
+    for (node_type *child = node->right_; child != nil_;
+         child = child->left_) {
+      stack[depth++] = child;
+    }
+    asking = asking || node == first;
+    bool doomed = false;
+    if (asking) {
+      try {
+        doomed = pred(static_cast<const T &>(node->data_));
+      } catch (...) {
+        error = std::current_exception();
+        asking = false;
+        first = nullptr;
+      }
+    }
+    if (doomed) {
+      DestroyNode(node);
+    } else {
+      *tail = node;
+      tail = &node->right_;
+      ++kept;
+    }
+  }
+  *tail = nil_;
+  LinkBalanced(head, kept);
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+// Sorts the new nodes stably, so that the first of equal keys comes first,
+// and walks the tree in order as SweepAndRebuild does, chaining old and new
+// nodes through right_ in key order. New nodes whose key is already chained
+// are destroyed.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::MergeAndRebuild(
+    s21::vector<node_type *> &batch) {
+  node_type **next = batch.data();
+  node_type **batch_end = next + batch.size();
+  std::stable_sort(next, batch_end, [this](node_type *lhs, node_type *rhs) {
+    return Less(KeyOf(lhs->data_), KeyOf(rhs->data_));
+  });
+  node_type *stack[kMaxHeight];
+  size_t depth = 0;
+  for (node_type *node = root_; node != nil_; node = node->left_) {
+    stack[depth++] = node;
+  }
+  node_type *head = nil_;
+  node_type **tail = &head;
+  node_type *chained = nullptr;
+  size_t count = 0;
+  auto chain = [&](node_type *node) {
+    if (chained != nullptr &&
+        !Less(KeyOf(chained->data_), KeyOf(node->data_))) {
+      DestroyNode(node);
+      return;
+    }
+    *tail = node;
+    tail = &node->right_;
+    chained = node;
+    ++count;
+  };
+  while (depth > 0) {
+    node_type *node = stack[--depth];
+    for (node_type *child = node->right_; child != nil_;
+         child = child->left_) {
+      stack[depth++] = child;
+    }
+    for (; next != batch_end && Less(KeyOf((*next)->data_), KeyOf(node->data_));
+         ++next) {
+      chain(*next);
+    }
+    chain(node);
+  }
+  for (; next != batch_end; ++next) {
+    chain(*next);
+  }
+  *tail = nil_;
+  LinkBalanced(head, count);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename Function>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::ParallelForEach(
+    Function f, size_t threads) {
+  size_t thread_count = ParallelTasks::ThreadCount(threads);
+  s21::vector<node_type *> bounds =
+      SplitRanges(thread_count * kRangesPerThread);
+  ParallelTasks::Run(bounds.size() - 1, thread_count, [&](size_t range) {
+    WalkRange(bounds[range], bounds[range + 1],
+              [&f](node_type *node) { f(node->data_); });
+  });
+}
+
+// The partial results live in an s21::vector, so R has to be default
+// constructible as well as copyable.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename R, typename Op, typename Combine>
+R RedBlackTree<T, Compare, KeyOfValue, Balance>::ParallelReduce(
+    R identity, Op op, Combine combine, size_t threads) const {
+  size_t thread_count = ParallelTasks::ThreadCount(threads);
+  s21::vector<node_type *> bounds =
+      SplitRanges(thread_count * kRangesPerThread);
+  size_t range_count = bounds.size() - 1;
+  s21::vector<R> partials;
+  for (size_t range = 0; range < range_count; ++range) {
+    partials.push_back(identity);
+  }
+  ParallelTasks::Run(range_count, thread_count, [&](size_t range) {
+    R result = identity;
+    WalkRange(bounds[range], bounds[range + 1], [&](node_type *node) {
+      result = op(std::move(result), node->data_);
+    });
+    partials[range] = std::move(result);
+  });
+  R result = std::move(partials[0]);
+  for (size_t range = 1; range < range_count; ++range) {
+    result = combine(std::move(result), std::move(partials[range]));
+  }
+  return result;
+}
+
+// In-order boundaries of up to ranges consecutive node ranges: range i is
+// [bounds[i], bounds[i + 1]) and the last bound is nil_. The inner bounds
+// are the nodes above depth log2(ranges), so each range holds one of the
+// subtrees below them; in a balanced tree these are of similar size.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+s21::vector<TreeNode<T, Balance> *>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::SplitRanges(
+    size_t ranges) const {
+  size_t depth = 0;
+  while ((size_t(1) << depth) < ranges) {
+    ++depth;
+  }
+  s21::vector<node_type *> bounds;
+  bounds.push_back(MinNode(root_));
+  CollectBounds(root_, depth, bounds);
+  bounds.push_back(nil_);
+  return bounds;
+}
+
+// A large tree is cut into pieces in order: subtrees whose estimated size
+// is at most 1 / kPartitionPieces of a range, and the nodes above them with
+// size one. Each inner bound is then the first node of the piece where the
+// running size crosses i / count of the total, so one range is off by a few
+// pieces and a few estimation errors at most.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+s21::vector<TreeNode<T, Balance> *>
+RedBlackTree<T, Compare, KeyOfValue, Balance>::Partition(size_t count) const {
+  s21::vector<node_type *> bounds;
+  if (count == 0) {
+    return bounds;
+  }
+  bounds.reserve(count + 1);
+  bounds.push_back(MinNode(root_));
+  if (size_ <= count * kPartitionPieces) {
+    const_iterator it(MinNode(root_), nil_);
+    size_t position = 0;
+    for (size_t range = 1; range < count; ++range) {
+      for (; position < size_ * range / count; ++position) {
+        ++it;
+      }
+      bounds.push_back(it.GetNode());
+    }
+  } else {
+    s21::vector<Piece> pieces;
+    CollectPieces(root_, double(size_) / (count * kPartitionPieces), pieces);
+    double total = 0;
+    for (size_t i = 0; i < pieces.size(); ++i) {
+      total += pieces.data()[i].size;
+    }
+    double before = 0;
+    size_t piece = 0;
+    for (size_t range = 1; range < count; ++range) {
+      double target = total * range / count;
+      while (piece < pieces.size() &&
+             before + pieces.data()[piece].size / 2 < target) {
+        before += pieces.data()[piece++].size;
+      }
+      bounds.push_back(piece < pieces.size() ? pieces.data()[piece].first
+                                             : nil_);
+    }
+  }
+  bounds.push_back(nil_);
+  return bounds;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CollectPieces(
+    node_type *node, double limit, s21::vector<Piece> &pieces) const {
+  if (node == nil_) {
+    return;
+  }
+  double size = EstimateSize(node, pieces.size());
+  if (size <= limit) {
+    pieces.push_back(Piece{MinNode(node), size});
+    return;
+  }
+  CollectPieces(node->left_, limit, pieces);
+  pieces.push_back(Piece{node, 1});
+  CollectPieces(node->right_, limit, pieces);
+}
+
+// Knuth's estimate: a random path from node that doubles its weight at
+// every node with two children, summed over the path, is on average the
+// size of the subtree. The paths are pseudo-random from seed, so the same
+// shape always gives the same estimate.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+double RedBlackTree<T, Compare, KeyOfValue, Balance>::EstimateSize(
+    node_type *node, size_t seed) const {
+  double size = 0;
+  uint64_t bits = 0x9E3779B97F4A7C15ull * (seed + 1);
+  for (size_t probe = 0; probe < kPartitionProbes; ++probe) {
+    double weight = 1;
+    for (node_type *current = node; current != nil_;) {
+      size += weight;
+      bits ^= bits << 13;
+      bits ^= bits >> 7;
+      bits ^= bits << 17;
+      if (current->left_ != nil_ && current->right_ != nil_) {
+        weight *= 2;
+        current = (bits & 1) ? current->left_ : current->right_;
+      } else {
+        current = current->left_ != nil_ ? current->left_ : current->right_;
+      }
+    }
+  }
+  return size / kPartitionProbes;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CollectBounds(
+    node_type *node, size_t depth, s21::vector<node_type *> &bounds) const {
+  if (node == nil_ || depth == 0) {
+    return;
+  }
+  CollectBounds(node->left_, depth - 1, bounds);
+  bounds.push_back(node);
+  CollectBounds(node->right_, depth - 1, bounds);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+template <typename Visit>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::WalkRange(
+    node_type *first, node_type *last, Visit visit) const {
+  for (iterator it(first, nil_); it.GetNode() != last; ++it) {
+    visit(it.GetNode());
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::Transplant(
+    node_type *u, node_type *v) {
   if (u->parent_ == nullptr) {
     root_ = v;
   } else if (u == u->parent_->left_) {
@@ -537,80 +1537,336 @@ void RedBlackTree<T>::Transplant(Node<T> *u, Node<T> *v) {
   v->parent_ = u->parent_;
 }
 
-template <typename T>
-void RedBlackTree<T>::FixDelete(Node<T> *x) {
-  while (x != root_ && x->color_ == Color::kBlack) {
-    if (x == x->parent_->left_) {
-      Node<T> *w = x->parent_->right_;
-      if (w->color_ == Color::kRed) {
-        w->color_ = Color::kBlack;
-        x->parent_->color_ = Color::kRed;
-        RotateLeft(x->parent_);
-        w = x->parent_->right_;
-      }
-      if (w->left_->color_ == Color::kBlack &&
-          w->right_->color_ == Color::kBlack) {
-        w->color_ = Color::kRed;
-        x = x->parent_;
-      } else {
-        if (w->right_->color_ == Color::kBlack) {
-          w->left_->color_ = Color::kBlack;
-          w->color_ = Color::kRed;
-          RotateRight(w);
-          w = x->parent_->right_;
-        }
-        w->color_ = x->parent_->color_;
-        x->parent_->color_ = Color::kBlack;
-        w->right_->color_ = Color::kBlack;
-        RotateLeft(x->parent_);
-        x = root_;
-      }
-    } else {
-      Node<T> *w = x->parent_->left_;
-      if (w->color_ == Color::kRed) {
-        w->color_ = Color::kBlack;
-        x->parent_->color_ = Color::kRed;
-        RotateRight(x->parent_);
-        w = x->parent_->left_;
-      }
-      if (w->right_->color_ == Color::kBlack &&
-          w->left_->color_ == Color::kBlack) {
-        w->color_ = Color::kRed;
-        x = x->parent_;
-      } else {
-        if (w->left_->color_ == Color::kBlack) {
-          w->right_->color_ = Color::kBlack;
-          w->color_ = Color::kRed;
-          RotateLeft(w);
-          w = x->parent_->left_;
-        }
-        w->color_ = x->parent_->color_;
-        x->parent_->color_ = Color::kBlack;
-        w->left_->color_ = Color::kBlack;
-        RotateRight(x->parent_);
-        x = root_;
-      }
+// The new node of every old one is built first and the old node's parent
+// link is pointed at it, so that the links of the new nodes can then be
+// translated in a second pass without a lookup table
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::Compact(
+    NodeLayout layout) {
+  if (size_ == 0) {
+    return;
+  }
+  s21::vector<node_type *> order;
+  order.reserve(size_);
+  if (layout == NodeLayout::kVanEmdeBoas) {
+    CollectVanEmdeBoas(root_, GetHeight(root_), order);
+  } else {
+    for (iterator it = begin(); it != end(); ++it) {
+      order.push_back(it.GetNode());
     }
   }
-  x->color_ = Color::kBlack;
+
+  NodePool<node_type> pool;
+  pool.Reserve(size_);
+  node_type **old_nodes = order.data();
+  size_t built = 0;
+  try {
+    for (; built < size_; ++built) {
+      node_type *old_node = old_nodes[built];
+      node_type *node = new (pool.Allocate())
+          node_type(std::move_if_noexcept(old_node->data_));
+      static_cast<typename Balance::NodeBase &>(*node) = *old_node;
+      node->parent_ = old_node->parent_;
+      node->left_ = old_node->left_;
+      node->right_ = old_node->right_;
+      old_node->parent_ = node;
+    }
+  } catch (...) {
+    while (built-- > 0) {
+      node_type *node = old_nodes[built]->parent_;
+      old_nodes[built]->parent_ = node->parent_;
+      node->~node_type();
+    }
+    throw;
+  }
+
+  auto relocated = [this](node_type *link) {
+    return link == nullptr || link == nil_ ? link : link->parent_;
+  };
+  for (size_t i = 0; i < size_; ++i) {
+    node_type *node = old_nodes[i]->parent_;
+    node->parent_ = relocated(node->parent_);
+    node->left_ = relocated(node->left_);
+    node->right_ = relocated(node->right_);
+  }
+  root_ = relocated(root_);
+  last_hit_ = relocated(last_hit_);
+  nil_->parent_ = nullptr;
+  for (size_t i = 0; i < size_; ++i) {
+    old_nodes[i]->~node_type();
+  }
+  pool_.Swap(pool);
 }
 
-template <typename T>
-size_t RedBlackTree<T>::GetSize() const {
-  return GetSize(root_);
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::Reserve(size_t count) {
+  if (count > size_) {
+    pool_.Reserve(count - size_);
+  }
 }
 
-template <typename T>
-size_t RedBlackTree<T>::GetSize(Node<T> *node) const {
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::ShrinkToFit() {
+  pool_.ReleaseUnused();
+}
+
+// Lays out the top half of the levels below node first and then every
+// subtree hanging off it, each recursively in the same way
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CollectVanEmdeBoas(
+    node_type *node, size_t height, s21::vector<node_type *> &order) const {
+  if (node == nil_) {
+    return;
+  }
+  if (height == 1) {
+    order.push_back(node);
+    return;
+  }
+  size_t top = height / 2;
+  CollectVanEmdeBoas(node, top, order);
+  CollectSubtrees(node, top, height - top, order);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CollectSubtrees(
+    node_type *node, size_t depth, size_t height,
+    s21::vector<node_type *> &order) const {
+  if (node == nil_) {
+    return;
+  }
+  if (depth == 0) {
+    CollectVanEmdeBoas(node, height, order);
+    return;
+  }
+  CollectSubtrees(node->left_, depth - 1, height, order);
+  CollectSubtrees(node->right_, depth - 1, height, order);
+}
+
+// Copies the subtree of source into pool and stores it at *link, counting
+// the nodes made in count. With tasks set, the subtrees depth levels down
+// are not copied but queued, their links left at nil_. Only reads nil_ of
+// this tree, so calls on disjoint subtrees with distinct pools can run
+// concurrently.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CopyNodes(
+    node_type *source, node_type *other_nil, node_type *parent,
+    node_type **link, NodePool<node_type> &pool, size_t &count, size_t depth,
+    s21::vector<CopyTask> *tasks) {
+  *link = nil_;
+  if (source == other_nil) {
+    return;
+  }
+  if (tasks != nullptr && depth == 0) {
+    tasks->push_back(CopyTask{source, parent, link});
+    return;
+  }
+  void *slot = pool.Allocate();
+  node_type *node;
+  try {
+    node = new (slot) node_type(source->data_);
+  } catch (...) {
+    pool.Deallocate(slot);
+    throw;
+  }
+  static_cast<typename Balance::NodeBase &>(*node) = *source;
+  node->parent_ = parent;
+  node->left_ = nil_;
+  node->right_ = nil_;
+  *link = node;
+  ++count;
+  size_t next_depth = tasks != nullptr ? depth - 1 : 0;
+  CopyNodes(source->left_, other_nil, node, &node->left_, pool, count,
+            next_depth, tasks);
+  CopyNodes(source->right_, other_nil, node, &node->right_, pool, count,
+            next_depth, tasks);
+}
+
+// The task pools are spliced in even when a task throws, so that the nodes
+// already linked into the tree can be destroyed through pool_
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::CopySubtrees(
+    node_type *other_nil, s21::vector<CopyTask> &tasks, size_t threads) {
+  size_t task_count = tasks.size();
+  s21::vector<NodePool<node_type>> task_pools(task_count);
+  s21::vector<size_t> task_counts(task_count);
+  CopyTask *task_data = tasks.data();
+  NodePool<node_type> *pools = task_pools.data();
+  size_t *counts = task_counts.data();
+  auto splice = [&]() {
+    for (size_t i = 0; i < task_count; ++i) {
+      pool_.Splice(pools[i]);
+      size_ += counts[i];
+    }
+  };
+  try {
+    ParallelTasks::Run(task_count, threads, [&](size_t i) {
+      CopyNodes(task_data[i].source, other_nil, task_data[i].parent,
+                task_data[i].link, pools[i], counts[i], 0, nullptr);
+    });
+  } catch (...) {
+    splice();
+    throw;
+  }
+  splice();
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::GetSize() const {
+  return size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::GetSize(
+    node_type *node) const {
   if (node == nullptr || node == nil_) {
     return 0;
   }
   return 1 + GetSize(node->left_) + GetSize(node->right_);
 }
 
-template <typename T>
-size_t RedBlackTree<T>::GetMaxSize() const {
-  return std::numeric_limits<size_t>::max() / sizeof(Node<T>);
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::GetMaxSize() const {
+  return std::numeric_limits<size_t>::max() / sizeof(node_type);
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeNode<T, Balance>
+*RedBlackTree<T, Compare, KeyOfValue, Balance>::CreateNode(const T &data) {
+  S21_TREE_COUNT(allocations);
+  void *slot = pool_.Allocate();
+  node_type *node;
+  try {
+    node = new (slot) node_type(data);
+  } catch (...) {
+    pool_.Deallocate(slot);
+    throw;
+  }
+  ++size_;
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::DestroyNode(
+    node_type *node) {
+  S21_TREE_COUNT(deallocations);
+  if (node == last_hit_) {
+    last_hit_ = nullptr;
+  }
+  node->~node_type();
+  pool_.Deallocate(node);
+  --size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+TreeStats RedBlackTree<T, Compare, KeyOfValue, Balance>::GetStats() const {
+  TreeStats stats;
+#ifdef S21_TREE_STATS
+  stats = counters_;
+#endif
+  stats.height = GetHeight(root_);
+  stats.black_height = Balance::BlackHeight(root_, nil_);
+  stats.node_count = size_;
+  stats.bytes_used = (pool_.Capacity() + 1) * sizeof(node_type);
+  return stats;
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::ResetStats() {
+#ifdef S21_TREE_STATS
+  counters_ = TreeStats{};
+#endif
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+size_t RedBlackTree<T, Compare, KeyOfValue, Balance>::GetHeight(
+    node_type *node) const {
+  if (node == nullptr || node == nil_) {
+    return 0;
+  }
+  return 1 + std::max(GetHeight(node->left_), GetHeight(node->right_));
+}
+
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+bool RedBlackTree<T, Compare, KeyOfValue, Balance>::Validate() const {
+  if (nil_ == nullptr) {
+    return root_ == nullptr && size_ == 0;
+  }
+  if (!Balance::ValidateRoot(root_, nil_)) {
+    return false;
+  }
+  if (root_ != nil_ && root_->parent_ != nullptr) {
+    return false;
+  }
+  if (ValidateSubtree(root_, root_->parent_) < 0 || GetSize(root_) != size_) {
+    return false;
+  }
+  for (const_iterator it = begin(), prev = begin(); it != end(); prev = it++) {
+    if (comp_(KeyOf(*it), KeyOf(*prev))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Makes the count nodes of the list at head, which runs in key order
+// through right_, the whole tree
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+void RedBlackTree<T, Compare, KeyOfValue, Balance>::LinkBalanced(
+    node_type *head, size_t count) {
+  size_t full_levels = 0;
+  while ((size_t(2) << full_levels) <= count + 1) {
+    ++full_levels;
+  }
+  size_t height = 0;
+  root_ = LinkBalanced(head, count, nullptr, 0, full_levels, height);
+}
+
+// Links the first count nodes of the list at head, which runs in key order
+// through right_, into a subtree whose sibling subtrees differ in size by
+// one at most, and advances head past them. Every level above full_levels
+// is then complete.
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+typename RedBlackTree<T, Compare, KeyOfValue, Balance>::node_type *
+RedBlackTree<T, Compare, KeyOfValue, Balance>::LinkBalanced(
+    node_type *&head, size_t count, node_type *parent, size_t depth,
+    size_t full_levels, size_t &height) {
+  if (count == 0) {
+    height = 0;
+    return nil_;
+  }
+  size_t middle = count / 2;
+  size_t left_height = 0;
+  size_t right_height = 0;
+  node_type *left =
+      LinkBalanced(head, middle, nullptr, depth + 1, full_levels, left_height);
+  node_type *node = head;
+  head = node->right_;
+  node->parent_ = parent;
+  node->left_ = left;
+  if (left != nil_) {
+    left->parent_ = node;
+  }
+  node->right_ = LinkBalanced(head, count - middle - 1, node, depth + 1,
+                              full_levels, right_height);
+  height = 1 + std::max(left_height, right_height);
+  Balance::AfterBuild(node, height, depth >= full_levels);
+  return node;
+}
+
+// Returns the policy rank of the subtree (black height for red-black, height
+// for AVL), or -1 if an invariant is broken
+template <typename T, typename Compare, typename KeyOfValue, typename Balance>
+int RedBlackTree<T, Compare, KeyOfValue, Balance>::ValidateSubtree(
+    node_type *node, node_type *parent) const {
+  if (node == nil_) {
+    return 0;
+  }
+  if (node->parent_ != parent) {
+    return -1;
+  }
+  int left = ValidateSubtree(node->left_, node);
+  int right = ValidateSubtree(node->right_, node);
+  return Balance::ValidateNode(node, left, right);
 }
 
 // template <typename T>
@@ -621,7 +1877,7 @@ size_t RedBlackTree<T>::GetMaxSize() const {
 // }
 
 // template <typename T>
-// void RedBlackTree<T>::PrintHelper(Node<T> *root, std::string indent,
+// void RedBlackTree<T>::PrintHelper(node_type *root, std::string indent,
 //                                   bool last) {
 //   if (root != nil_) {
 //     std::cout << indent;
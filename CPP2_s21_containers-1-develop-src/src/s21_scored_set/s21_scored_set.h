@@ -0,0 +1,371 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SCORED_SET_SCORED_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_SCORED_SET_SCORED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_map/s21_map.h"
+#include "../s21_ranked_tree/RankedTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Orders (score, member) entries by score, then by member, so that members
+// with equal scores keep a fixed order
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+struct ScoreThenMember {
+  Compare comp;
+  ScoreCompare score_comp;
+
+  bool operator()(const std::pair<Score, Member> &lhs,
+                  const std::pair<Score, Member> &rhs) const {
+    if (score_comp(lhs.first, rhs.first)) {
+      return true;
+    }
+    if (score_comp(rhs.first, lhs.first)) {
+      return false;
+    }
+    return comp(lhs.second, rhs.second);
+  }
+};
+
+// Set of unique members, each with a score, that is also kept sorted by
+// score: a leaderboard. A map finds a member's score and an order-statistic
+// tree (see RankedTree.h) ranks the (score, member) entries, so updating a
+// score, the rank of a member and the members at a run of ranks or scores
+// all cost O(log n), plus the length of the run. Ranks are 0-based and
+// ascend with the score; members with equal scores are ranked by Compare.
+template <typename Member, typename Score, typename Compare = std::less<Member>,
+          typename ScoreCompare = std::less<Score>>
+class scored_set {
+ public:
+  using member_type = Member;
+  using score_type = Score;
+  using value_type = std::pair<Member, Score>;
+  using member_compare = Compare;
+  using score_compare = ScoreCompare;
+  using size_type = size_t;
+  using entry_type = std::pair<Score, Member>;
+  using index_type = s21::map<Member, Score, Compare>;
+  using order_type =
+      RankedTree<entry_type,
+                 ScoreThenMember<Member, Score, Compare, ScoreCompare>>;
+
+ public:
+  scored_set();
+  scored_set(std::initializer_list<value_type> const &items);
+  scored_set(const scored_set &s);
+  scored_set(scored_set &&s) noexcept;
+  ~scored_set();
+
+  scored_set &operator=(const scored_set &s);
+  scored_set &operator=(scored_set &&s) noexcept;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+
+  // Adds member unless it is present; returns whether it was added
+  bool insert(const Member &member, const Score &score);
+  // Adds member or moves it to its new score; returns whether it was added
+  bool insert_or_assign(const Member &member, const Score &score);
+  size_type erase(const Member &member);
+  void swap(scored_set &other);
+
+  // Lookup by member
+ public:
+  bool contains(const Member &member);
+  // The member's score; throws std::out_of_range if it is absent
+  const Score &at(const Member &member);
+  // Number of members ranked before member; throws std::out_of_range if
+  // it is absent
+  size_type rank(const Member &member);
+
+  // Lookup by rank and score
+ public:
+  // The members ranked [first, last), cut to the size of the set
+  s21::vector<value_type> range_by_rank(size_type first, size_type last) const;
+  // The members whose scores lie in [min, max]
+  s21::vector<value_type> range_by_score(const Score &min,
+                                         const Score &max) const;
+  size_type count_by_score(const Score &min, const Score &max) const;
+
+  // Tree diagnostics, for the score order
+ public:
+  TreeStats stats() const;
+  // Also checks that the map and the score order hold the same members
+  bool validate();
+
+ private:
+  index_type index_;
+  order_type order_;
+
+  // The ranks [first, last) of the entries scored in [min, max]
+  std::pair<size_type, size_type> ScoreRanks(const Score &min,
+                                             const Score &max) const;
+  s21::vector<value_type> Collect(size_type first, size_type last) const;
+};
+
+//////////////////////////////////////////////////////
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare>::scored_set() = default;
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare>::scored_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item.first, item.second);
+  }
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare>::scored_set(
+    const scored_set &s)
+    : index_(s.index_), order_(s.order_) {}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare>::scored_set(
+    scored_set &&s) noexcept
+    : index_(std::move(s.index_)), order_(std::move(s.order_)) {}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare>::~scored_set() = default;
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare> &
+scored_set<Member, Score, Compare, ScoreCompare>::operator=(
+    const scored_set &s) {
+  if (this != &s) {
+    scored_set copy(s);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+scored_set<Member, Score, Compare, ScoreCompare> &
+scored_set<Member, Score, Compare, ScoreCompare>::operator=(
+    scored_set &&s) noexcept {
+  if (this != &s) {
+    clear();
+    swap(s);
+  }
+  return *this;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+bool scored_set<Member, Score, Compare, ScoreCompare>::empty() const {
+  return order_.GetSize() == 0;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+typename scored_set<Member, Score, Compare, ScoreCompare>::size_type
+scored_set<Member, Score, Compare, ScoreCompare>::size() const {
+  return order_.GetSize();
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+typename scored_set<Member, Score, Compare, ScoreCompare>::size_type
+scored_set<Member, Score, Compare, ScoreCompare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         (sizeof(typename order_type::node_type) +
+          sizeof(typename index_type::tree_type::node_type));
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+void scored_set<Member, Score, Compare, ScoreCompare>::clear() {
+  index_.clear();
+  order_.Clear();
+}
+
+// If the score order cannot take the entry, the member leaves the map again
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+bool scored_set<Member, Score, Compare, ScoreCompare>::insert(
+    const Member &member, const Score &score) {
+  auto result = index_.insert(member, score);
+  if (!result.second) {
+    return false;
+  }
+  try {
+    order_.Insert(entry_type(score, member));
+  } catch (...) {
+    index_.erase(result.first);
+    throw;
+  }
+  return true;
+}
+
+// The new entry goes in before the old one comes out, so a throwing copy
+// leaves the member at its old score
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+bool scored_set<Member, Score, Compare, ScoreCompare>::insert_or_assign(
+    const Member &member, const Score &score) {
+  auto it = index_.find(member);
+  if (it == index_.end()) {
+    return insert(member, score);
+  }
+  ScoreCompare score_comp;
+  if (score_comp(it->second, score) || score_comp(score, it->second)) {
+    order_.Insert(entry_type(score, member));
+    order_.Erase(entry_type(it->second, member));
+    it->second = score;
+  }
+  return false;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+typename scored_set<Member, Score, Compare, ScoreCompare>::size_type
+scored_set<Member, Score, Compare, ScoreCompare>::erase(const Member &member) {
+  auto it = index_.find(member);
+  if (it == index_.end()) {
+    return 0;
+  }
+  order_.Erase(entry_type(it->second, member));
+  index_.erase(it);
+  return 1;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+void scored_set<Member, Score, Compare, ScoreCompare>::swap(scored_set &other) {
+  index_.swap(other.index_);
+  order_.Swap(other.order_);
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+bool scored_set<Member, Score, Compare, ScoreCompare>::contains(
+    const Member &member) {
+  return index_.contains(member);
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+const Score &scored_set<Member, Score, Compare, ScoreCompare>::at(
+    const Member &member) {
+  return index_.at(member);
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+typename scored_set<Member, Score, Compare, ScoreCompare>::size_type
+scored_set<Member, Score, Compare, ScoreCompare>::rank(const Member &member) {
+  return order_.Rank(entry_type(index_.at(member), member));
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+s21::vector<
+    typename scored_set<Member, Score, Compare, ScoreCompare>::value_type>
+scored_set<Member, Score, Compare, ScoreCompare>::range_by_rank(
+    size_type first, size_type last) const {
+  return Collect(first, std::min(last, size()));
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+s21::vector<
+    typename scored_set<Member, Score, Compare, ScoreCompare>::value_type>
+scored_set<Member, Score, Compare, ScoreCompare>::range_by_score(
+    const Score &min, const Score &max) const {
+  std::pair<size_type, size_type> ranks = ScoreRanks(min, max);
+  return Collect(ranks.first, ranks.second);
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+typename scored_set<Member, Score, Compare, ScoreCompare>::size_type
+scored_set<Member, Score, Compare, ScoreCompare>::count_by_score(
+    const Score &min, const Score &max) const {
+  std::pair<size_type, size_type> ranks = ScoreRanks(min, max);
+  return ranks.second - ranks.first;
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+TreeStats scored_set<Member, Score, Compare, ScoreCompare>::stats() const {
+  return order_.GetStats();
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+bool scored_set<Member, Score, Compare, ScoreCompare>::validate() {
+  if (!order_.Validate() || index_.size() != order_.GetSize()) {
+    return false;
+  }
+  ScoreCompare score_comp;
+  for (const auto &item : index_) {
+    entry_type entry(item.second, item.first);
+    size_type rank = order_.Rank(entry);
+    if (rank == order_.GetSize()) {
+      return false;
+    }
+    const entry_type &found = order_.Select(rank);
+    if (score_comp(found.first, entry.first) ||
+        score_comp(entry.first, found.first) ||
+        Compare()(found.second, entry.second) ||
+        Compare()(entry.second, found.second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Both bounds are partition points of the score order: the entries scored
+// below min, and the entries scored at most max
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+std::pair<typename scored_set<Member, Score, Compare, ScoreCompare>::size_type,
+          typename scored_set<Member, Score, Compare, ScoreCompare>::size_type>
+scored_set<Member, Score, Compare, ScoreCompare>::ScoreRanks(
+    const Score &min, const Score &max) const {
+  ScoreCompare score_comp;
+  size_type first = order_.PartitionPoint([&](const entry_type &entry) {
+    return score_comp(entry.first, min);
+  });
+  size_type last = order_.PartitionPoint([&](const entry_type &entry) {
+    return !score_comp(max, entry.first);
+  });
+  return std::make_pair(first, std::max(first, last));
+}
+
+template <typename Member, typename Score, typename Compare,
+          typename ScoreCompare>
+s21::vector<
+    typename scored_set<Member, Score, Compare, ScoreCompare>::value_type>
+scored_set<Member, Score, Compare, ScoreCompare>::Collect(
+    size_type first, size_type last) const {
+  s21::vector<value_type> result;
+  if (first < last) {
+    result.reserve(last - first);
+    order_.VisitRange(first, last, [&result](const entry_type &entry) {
+      result.push_back(value_type(entry.second, entry.first));
+    });
+  }
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SCORED_SET_SCORED_SET_H_
@@ -3,20 +3,25 @@
 
 #include <iostream>
 
+#include "../s21_frozen_set/s21_frozen_set.h"
 #include "../s21_red_black_tree/RedBlackTree.h"
 #include "../s21_vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          typename Balance = RedBlackBalance>
 class set {
  public:
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RedBlackTree<value_type>::iterator;
-  using const_iterator = typename RedBlackTree<value_type>::const_iterator;
+  using tree_type = RedBlackTree<value_type, key_compare, Identity<value_type>,
+                                 Balance>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   // Set Constructors and operators
@@ -24,11 +29,14 @@ class set {
   set();
   set(std::initializer_list<value_type> const &items);
   set(const set &s);
+  // Copies s on up to threads threads (0: one per core), see
+  // RedBlackTree(const RedBlackTree &, size_t)
+  set(const set &s, size_t threads);
   set(set &&s) noexcept;
   ~set();
 
-  set<Key> &operator=(const set &s);
-  set<Key> &operator=(set &&s);
+  set<Key, Compare, Balance> &operator=(const set &s);
+  set<Key, Compare, Balance> &operator=(set &&s);
 
   // Set Main Iterators
  public:
@@ -42,54 +50,156 @@ class set {
   size_type max_size();
 
   void clear();
+  // Like clear, but O(1): the elements are destroyed and their memory is
+  // freed later on a background thread, see Reclaimer
+  void clear_async();
   std::pair<iterator, bool> insert(const value_type &value);
-  iterator find(const Key &key);
-  void erase(iterator pos);
+  // Inserts the keys of [first, last) whose keys are not present yet,
+  // one by one for a small batch and by merging a large one with the
+  // contents in one pass (see RedBlackTree::InsertUnique)
+  template <typename ForwardIt>
+  ForwardIteratorT<ForwardIt, void> insert(ForwardIt first, ForwardIt last);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
   void swap(set &other);
+  // Removes the elements pred(const value_type &) holds for and returns
+  // how many went, rebuilding the tree in one pass when that is cheaper
+  // (see RedBlackTree::EraseIf)
+  template <typename K, typename C, typename B, typename Pred>
+  friend size_t erase_if(set<K, C, B> &s, Pred pred);
   void merge(set &other);
-  bool contains(const Key &key);
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  // Batched lookup of the keys in [first, last): writes one iterator (end()
+  // on a miss) or one bool per key to out, in order, and returns the
+  // advanced out. Faster than a find() loop on batches of dozens of keys.
+ public:
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out);
+
+  // Immutable, read-optimized snapshot of the current contents
+ public:
+  frozen_set<Key, Compare> freeze() const;
+
+  // Parallel traversal on up to threads threads (0: one per core), see
+  // RedBlackTree::ParallelForEach. f runs concurrently on different
+  // elements in no particular order; parallel_reduce folds with op from
+  // identity, which must be an identity of op, and combines in key order.
+ public:
+  template <typename Function>
+  void parallel_for_each(Function f, size_t threads = 0);
+  // The three-argument reduce also combines the partial results with op.
+  template <typename R, typename Op>
+  R parallel_reduce(R identity, Op op, size_t threads = 0) const;
+  template <typename R, typename Op, typename Combine>
+  R parallel_reduce(R identity, Op op, Combine combine,
+                    size_t threads) const;
+  // Splits the set into k consecutive ranges [first, last) of roughly
+  // equal size without visiting or copying the elements, for handing one
+  // range to each worker of a thread pool (see RedBlackTree::Partition)
+  s21::vector<std::pair<iterator, iterator>> partition(size_type k);
+
+  // Memory layout
+ public:
+  // Moves every node into one contiguous block, laid out in key order or
+  // in van Emde Boas order, to restore locality after heavy churn. The
+  // elements are unchanged; iterators and references are invalidated.
+  void compact(NodeLayout layout = NodeLayout::kInOrder);
+  // Preallocates node storage for size elements in one block, so that
+  // inserting up to that many allocates nothing; shrink_to_fit frees the
+  // storage no element uses any more. clear() frees all of it.
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  // Localized lookups
+ public:
+  // Searches from finger rather than from the root, in O(log d) for a key
+  // d elements away; finger may be end()
+  iterator find_from(iterator finger, const Key &key);
+  // With the cache on, find, contains and erase by key first check the
+  // element found last and otherwise search from it, which suits
+  // sequential and clustered access. Off by default; while on, lookups on
+  // the same set must not run concurrently.
+  void set_lookup_cache(bool enabled);
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
+  // Set Lookup
+ public:
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  size_type count(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+  // Heterogeneous lookup, available when Compare::is_transparent is defined
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> find(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, bool> contains(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> count(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> lower_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, iterator> upper_bound(const K &key);
+  template <typename K>
+  TransparentLookupT<Compare, K, size_type> erase(const K &key);
+
  private:
-  RedBlackTree<value_type> tree_;
-  iterator FindByKey(const Key &key);
+  tree_type tree_;
+  template <typename K>
+  iterator FindByKey(const K &key);
+  template <typename K>
+  size_type EraseByKey(const K &key);
   iterator GetMinKey();
 };
 
-template <typename Key>
-set<Key>::set() = default;
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::set() = default;
 
-template <typename Key>
-set<Key>::set(
-    std::initializer_list<typename set<Key>::value_type> const &items) {
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::set(
+    std::initializer_list<value_type> const &items) {
   for (const auto &item : items) {
     insert(item);
   }
 }
 
-template <typename Key>
-set<Key>::set(const set &s) : tree_(s.tree_) {}
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::set(const set &s) : tree_(s.tree_) {}
 
-template <typename Key>
-set<Key>::set(set &&s) noexcept {
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::set(const set &s, size_t threads)
+    : tree_(s.tree_, threads) {}
+
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::set(set &&s) noexcept {
   this->tree_ = std::move(s.tree_);
 }
 
-template <typename Key>
-set<Key>::~set() = default;
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance>::~set() = default;
 
-template <typename Key>
-set<Key> &set<Key>::operator=(const set &s) {
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance> &set<Key, Compare, Balance>::operator=(
+    const set &s) {
   if (this != &s) {
     tree_ = s.tree_;
   }
   return *this;
 }
 
-template <typename Key>
-set<Key> &set<Key>::operator=(set &&s) {
+template <typename Key, typename Compare, typename Balance>
+set<Key, Compare, Balance> &set<Key, Compare, Balance>::operator=(set &&s) {
   if (this != &s) {
     tree_.ClearNodes(tree_.GetRoot());
     tree_ = std::move(s.tree_);
@@ -97,61 +207,77 @@ set<Key> &set<Key>::operator=(set &&s) {
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::begin() {
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::begin() {
   return GetMinKey();
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::end() {
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::end() {
   return iterator(tree_.GetNil(), tree_.GetNil());
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::find(const Key &key) {
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::find(const Key &key) {
   return FindByKey(key);
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::FindByKey(const Key &key) {
-  iterator it;
-  for (it = begin(); it != end(); ++it) {
-    if (*it == key) {
-      return it;
-    }
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename set<Key, Compare, Balance>::iterator>
+set<Key, Compare, Balance>::find(const K &key) {
+  return FindByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::FindByKey(const K &key) {
+  auto *node = tree_.LookupNode(key);
+  if (node == nullptr) {
+    return end();
   }
-  return end();
+  return iterator(node, tree_.GetNil());
 }
 
-template <typename Key>
-bool set<Key>::empty() {
+template <typename Key, typename Compare, typename Balance>
+bool set<Key, Compare, Balance>::empty() {
   return begin() == end();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::size() {
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::size_type
+set<Key, Compare, Balance>::size() {
   return tree_.GetSize();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::max_size() {
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::size_type
+set<Key, Compare, Balance>::max_size() {
   return tree_.GetMaxSize();
 }
 
-template <typename Key>
-void set<Key>::clear() {
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::clear() {
   tree_.ClearNodes(tree_.GetRoot());
   tree_.SetRoot(tree_.GetNil());
 }
 
-template <typename Key>
-std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
-    const value_type &value) {
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::clear_async() {
+  tree_.ClearAsync();
+}
+
+template <typename Key, typename Compare, typename Balance>
+std::pair<typename set<Key, Compare, Balance>::iterator, bool>
+set<Key, Compare, Balance>::insert(const value_type &value) {
   iterator it = find(value);
   bool flag = true;
   if (it == end()) {
-    tree_.Insert(value);
-    it = find(value);
+    it = iterator(tree_.Insert(value), tree_.GetNil());
     flag = true;
   } else {
     flag = false;
@@ -159,10 +285,17 @@ std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
   return std::make_pair(it, flag);
 }
 
-template <typename Key>
+template <typename Key, typename Compare, typename Balance>
+template <typename ForwardIt>
+ForwardIteratorT<ForwardIt, void> set<Key, Compare, Balance>::insert(
+    ForwardIt first, ForwardIt last) {
+  tree_.InsertUnique(first, last);
+}
+
+template <typename Key, typename Compare, typename Balance>
 template <typename... Args>
-s21::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args &&...args) {
+s21::vector<std::pair<typename set<Key, Compare, Balance>::iterator, bool>>
+set<Key, Compare, Balance>::insert_many(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result_vector;
   s21::vector<value_type> new_vector;
 
@@ -175,21 +308,51 @@ s21::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
   return result_vector;
 }
 
-template <typename Key>
-void set<Key>::erase(iterator pos) {
-  iterator it = find(*pos);
-  if (it != end()) {
-    tree_.RemoveNode(tree_.FindNode(*it));
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::erase(iterator pos) {
+  return iterator(tree_.EraseNode(pos.GetNode()), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::erase(iterator first, iterator last) {
+  return iterator(tree_.EraseNodes(first.GetNode(), last.GetNode()),
+                  tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::size_type
+set<Key, Compare, Balance>::erase(const Key &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename set<Key, Compare, Balance>::size_type>
+set<Key, Compare, Balance>::erase(const K &key) {
+  return EraseByKey(key);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+typename set<Key, Compare, Balance>::size_type
+set<Key, Compare, Balance>::EraseByKey(const K &key) {
+  auto *node = tree_.LookupNode(key);
+  if (node == nullptr) {
+    return 0;
   }
+  tree_.RemoveNode(node);
+  return 1;
 }
 
-template <typename Key>
-void set<Key>::swap(set &other) {
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::swap(set &other) {
   std::swap(tree_, other.tree_);
 }
 
-template <typename Key>
-void set<Key>::merge(set &other) {
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::merge(set &other) {
   iterator it = other.begin();
   while (it != other.end()) {
     iterator next = std::next(it);
@@ -200,18 +363,169 @@ void set<Key>::merge(set &other) {
   }
 }
 
-template <typename Key>
-bool set<Key>::contains(const Key &key) {
-  iterator it = find(key);
-  bool result = !(it == end());
-  return result;
+template <typename Key, typename Compare, typename Balance>
+bool set<Key, Compare, Balance>::contains(const Key &key) {
+  return tree_.LookupNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, bool> set<Key, Compare, Balance>::contains(
+    const K &key) {
+  return tree_.LookupNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::size_type
+set<Key, Compare, Balance>::count(const Key &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename set<Key, Compare, Balance>::size_type>
+set<Key, Compare, Balance>::count(const K &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::lower_bound(const Key &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename set<Key, Compare, Balance>::iterator>
+set<Key, Compare, Balance>::lower_bound(const K &key) {
+  return iterator(tree_.LowerBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::upper_bound(const Key &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::GetMinKey() {
+template <typename Key, typename Compare, typename Balance>
+template <typename K>
+TransparentLookupT<Compare, K, typename set<Key, Compare, Balance>::iterator>
+set<Key, Compare, Balance>::upper_bound(const K &key) {
+  return iterator(tree_.UpperBoundNode(key), tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::GetMinKey() {
   return iterator(tree_.MinNode(tree_.GetRoot()), tree_.GetNil());
 }
 
+template <typename Key, typename Compare, typename Balance>
+template <typename ForwardIt, typename OutputIt>
+OutputIt set<Key, Compare, Balance>::find_many(ForwardIt first,
+                                               ForwardIt last, OutputIt out) {
+  tree_.FindNodes(first, last, [this, &out](auto *node) {
+    *out++ = node == nullptr ? end() : iterator(node, tree_.GetNil());
+  });
+  return out;
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename ForwardIt, typename OutputIt>
+OutputIt set<Key, Compare, Balance>::contains_many(ForwardIt first,
+                                                   ForwardIt last,
+                                                   OutputIt out) {
+  tree_.FindNodes(first, last,
+                  [&out](auto *node) { *out++ = node != nullptr; });
+  return out;
+}
+
+template <typename Key, typename Compare, typename Balance>
+frozen_set<Key, Compare> set<Key, Compare, Balance>::freeze() const {
+  return frozen_set<Key, Compare>(tree_.begin(), tree_.GetSize());
+}
+
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::compact(NodeLayout layout) {
+  tree_.Compact(layout);
+}
+
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::reserve(size_type size) {
+  tree_.Reserve(size);
+}
+
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::shrink_to_fit() {
+  tree_.ShrinkToFit();
+}
+
+template <typename Key, typename Compare, typename Balance>
+typename set<Key, Compare, Balance>::iterator
+set<Key, Compare, Balance>::find_from(iterator finger, const Key &key) {
+  auto *node = tree_.FindNodeFrom(finger.GetNode(), key);
+  if (node == nullptr) {
+    return end();
+  }
+  return iterator(node, tree_.GetNil());
+}
+
+template <typename Key, typename Compare, typename Balance>
+void set<Key, Compare, Balance>::set_lookup_cache(bool enabled) {
+  tree_.SetLookupCache(enabled);
+}
+
+template <typename Key, typename Compare, typename Balance>
+TreeStats set<Key, Compare, Balance>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename Compare, typename Balance>
+bool set<Key, Compare, Balance>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename Function>
+void set<Key, Compare, Balance>::parallel_for_each(Function f,
+                                                   size_t threads) {
+  tree_.ParallelForEach(f, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename R, typename Op>
+R set<Key, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                              size_t threads) const {
+  return tree_.ParallelReduce(identity, op, op, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+template <typename R, typename Op, typename Combine>
+R set<Key, Compare, Balance>::parallel_reduce(R identity, Op op,
+                                              Combine combine,
+                                              size_t threads) const {
+  return tree_.ParallelReduce(identity, op, combine, threads);
+}
+
+template <typename Key, typename Compare, typename Balance>
+s21::vector<std::pair<typename set<Key, Compare, Balance>::iterator,
+                      typename set<Key, Compare, Balance>::iterator>>
+set<Key, Compare, Balance>::partition(size_type k) {
+  s21::vector<typename tree_type::node_type *> bounds = tree_.Partition(k);
+  s21::vector<std::pair<iterator, iterator>> ranges;
+  ranges.reserve(k);
+  for (size_type i = 0; i < k; ++i) {
+    ranges.push_back(std::make_pair(iterator(bounds[i], tree_.GetNil()),
+                                    iterator(bounds[i + 1], tree_.GetNil())));
+  }
+  return ranges;
+}
+
+template <typename Key, typename Compare, typename Balance, typename Pred>
+size_t erase_if(set<Key, Compare, Balance> &s, Pred pred) {
+  return s.tree_.EraseIf(pred);
+}
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_SET_H_
\ No newline at end of file
@@ -0,0 +1,305 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SMALL_MAP_SMALL_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_SMALL_MAP_SMALL_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_small_tree/SmallTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// map with the small-size optimization: up to N pairs are kept inline (see
+// SmallTree.h), so a map that stays that small never touches the heap.
+template <typename Key, typename T, size_t N = 8,
+          typename Compare = std::less<Key>>
+class small_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type =
+      SmallTree<value_type, N, key_compare, SelectFirst<value_type>>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  small_map();
+  small_map(std::initializer_list<value_type> const &items);
+  small_map(const small_map &m);
+  small_map(small_map &&m) noexcept;
+  ~small_map();
+
+  small_map &operator=(const small_map &m);
+  small_map &operator=(small_map &&m) noexcept;
+  T &at(const Key &key);
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key);
+
+ public:
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // True while the pairs are still stored inline
+  bool is_inline() const;
+  void clear();
+
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(small_map &other);
+  void merge(small_map &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ public:
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+ private:
+  tree_type tree_;
+};
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare>::small_map() = default;
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare>::small_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare>::small_map(const small_map &m)
+    : tree_(m.tree_) {}
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare>::small_map(small_map &&m) noexcept
+    : tree_(std::move(m.tree_)) {}
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare>::~small_map() = default;
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare> &small_map<Key, T, N, Compare>::operator=(
+    const small_map &m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+small_map<Key, T, N, Compare> &small_map<Key, T, N, Compare>::operator=(
+    small_map &&m) noexcept {
+  tree_ = std::move(m.tree_);
+  return *this;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+T &small_map<Key, T, N, Compare>::at(const Key &key) {
+  iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+const T &small_map<Key, T, N, Compare>::at(const Key &key) const {
+  const_iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+T &small_map<Key, T, N, Compare>::operator[](const Key &key) {
+  iterator it = find(key);
+  if (it == end()) {
+    it = insert(std::make_pair(key, mapped_type())).first;
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::iterator
+small_map<Key, T, N, Compare>::begin() {
+  return tree_.begin();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::iterator
+small_map<Key, T, N, Compare>::end() {
+  return tree_.end();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::const_iterator
+small_map<Key, T, N, Compare>::begin() const {
+  return tree_.begin();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::const_iterator
+small_map<Key, T, N, Compare>::end() const {
+  return tree_.end();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+bool small_map<Key, T, N, Compare>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::size_type
+small_map<Key, T, N, Compare>::size() const {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::size_type
+small_map<Key, T, N, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         sizeof(TreeNode<value_type, RedBlackBalance>);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+bool small_map<Key, T, N, Compare>::is_inline() const {
+  return tree_.IsInline();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+void small_map<Key, T, N, Compare>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+std::pair<typename small_map<Key, T, N, Compare>::iterator, bool>
+small_map<Key, T, N, Compare>::insert(const value_type &value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+std::pair<typename small_map<Key, T, N, Compare>::iterator, bool>
+small_map<Key, T, N, Compare>::insert(const Key &key, const T &obj) {
+  return tree_.Insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+std::pair<typename small_map<Key, T, N, Compare>::iterator, bool>
+small_map<Key, T, N, Compare>::insert_or_assign(const Key &key,
+                                                const T &obj) {
+  iterator it = find(key);
+  if (it != end()) {
+    it->second = obj;
+    return std::make_pair(it, false);
+  }
+  return insert(key, obj);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+void small_map<Key, T, N, Compare>::erase(iterator pos) {
+  tree_.Erase(pos->first);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::size_type
+small_map<Key, T, N, Compare>::erase(const Key &key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+void small_map<Key, T, N, Compare>::swap(small_map &other) {
+  tree_.Swap(other.tree_);
+}
+
+// As in small_set::merge, the pairs that stay behind are collected into a
+// new container instead of being erased from other mid-walk.
+template <typename Key, typename T, size_t N, typename Compare>
+void small_map<Key, T, N, Compare>::merge(small_map &other) {
+  if (this == &other) {
+    return;
+  }
+  tree_type remaining;
+  for (const auto &item : other) {
+    if (!insert(item).second) {
+      remaining.Insert(item);
+    }
+  }
+  other.tree_ = std::move(remaining);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename small_map<Key, T, N, Compare>::iterator, bool>>
+small_map<Key, T, N, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  std::initializer_list<value_type> init_list = {std::forward<Args>(args)...};
+
+  for (const auto &item : init_list) {
+    result_vector.push_back(insert(item));
+  }
+  return result_vector;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::iterator
+small_map<Key, T, N, Compare>::find(const Key &key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::const_iterator
+small_map<Key, T, N, Compare>::find(const Key &key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+bool small_map<Key, T, N, Compare>::contains(const Key &key) const {
+  return tree_.Find(key) != tree_.end();
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::size_type
+small_map<Key, T, N, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::iterator
+small_map<Key, T, N, Compare>::lower_bound(const Key &key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, size_t N, typename Compare>
+typename small_map<Key, T, N, Compare>::iterator
+small_map<Key, T, N, Compare>::upper_bound(const Key &key) {
+  return tree_.UpperBound(key);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SMALL_MAP_SMALL_MAP_H_
@@ -0,0 +1,252 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SMALL_SET_SMALL_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_SMALL_SET_SMALL_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "../s21_small_tree/SmallTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// set with the small-size optimization: up to N keys are kept inline (see
+// SmallTree.h), so a set that stays that small never touches the heap.
+template <typename Key, size_t N = 8, typename Compare = std::less<Key>>
+class small_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = SmallTree<value_type, N, key_compare, Identity<value_type>>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  small_set();
+  small_set(std::initializer_list<value_type> const &items);
+  small_set(const small_set &s);
+  small_set(small_set &&s) noexcept;
+  ~small_set();
+
+  small_set &operator=(const small_set &s);
+  small_set &operator=(small_set &&s) noexcept;
+
+ public:
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // True while the keys are still stored inline
+  bool is_inline() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(small_set &other);
+  void merge(small_set &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ public:
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+ private:
+  tree_type tree_;
+};
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare>::small_set() = default;
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare>::small_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare>::small_set(const small_set &s) : tree_(s.tree_) {}
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare>::small_set(small_set &&s) noexcept
+    : tree_(std::move(s.tree_)) {}
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare>::~small_set() = default;
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare> &small_set<Key, N, Compare>::operator=(
+    const small_set &s) {
+  tree_ = s.tree_;
+  return *this;
+}
+
+template <typename Key, size_t N, typename Compare>
+small_set<Key, N, Compare> &small_set<Key, N, Compare>::operator=(
+    small_set &&s) noexcept {
+  tree_ = std::move(s.tree_);
+  return *this;
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::iterator
+small_set<Key, N, Compare>::begin() {
+  return tree_.begin();
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::iterator
+small_set<Key, N, Compare>::end() {
+  return tree_.end();
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::const_iterator
+small_set<Key, N, Compare>::begin() const {
+  return tree_.begin();
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::const_iterator
+small_set<Key, N, Compare>::end() const {
+  return tree_.end();
+}
+
+template <typename Key, size_t N, typename Compare>
+bool small_set<Key, N, Compare>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::size_type
+small_set<Key, N, Compare>::size() const {
+  return tree_.GetSize();
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::size_type
+small_set<Key, N, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         sizeof(TreeNode<value_type, RedBlackBalance>);
+}
+
+template <typename Key, size_t N, typename Compare>
+bool small_set<Key, N, Compare>::is_inline() const {
+  return tree_.IsInline();
+}
+
+template <typename Key, size_t N, typename Compare>
+void small_set<Key, N, Compare>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, size_t N, typename Compare>
+std::pair<typename small_set<Key, N, Compare>::iterator, bool>
+small_set<Key, N, Compare>::insert(const value_type &value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, size_t N, typename Compare>
+void small_set<Key, N, Compare>::erase(iterator pos) {
+  tree_.Erase(*pos);
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::size_type
+small_set<Key, N, Compare>::erase(const Key &key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, size_t N, typename Compare>
+void small_set<Key, N, Compare>::swap(small_set &other) {
+  tree_.Swap(other.tree_);
+}
+
+// Erasing from other while walking it would shift its inline keys under the
+// iterator, so the keys that stay behind are collected into a new set.
+template <typename Key, size_t N, typename Compare>
+void small_set<Key, N, Compare>::merge(small_set &other) {
+  if (this == &other) {
+    return;
+  }
+  tree_type remaining;
+  for (const auto &item : other) {
+    if (!insert(item).second) {
+      remaining.Insert(item);
+    }
+  }
+  other.tree_ = std::move(remaining);
+}
+
+template <typename Key, size_t N, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename small_set<Key, N, Compare>::iterator, bool>>
+small_set<Key, N, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  s21::vector<value_type> new_vector;
+
+  (new_vector.push_back(std::forward<Args>(args)), ...);
+
+  for (size_t i = 0; i < sizeof...(args); ++i) {
+    auto result = insert(new_vector[i]);
+    result_vector.push_back(result);
+  }
+  return result_vector;
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::iterator small_set<Key, N, Compare>::find(
+    const Key &key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::const_iterator
+small_set<Key, N, Compare>::find(const Key &key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, size_t N, typename Compare>
+bool small_set<Key, N, Compare>::contains(const Key &key) const {
+  return tree_.Find(key) != tree_.end();
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::size_type
+small_set<Key, N, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::iterator
+small_set<Key, N, Compare>::lower_bound(const Key &key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, size_t N, typename Compare>
+typename small_set<Key, N, Compare>::iterator
+small_set<Key, N, Compare>::upper_bound(const Key &key) {
+  return tree_.UpperBound(key);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SMALL_SET_SMALL_SET_H_
@@ -0,0 +1,428 @@
+#ifndef CPP2_S21_CONTAINERS_1_SMALL_TREE_H_
+#define CPP2_S21_CONTAINERS_1_SMALL_TREE_H_
+
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_red_black_tree/RedBlackTree.h"
+
+namespace s21 {
+
+// Points either into the inline array (slot_ != nullptr) or at a tree node
+template <typename T, bool IsConst>
+class SmallTreeIteratorBase {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = T;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+  using tree_iterator = RedBlackTreeIteratorBase<T, IsConst>;
+
+ public:
+  SmallTreeIteratorBase() = default;
+  explicit SmallTreeIteratorBase(pointer slot) : slot_(slot){};
+  explicit SmallTreeIteratorBase(tree_iterator node) : node_(node){};
+  SmallTreeIteratorBase(Node<T> *node, Node<T> *nil) : node_(node, nil){};
+
+ public:
+  reference operator*() const { return slot_ != nullptr ? *slot_ : *node_; }
+  pointer operator->() const { return &**this; }
+
+  SmallTreeIteratorBase &operator++();
+  SmallTreeIteratorBase &operator--();
+  SmallTreeIteratorBase operator++(int);
+  SmallTreeIteratorBase operator--(int);
+
+  bool operator==(const SmallTreeIteratorBase &other) const;
+  bool operator!=(const SmallTreeIteratorBase &other) const;
+
+ private:
+  pointer slot_ = nullptr;
+  tree_iterator node_{};
+};
+
+// Sorted container of unique keys backing small_set and small_map. Up to N
+// values live in an inline, sorted array searched linearly, so a container
+// that never grows past N allocates nothing. The first insert beyond N
+// moves everything into a heap-allocated RedBlackTree, which then stays in
+// use until clear().
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+class SmallTree {
+  static_assert(N > 0, "SmallTree needs room for at least one element");
+
+ public:
+  using tree_type = RedBlackTree<T, Compare, KeyOfValue>;
+  using iterator = SmallTreeIteratorBase<T, false>;
+  using const_iterator = SmallTreeIteratorBase<T, true>;
+
+ public:
+  SmallTree() = default;
+  SmallTree(const SmallTree &other);
+  SmallTree(SmallTree &&other) noexcept;
+  ~SmallTree();
+
+  SmallTree &operator=(const SmallTree &other);
+  SmallTree &operator=(SmallTree &&other) noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  size_t GetSize() const;
+  // False once the elements have moved to the tree
+  bool IsInline() const { return tree_ == nullptr; }
+
+  void Clear();
+  std::pair<iterator, bool> Insert(const T &value);
+  template <typename K>
+  size_t Erase(const K &key);
+  void Swap(SmallTree &other);
+
+  template <typename K>
+  iterator Find(const K &key);
+  template <typename K>
+  const_iterator Find(const K &key) const;
+  template <typename K>
+  iterator LowerBound(const K &key);
+  template <typename K>
+  iterator UpperBound(const K &key);
+
+ private:
+  alignas(T) unsigned char buffer_[sizeof(T) * N];
+  size_t size_ = 0;  // inline element count, unused once promoted
+  tree_type *tree_ = nullptr;
+  Compare comp_;
+
+  T *Slots() { return reinterpret_cast<T *>(buffer_); }
+  const T *Slots() const { return reinterpret_cast<const T *>(buffer_); }
+  static const auto &KeyOf(const T &value) { return KeyOfValue()(value); }
+
+  template <typename K>
+  size_t InlineLowerBound(const K &key) const;
+  template <typename K>
+  size_t InlineUpperBound(const K &key) const;
+  void MoveSlot(size_t from, size_t to);
+  void Promote();
+  void StealFrom(SmallTree &other);
+};
+
+//////////////////////////////////////////////////////
+
+// For SmallTreeIteratorBase
+template <typename T, bool IsConst>
+SmallTreeIteratorBase<T, IsConst> &SmallTreeIteratorBase<T, IsConst>::
+operator++() {
+  if (slot_ != nullptr) {
+    ++slot_;
+  } else {
+    ++node_;
+  }
+  return *this;
+}
+
+template <typename T, bool IsConst>
+SmallTreeIteratorBase<T, IsConst> &SmallTreeIteratorBase<T, IsConst>::
+operator--() {
+  if (slot_ != nullptr) {
+    --slot_;
+  } else {
+    --node_;
+  }
+  return *this;
+}
+
+template <typename T, bool IsConst>
+SmallTreeIteratorBase<T, IsConst> SmallTreeIteratorBase<T, IsConst>::
+operator++(int) {
+  SmallTreeIteratorBase temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename T, bool IsConst>
+SmallTreeIteratorBase<T, IsConst> SmallTreeIteratorBase<T, IsConst>::
+operator--(int) {
+  SmallTreeIteratorBase temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename T, bool IsConst>
+bool SmallTreeIteratorBase<T, IsConst>::operator==(
+    const SmallTreeIteratorBase &other) const {
+  if (slot_ != nullptr || other.slot_ != nullptr) {
+    return slot_ == other.slot_;
+  }
+  return node_ == other.node_;
+}
+
+template <typename T, bool IsConst>
+bool SmallTreeIteratorBase<T, IsConst>::operator!=(
+    const SmallTreeIteratorBase &other) const {
+  return !(*this == other);
+}
+
+//////////////////////////////////////////////////////
+
+// For SmallTree
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+SmallTree<T, N, Compare, KeyOfValue>::SmallTree(const SmallTree &other)
+    : comp_(other.comp_) {
+  if (other.tree_ != nullptr) {
+    tree_ = new tree_type(*other.tree_);
+  }
+  for (; size_ < other.size_; ++size_) {
+    new (Slots() + size_) T(other.Slots()[size_]);
+  }
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+SmallTree<T, N, Compare, KeyOfValue>::SmallTree(SmallTree &&other) noexcept {
+  StealFrom(other);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+SmallTree<T, N, Compare, KeyOfValue>::~SmallTree() {
+  Clear();
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+SmallTree<T, N, Compare, KeyOfValue> &
+SmallTree<T, N, Compare, KeyOfValue>::operator=(const SmallTree &other) {
+  if (this != &other) {
+    SmallTree copy(other);
+    Clear();
+    StealFrom(copy);
+  }
+  return *this;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+SmallTree<T, N, Compare, KeyOfValue> &
+SmallTree<T, N, Compare, KeyOfValue>::operator=(SmallTree &&other) noexcept {
+  if (this != &other) {
+    Clear();
+    StealFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+typename SmallTree<T, N, Compare, KeyOfValue>::iterator
+SmallTree<T, N, Compare, KeyOfValue>::begin() {
+  if (tree_ != nullptr) {
+    return iterator(tree_->MinNode(tree_->GetRoot()), tree_->GetNil());
+  }
+  return iterator(Slots());
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+typename SmallTree<T, N, Compare, KeyOfValue>::iterator
+SmallTree<T, N, Compare, KeyOfValue>::end() {
+  if (tree_ != nullptr) {
+    return iterator(tree_->GetNil(), tree_->GetNil());
+  }
+  return iterator(Slots() + size_);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+typename SmallTree<T, N, Compare, KeyOfValue>::const_iterator
+SmallTree<T, N, Compare, KeyOfValue>::begin() const {
+  if (tree_ != nullptr) {
+    return const_iterator(tree_->MinNode(tree_->GetRoot()), tree_->GetNil());
+  }
+  return const_iterator(Slots());
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+typename SmallTree<T, N, Compare, KeyOfValue>::const_iterator
+SmallTree<T, N, Compare, KeyOfValue>::end() const {
+  if (tree_ != nullptr) {
+    return const_iterator(tree_->GetNil(), tree_->GetNil());
+  }
+  return const_iterator(Slots() + size_);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+size_t SmallTree<T, N, Compare, KeyOfValue>::GetSize() const {
+  return tree_ != nullptr ? tree_->GetSize() : size_;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+void SmallTree<T, N, Compare, KeyOfValue>::Clear() {
+  for (size_t index = 0; index < size_; ++index) {
+    Slots()[index].~T();
+  }
+  size_ = 0;
+  delete tree_;
+  tree_ = nullptr;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+std::pair<typename SmallTree<T, N, Compare, KeyOfValue>::iterator, bool>
+SmallTree<T, N, Compare, KeyOfValue>::Insert(const T &value) {
+  if (tree_ == nullptr) {
+    size_t pos = InlineLowerBound(KeyOf(value));
+    if (pos < size_ && !comp_(KeyOf(value), KeyOf(Slots()[pos]))) {
+      return std::make_pair(iterator(Slots() + pos), false);
+    }
+    if (size_ < N) {
+      for (size_t index = size_; index > pos; --index) {
+        MoveSlot(index - 1, index);
+      }
+      new (Slots() + pos) T(value);
+      ++size_;
+      return std::make_pair(iterator(Slots() + pos), true);
+    }
+    Promote();
+  }
+  auto *node = tree_->FindNode(KeyOf(value));
+  bool inserted = node == nullptr;
+  if (inserted) {
+    node = tree_->Insert(value);
+  }
+  return std::make_pair(iterator(node, tree_->GetNil()), inserted);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t SmallTree<T, N, Compare, KeyOfValue>::Erase(const K &key) {
+  if (tree_ != nullptr) {
+    auto *node = tree_->FindNode(key);
+    if (node == nullptr) {
+      return 0;
+    }
+    tree_->RemoveNode(node);
+    return 1;
+  }
+  size_t pos = InlineLowerBound(key);
+  if (pos == size_ || comp_(key, KeyOf(Slots()[pos]))) {
+    return 0;
+  }
+  Slots()[pos].~T();
+  for (size_t index = pos + 1; index < size_; ++index) {
+    MoveSlot(index, index - 1);
+  }
+  --size_;
+  return 1;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+void SmallTree<T, N, Compare, KeyOfValue>::Swap(SmallTree &other) {
+  SmallTree temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SmallTree<T, N, Compare, KeyOfValue>::iterator
+SmallTree<T, N, Compare, KeyOfValue>::Find(const K &key) {
+  if (tree_ != nullptr) {
+    auto *node = tree_->FindNode(key);
+    return node == nullptr ? end() : iterator(node, tree_->GetNil());
+  }
+  size_t pos = InlineLowerBound(key);
+  if (pos == size_ || comp_(key, KeyOf(Slots()[pos]))) {
+    return end();
+  }
+  return iterator(Slots() + pos);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SmallTree<T, N, Compare, KeyOfValue>::const_iterator
+SmallTree<T, N, Compare, KeyOfValue>::Find(const K &key) const {
+  if (tree_ != nullptr) {
+    auto *node = tree_->FindNode(key);
+    return node == nullptr ? end() : const_iterator(node, tree_->GetNil());
+  }
+  size_t pos = InlineLowerBound(key);
+  if (pos == size_ || comp_(key, KeyOf(Slots()[pos]))) {
+    return end();
+  }
+  return const_iterator(Slots() + pos);
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SmallTree<T, N, Compare, KeyOfValue>::iterator
+SmallTree<T, N, Compare, KeyOfValue>::LowerBound(const K &key) {
+  if (tree_ != nullptr) {
+    return iterator(tree_->LowerBoundNode(key), tree_->GetNil());
+  }
+  return iterator(Slots() + InlineLowerBound(key));
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SmallTree<T, N, Compare, KeyOfValue>::iterator
+SmallTree<T, N, Compare, KeyOfValue>::UpperBound(const K &key) {
+  if (tree_ != nullptr) {
+    return iterator(tree_->UpperBoundNode(key), tree_->GetNil());
+  }
+  return iterator(Slots() + InlineUpperBound(key));
+}
+
+// Linear scans: for a handful of elements they beat a binary search, whose
+// branches are unpredictable, and keep the loop trivially vectorizable.
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t SmallTree<T, N, Compare, KeyOfValue>::InlineLowerBound(
+    const K &key) const {
+  size_t pos = 0;
+  while (pos < size_ && comp_(KeyOf(Slots()[pos]), key)) {
+    ++pos;
+  }
+  return pos;
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t SmallTree<T, N, Compare, KeyOfValue>::InlineUpperBound(
+    const K &key) const {
+  size_t pos = 0;
+  while (pos < size_ && !comp_(key, KeyOf(Slots()[pos]))) {
+    ++pos;
+  }
+  return pos;
+}
+
+// Move-constructs slot to from slot from and ends the lifetime of the
+// latter; value types such as std::pair<const Key, T> are not assignable.
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+void SmallTree<T, N, Compare, KeyOfValue>::MoveSlot(size_t from, size_t to) {
+  new (Slots() + to) T(std::move(Slots()[from]));
+  Slots()[from].~T();
+}
+
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+void SmallTree<T, N, Compare, KeyOfValue>::Promote() {
+  tree_ = new tree_type();
+  for (size_t index = 0; index < size_; ++index) {
+    tree_->Insert(Slots()[index]);
+    Slots()[index].~T();
+  }
+  size_ = 0;
+}
+
+// Takes over other's elements, leaving it empty; this must be empty
+template <typename T, size_t N, typename Compare, typename KeyOfValue>
+void SmallTree<T, N, Compare, KeyOfValue>::StealFrom(SmallTree &other) {
+  comp_ = other.comp_;
+  tree_ = other.tree_;
+  other.tree_ = nullptr;
+  for (; size_ < other.size_; ++size_) {
+    new (Slots() + size_) T(std::move(other.Slots()[size_]));
+    other.Slots()[size_].~T();
+  }
+  other.size_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SMALL_TREE_H_
@@ -0,0 +1,293 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SPLAY_MAP_SPLAY_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_SPLAY_MAP_SPLAY_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_splay_tree/SplayTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// map on a splay tree (see SplayTree.h): every lookup, at() and operator[]
+// included, moves the key it finds to the root, so under skewed access the
+// hot keys cost a few comparisons instead of the full depth of a balanced
+// tree. Lookups modify the tree and must not run concurrently.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class splay_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = SplayTree<value_type, key_compare, SelectFirst<value_type>>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  splay_map();
+  splay_map(std::initializer_list<value_type> const &items);
+  splay_map(const splay_map &m);
+  splay_map(splay_map &&m) noexcept;
+  ~splay_map();
+
+  splay_map &operator=(const splay_map &m);
+  splay_map &operator=(splay_map &&m) noexcept;
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+ public:
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  iterator erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(splay_map &other);
+  void merge(splay_map &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
+ public:
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  size_type count(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+ private:
+  tree_type tree_;
+};
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare>::splay_map() = default;
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare>::splay_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare>::splay_map(const splay_map &m) : tree_(m.tree_) {}
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare>::splay_map(splay_map &&m) noexcept
+    : tree_(std::move(m.tree_)) {}
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare>::~splay_map() = default;
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare> &splay_map<Key, T, Compare>::operator=(
+    const splay_map &m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+splay_map<Key, T, Compare> &splay_map<Key, T, Compare>::operator=(
+    splay_map &&m) noexcept {
+  tree_ = std::move(m.tree_);
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+T &splay_map<Key, T, Compare>::at(const Key &key) {
+  iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+T &splay_map<Key, T, Compare>::operator[](const Key &key) {
+  iterator it = find(key);
+  if (it == end()) {
+    it = insert(std::make_pair(key, mapped_type())).first;
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator
+splay_map<Key, T, Compare>::begin() {
+  return tree_.begin();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator
+splay_map<Key, T, Compare>::end() {
+  return tree_.end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::const_iterator
+splay_map<Key, T, Compare>::begin() const {
+  return tree_.begin();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::const_iterator
+splay_map<Key, T, Compare>::end() const {
+  return tree_.end();
+}
+
+template <typename Key, typename T, typename Compare>
+bool splay_map<Key, T, Compare>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::size_type
+splay_map<Key, T, Compare>::size() const {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::size_type
+splay_map<Key, T, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         sizeof(typename tree_type::node_type);
+}
+
+template <typename Key, typename T, typename Compare>
+void splay_map<Key, T, Compare>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename splay_map<Key, T, Compare>::iterator, bool>
+splay_map<Key, T, Compare>::insert(const value_type &value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename splay_map<Key, T, Compare>::iterator, bool>
+splay_map<Key, T, Compare>::insert(const Key &key, const T &obj) {
+  return tree_.Insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename splay_map<Key, T, Compare>::iterator, bool>
+splay_map<Key, T, Compare>::insert_or_assign(const Key &key, const T &obj) {
+  iterator it = find(key);
+  if (it != end()) {
+    it->second = obj;
+    return std::make_pair(it, false);
+  }
+  return insert(key, obj);
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator
+splay_map<Key, T, Compare>::erase(iterator pos) {
+  return tree_.Erase(pos);
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::size_type
+splay_map<Key, T, Compare>::erase(const Key &key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename T, typename Compare>
+void splay_map<Key, T, Compare>::swap(splay_map &other) {
+  tree_.Swap(other.tree_);
+}
+
+template <typename Key, typename T, typename Compare>
+void splay_map<Key, T, Compare>::merge(splay_map &other) {
+  if (this == &other) {
+    return;
+  }
+  for (iterator it = other.begin(); it != other.end();) {
+    if (insert(*it).second) {
+      it = other.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename splay_map<Key, T, Compare>::iterator, bool>>
+splay_map<Key, T, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  std::initializer_list<value_type> init_list = {std::forward<Args>(args)...};
+
+  for (const auto &item : init_list) {
+    result_vector.push_back(insert(item));
+  }
+  return result_vector;
+}
+
+template <typename Key, typename T, typename Compare>
+TreeStats splay_map<Key, T, Compare>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename T, typename Compare>
+bool splay_map<Key, T, Compare>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator splay_map<Key, T, Compare>::find(
+    const Key &key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare>
+bool splay_map<Key, T, Compare>::contains(const Key &key) {
+  return tree_.Find(key) != tree_.end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::size_type
+splay_map<Key, T, Compare>::count(const Key &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator
+splay_map<Key, T, Compare>::lower_bound(const Key &key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename splay_map<Key, T, Compare>::iterator
+splay_map<Key, T, Compare>::upper_bound(const Key &key) {
+  return tree_.UpperBound(key);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SPLAY_MAP_SPLAY_MAP_H_
@@ -0,0 +1,240 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SPLAY_SET_SPLAY_SET_H_
+#define CPP2_S21_CONTAINERS_1_S21_SPLAY_SET_SPLAY_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "../s21_splay_tree/SplayTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// set on a splay tree (see SplayTree.h): every lookup moves the key it
+// finds to the root, so under skewed access the hot keys cost a few
+// comparisons instead of the full depth of a balanced tree. Lookups modify
+// the tree and must not run concurrently with each other.
+template <typename Key, typename Compare = std::less<Key>>
+class splay_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = SplayTree<value_type, key_compare, Identity<value_type>>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+ public:
+  splay_set();
+  splay_set(std::initializer_list<value_type> const &items);
+  splay_set(const splay_set &s);
+  splay_set(splay_set &&s) noexcept;
+  ~splay_set();
+
+  splay_set &operator=(const splay_set &s);
+  splay_set &operator=(splay_set &&s) noexcept;
+
+ public:
+  iterator begin() const;
+  iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  iterator erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(splay_set &other);
+  void merge(splay_set &other);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Tree diagnostics
+ public:
+  TreeStats stats() const;
+  bool validate() const;
+
+ public:
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  size_type count(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+ private:
+  tree_type tree_;
+};
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare>::splay_set() = default;
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare>::splay_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare>::splay_set(const splay_set &s) : tree_(s.tree_) {}
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare>::splay_set(splay_set &&s) noexcept
+    : tree_(std::move(s.tree_)) {}
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare>::~splay_set() = default;
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare> &splay_set<Key, Compare>::operator=(
+    const splay_set &s) {
+  tree_ = s.tree_;
+  return *this;
+}
+
+template <typename Key, typename Compare>
+splay_set<Key, Compare> &splay_set<Key, Compare>::operator=(
+    splay_set &&s) noexcept {
+  tree_ = std::move(s.tree_);
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator splay_set<Key, Compare>::begin()
+    const {
+  return tree_.begin();
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator splay_set<Key, Compare>::end()
+    const {
+  return tree_.end();
+}
+
+template <typename Key, typename Compare>
+bool splay_set<Key, Compare>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::size_type splay_set<Key, Compare>::size()
+    const {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::size_type
+splay_set<Key, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         sizeof(typename tree_type::node_type);
+}
+
+template <typename Key, typename Compare>
+void splay_set<Key, Compare>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename Compare>
+std::pair<typename splay_set<Key, Compare>::iterator, bool>
+splay_set<Key, Compare>::insert(const value_type &value) {
+  return tree_.Insert(value);
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator splay_set<Key, Compare>::erase(
+    iterator pos) {
+  return tree_.Erase(pos);
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::size_type splay_set<Key, Compare>::erase(
+    const Key &key) {
+  return tree_.Erase(key);
+}
+
+template <typename Key, typename Compare>
+void splay_set<Key, Compare>::swap(splay_set &other) {
+  tree_.Swap(other.tree_);
+}
+
+template <typename Key, typename Compare>
+void splay_set<Key, Compare>::merge(splay_set &other) {
+  if (this == &other) {
+    return;
+  }
+  for (iterator it = other.begin(); it != other.end();) {
+    if (insert(*it).second) {
+      it = other.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename splay_set<Key, Compare>::iterator, bool>>
+splay_set<Key, Compare>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> result_vector;
+  s21::vector<value_type> new_vector;
+
+  (new_vector.push_back(std::forward<Args>(args)), ...);
+
+  for (size_t i = 0; i < sizeof...(args); ++i) {
+    auto result = insert(new_vector[i]);
+    result_vector.push_back(result);
+  }
+  return result_vector;
+}
+
+template <typename Key, typename Compare>
+TreeStats splay_set<Key, Compare>::stats() const {
+  return tree_.GetStats();
+}
+
+template <typename Key, typename Compare>
+bool splay_set<Key, Compare>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator splay_set<Key, Compare>::find(
+    const Key &key) {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename Compare>
+bool splay_set<Key, Compare>::contains(const Key &key) {
+  return tree_.Find(key) != tree_.end();
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::size_type splay_set<Key, Compare>::count(
+    const Key &key) {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator
+splay_set<Key, Compare>::lower_bound(const Key &key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename Compare>
+typename splay_set<Key, Compare>::iterator
+splay_set<Key, Compare>::upper_bound(const Key &key) {
+  return tree_.UpperBound(key);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SPLAY_SET_SPLAY_SET_H_
@@ -0,0 +1,575 @@
+#ifndef CPP2_S21_CONTAINERS_1_SPLAY_TREE_H_
+#define CPP2_S21_CONTAINERS_1_SPLAY_TREE_H_
+
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_red_black_tree/NodePool.h"
+#include "../s21_red_black_tree/RedBlackTree.h"
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+template <typename T>
+struct SplayNode {
+  T data_;
+  SplayNode *parent_ = nullptr;
+  SplayNode *left_ = nullptr;
+  SplayNode *right_ = nullptr;
+
+  explicit SplayNode(const T &data) : data_(data){};
+};
+
+// end() is the null node; stepping back from it needs the tree's root, so
+// the iterator keeps the address of the tree's root pointer
+template <typename T, bool IsConst>
+class SplayTreeIteratorBase {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = T;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+  using node_type = SplayNode<T>;
+
+ public:
+  SplayTreeIteratorBase() = default;
+  SplayTreeIteratorBase(node_type *node, node_type *const *root)
+      : node_(node), root_(root){};
+  // iterator converts to const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  SplayTreeIteratorBase(const SplayTreeIteratorBase<T, OtherConst> &other)
+      : node_(other.GetNode()), root_(other.GetRoot()){};
+
+ public:
+  reference operator*() const { return node_->data_; }
+  pointer operator->() const { return &node_->data_; }
+
+  SplayTreeIteratorBase &operator++();
+  SplayTreeIteratorBase &operator--();
+  SplayTreeIteratorBase operator++(int);
+  SplayTreeIteratorBase operator--(int);
+
+  bool operator==(const SplayTreeIteratorBase &other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const SplayTreeIteratorBase &other) const {
+    return node_ != other.node_;
+  }
+
+  node_type *GetNode() const { return node_; }
+  node_type *const *GetRoot() const { return root_; }
+
+ private:
+  node_type *node_ = nullptr;
+  node_type *const *root_ = nullptr;
+};
+
+// Self-adjusting binary search tree of unique keys behind splay_set and
+// splay_map. Every insert and lookup rotates the node it reaches up to the
+// root, so keys that are accessed often stay near the top and cost a few
+// comparisons, while any sequence of m operations still takes
+// O(m log n) in total. Individual operations can be O(n), and because
+// lookups restructure the tree they are not const: a splay tree must not be
+// searched from several threads at once, even for reading. Iteration does
+// not splay. Nodes come from a NodePool, as in RedBlackTree.
+template <typename T, typename Compare, typename KeyOfValue>
+class SplayTree {
+ public:
+  using node_type = SplayNode<T>;
+  using iterator = SplayTreeIteratorBase<T, false>;
+  using const_iterator = SplayTreeIteratorBase<T, true>;
+
+ public:
+  SplayTree() = default;
+  SplayTree(const SplayTree &other);
+  SplayTree(SplayTree &&other) noexcept;
+  ~SplayTree();
+
+  SplayTree &operator=(const SplayTree &other);
+  SplayTree &operator=(SplayTree &&other) noexcept;
+
+  iterator begin() { return iterator(Min(root_), &root_); }
+  iterator end() { return iterator(nullptr, &root_); }
+  const_iterator begin() const { return const_iterator(Min(root_), &root_); }
+  const_iterator end() const { return const_iterator(nullptr, &root_); }
+
+  size_t GetSize() const { return size_; }
+
+  void Clear();
+  std::pair<iterator, bool> Insert(const T &value);
+  // Returns the iterator following pos
+  iterator Erase(const_iterator pos);
+  iterator Erase(iterator pos) { return Erase(const_iterator(pos)); }
+  template <typename K>
+  size_t Erase(const K &key);
+  void Swap(SplayTree &other) noexcept;
+
+  // The node found, or the last node visited on a miss, becomes the root
+  template <typename K>
+  iterator Find(const K &key);
+  template <typename K>
+  iterator LowerBound(const K &key);
+  template <typename K>
+  iterator UpperBound(const K &key);
+
+  // height is the current depth of the deepest node, which shrinks as the
+  // accesses concentrate on fewer keys
+  TreeStats GetStats() const;
+  bool Validate() const;
+
+ private:
+  node_type *root_ = nullptr;
+  size_t size_ = 0;
+  NodePool<node_type> pool_;
+  Compare comp_;
+
+  static const auto &KeyOf(const T &value) { return KeyOfValue()(value); }
+  static node_type *Min(node_type *node);
+  static node_type *Max(node_type *node);
+
+  node_type *CreateNode(const T &data);
+  void Rotate(node_type *node);
+  void Splay(node_type *node);
+  template <typename K, typename GoesLeft>
+  iterator Bound(const K &key, GoesLeft goes_left);
+  node_type *BuildBalanced(node_type *const *nodes, size_t count,
+                           node_type *parent);
+};
+
+//////////////////////////////////////////////////////
+
+// For SplayTreeIteratorBase
+template <typename T, bool IsConst>
+SplayTreeIteratorBase<T, IsConst> &
+SplayTreeIteratorBase<T, IsConst>::operator++() {
+  if (node_->right_ != nullptr) {
+    node_ = node_->right_;
+    while (node_->left_ != nullptr) {
+      node_ = node_->left_;
+    }
+  } else {
+    node_type *child = node_;
+    node_ = node_->parent_;
+    while (node_ != nullptr && child == node_->right_) {
+      child = node_;
+      node_ = node_->parent_;
+    }
+  }
+  return *this;
+}
+
+template <typename T, bool IsConst>
+SplayTreeIteratorBase<T, IsConst> &
+SplayTreeIteratorBase<T, IsConst>::operator--() {
+  if (node_ == nullptr) {
+    node_ = *root_;
+    while (node_ != nullptr && node_->right_ != nullptr) {
+      node_ = node_->right_;
+    }
+  } else if (node_->left_ != nullptr) {
+    node_ = node_->left_;
+    while (node_->right_ != nullptr) {
+      node_ = node_->right_;
+    }
+  } else {
+    node_type *child = node_;
+    node_ = node_->parent_;
+    while (node_ != nullptr && child == node_->left_) {
+      child = node_;
+      node_ = node_->parent_;
+    }
+  }
+  return *this;
+}
+
+template <typename T, bool IsConst>
+SplayTreeIteratorBase<T, IsConst> SplayTreeIteratorBase<T, IsConst>::
+operator++(int) {
+  SplayTreeIteratorBase temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename T, bool IsConst>
+SplayTreeIteratorBase<T, IsConst> SplayTreeIteratorBase<T, IsConst>::
+operator--(int) {
+  SplayTreeIteratorBase temp = *this;
+  --(*this);
+  return temp;
+}
+
+// For SplayTree
+// The copy comes out balanced whatever shape other has: its nodes are
+// collected in order and rebuilt around the middle one
+template <typename T, typename Compare, typename KeyOfValue>
+SplayTree<T, Compare, KeyOfValue>::SplayTree(const SplayTree &other)
+    : comp_(other.comp_) {
+  if (other.size_ == 0) {
+    return;
+  }
+  s21::vector<node_type *> nodes;
+  nodes.reserve(other.size_);
+  try {
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+      nodes.push_back(CreateNode(*it));
+    }
+  } catch (...) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      nodes.data()[i]->~node_type();
+    }
+    throw;
+  }
+  root_ = BuildBalanced(nodes.data(), nodes.size(), nullptr);
+  size_ = other.size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+SplayTree<T, Compare, KeyOfValue>::SplayTree(SplayTree &&other) noexcept
+    : root_(other.root_),
+      size_(other.size_),
+      pool_(std::move(other.pool_)),
+      comp_(std::move(other.comp_)) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+SplayTree<T, Compare, KeyOfValue>::~SplayTree() {
+  Clear();
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+SplayTree<T, Compare, KeyOfValue> &SplayTree<T, Compare, KeyOfValue>::
+operator=(const SplayTree &other) {
+  if (this != &other) {
+    SplayTree copy(other);
+    Swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+SplayTree<T, Compare, KeyOfValue> &SplayTree<T, Compare, KeyOfValue>::
+operator=(SplayTree &&other) noexcept {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+// A splay tree can be a single path, so instead of recursing, left children
+// are rotated up until the node to delete has none
+template <typename T, typename Compare, typename KeyOfValue>
+void SplayTree<T, Compare, KeyOfValue>::Clear() {
+  node_type *node = root_;
+  while (node != nullptr) {
+    if (node->left_ != nullptr) {
+      node_type *left = node->left_;
+      node->left_ = left->right_;
+      left->right_ = node;
+      node = left;
+    } else {
+      node_type *right = node->right_;
+      node->~node_type();
+      node = right;
+    }
+  }
+  root_ = nullptr;
+  size_ = 0;
+  pool_.Clear();
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+std::pair<typename SplayTree<T, Compare, KeyOfValue>::iterator, bool>
+SplayTree<T, Compare, KeyOfValue>::Insert(const T &value) {
+  node_type *parent = nullptr;
+  node_type *current = root_;
+  bool goes_left = false;
+  while (current != nullptr) {
+    parent = current;
+    if (comp_(KeyOf(value), KeyOf(current->data_))) {
+      goes_left = true;
+      current = current->left_;
+    } else if (comp_(KeyOf(current->data_), KeyOf(value))) {
+      goes_left = false;
+      current = current->right_;
+    } else {
+      Splay(current);
+      return std::make_pair(iterator(current, &root_), false);
+    }
+  }
+  node_type *node = CreateNode(value);
+  node->parent_ = parent;
+  if (parent == nullptr) {
+    root_ = node;
+  } else if (goes_left) {
+    parent->left_ = node;
+  } else {
+    parent->right_ = node;
+  }
+  ++size_;
+  Splay(node);
+  return std::make_pair(iterator(node, &root_), true);
+}
+
+// Splays pos to the root, then joins its subtrees by splaying the largest
+// node of the left one, which leaves that node without a right child
+template <typename T, typename Compare, typename KeyOfValue>
+typename SplayTree<T, Compare, KeyOfValue>::iterator
+SplayTree<T, Compare, KeyOfValue>::Erase(const_iterator pos) {
+  node_type *node = pos.GetNode();
+  if (node == nullptr) {
+    return end();
+  }
+  iterator next(std::next(pos).GetNode(), &root_);
+  Splay(node);
+  node_type *left = node->left_;
+  node_type *right = node->right_;
+  if (right != nullptr) {
+    right->parent_ = nullptr;
+  }
+  if (left == nullptr) {
+    root_ = right;
+  } else {
+    left->parent_ = nullptr;
+    root_ = left;
+    node_type *max = Max(left);
+    Splay(max);
+    max->right_ = right;
+    if (right != nullptr) {
+      right->parent_ = max;
+    }
+  }
+  node->~node_type();
+  pool_.Deallocate(node);
+  --size_;
+  return next;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t SplayTree<T, Compare, KeyOfValue>::Erase(const K &key) {
+  iterator pos = Find(key);
+  if (pos == end()) {
+    return 0;
+  }
+  Erase(pos);
+  return 1;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void SplayTree<T, Compare, KeyOfValue>::Swap(SplayTree &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  pool_.Swap(other.pool_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SplayTree<T, Compare, KeyOfValue>::iterator
+SplayTree<T, Compare, KeyOfValue>::Find(const K &key) {
+  node_type *last = nullptr;
+  node_type *current = root_;
+  while (current != nullptr) {
+    last = current;
+    if (comp_(key, KeyOf(current->data_))) {
+      current = current->left_;
+    } else if (comp_(KeyOf(current->data_), key)) {
+      current = current->right_;
+    } else {
+      break;
+    }
+  }
+  if (last != nullptr) {
+    Splay(last);
+  }
+  return iterator(current, &root_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SplayTree<T, Compare, KeyOfValue>::iterator
+SplayTree<T, Compare, KeyOfValue>::LowerBound(const K &key) {
+  return Bound(key, [this](const K &k, const T &value) {
+    return !comp_(KeyOf(value), k);
+  });
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename SplayTree<T, Compare, KeyOfValue>::iterator
+SplayTree<T, Compare, KeyOfValue>::UpperBound(const K &key) {
+  return Bound(key, [this](const K &k, const T &value) {
+    return comp_(k, KeyOf(value));
+  });
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+TreeStats SplayTree<T, Compare, KeyOfValue>::GetStats() const {
+  TreeStats stats;
+  s21::vector<std::pair<node_type *, size_t>> stack;
+  if (root_ != nullptr) {
+    stack.push_back(std::make_pair(root_, size_t(1)));
+  }
+  while (stack.size() != 0) {
+    std::pair<node_type *, size_t> top = stack.data()[stack.size() - 1];
+    stack.pop_back();
+    stats.height = std::max(stats.height, top.second);
+    if (top.first->left_ != nullptr) {
+      stack.push_back(std::make_pair(top.first->left_, top.second + 1));
+    }
+    if (top.first->right_ != nullptr) {
+      stack.push_back(std::make_pair(top.first->right_, top.second + 1));
+    }
+  }
+  stats.node_count = size_;
+  stats.bytes_used = pool_.Capacity() * sizeof(node_type);
+  return stats;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+bool SplayTree<T, Compare, KeyOfValue>::Validate() const {
+  if (root_ == nullptr) {
+    return size_ == 0;
+  }
+  if (root_->parent_ != nullptr) {
+    return false;
+  }
+  size_t count = 0;
+  const node_type *prev = nullptr;
+  for (const_iterator it = begin(); it != end(); ++it) {
+    const node_type *node = it.GetNode();
+    if ((node->left_ != nullptr && node->left_->parent_ != node) ||
+        (node->right_ != nullptr && node->right_->parent_ != node) ||
+        (prev != nullptr && !comp_(KeyOf(prev->data_), KeyOf(node->data_))) ||
+        ++count > size_) {
+      return false;
+    }
+    prev = node;
+  }
+  return count == size_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename SplayTree<T, Compare, KeyOfValue>::node_type *
+SplayTree<T, Compare, KeyOfValue>::Min(node_type *node) {
+  while (node != nullptr && node->left_ != nullptr) {
+    node = node->left_;
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename SplayTree<T, Compare, KeyOfValue>::node_type *
+SplayTree<T, Compare, KeyOfValue>::Max(node_type *node) {
+  while (node != nullptr && node->right_ != nullptr) {
+    node = node->right_;
+  }
+  return node;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename SplayTree<T, Compare, KeyOfValue>::node_type *
+SplayTree<T, Compare, KeyOfValue>::CreateNode(const T &data) {
+  void *slot = pool_.Allocate();
+  try {
+    return new (slot) node_type(data);
+  } catch (...) {
+    pool_.Deallocate(slot);
+    throw;
+  }
+}
+
+// Lifts node one level, above its parent
+template <typename T, typename Compare, typename KeyOfValue>
+void SplayTree<T, Compare, KeyOfValue>::Rotate(node_type *node) {
+  node_type *parent = node->parent_;
+  node_type *grandparent = parent->parent_;
+  if (node == parent->left_) {
+    parent->left_ = node->right_;
+    if (node->right_ != nullptr) {
+      node->right_->parent_ = parent;
+    }
+    node->right_ = parent;
+  } else {
+    parent->right_ = node->left_;
+    if (node->left_ != nullptr) {
+      node->left_->parent_ = parent;
+    }
+    node->left_ = parent;
+  }
+  parent->parent_ = node;
+  node->parent_ = grandparent;
+  if (grandparent == nullptr) {
+    root_ = node;
+  } else if (grandparent->left_ == parent) {
+    grandparent->left_ = node;
+  } else {
+    grandparent->right_ = node;
+  }
+}
+
+// Zig-zig rotates the parent first, which is what roughly halves the depth
+// of every node on the access path
+template <typename T, typename Compare, typename KeyOfValue>
+void SplayTree<T, Compare, KeyOfValue>::Splay(node_type *node) {
+  while (node->parent_ != nullptr) {
+    node_type *parent = node->parent_;
+    node_type *grandparent = parent->parent_;
+    if (grandparent != nullptr) {
+      bool zig_zig = (node == parent->left_) == (parent == grandparent->left_);
+      Rotate(zig_zig ? parent : node);
+    }
+    Rotate(node);
+  }
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K, typename GoesLeft>
+typename SplayTree<T, Compare, KeyOfValue>::iterator
+SplayTree<T, Compare, KeyOfValue>::Bound(const K &key, GoesLeft goes_left) {
+  node_type *result = nullptr;
+  node_type *last = nullptr;
+  node_type *current = root_;
+  while (current != nullptr) {
+    last = current;
+    if (goes_left(key, current->data_)) {
+      result = current;
+      current = current->left_;
+    } else {
+      current = current->right_;
+    }
+  }
+  if (result != nullptr) {
+    Splay(result);
+  } else if (last != nullptr) {
+    Splay(last);
+  }
+  return iterator(result, &root_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename SplayTree<T, Compare, KeyOfValue>::node_type *
+SplayTree<T, Compare, KeyOfValue>::BuildBalanced(node_type *const *nodes,
+                                                 size_t count,
+                                                 node_type *parent) {
+  if (count == 0) {
+    return nullptr;
+  }
+  size_t middle = count / 2;
+  node_type *node = nodes[middle];
+  node->parent_ = parent;
+  node->left_ = BuildBalanced(nodes, middle, node);
+  node->right_ = BuildBalanced(nodes + middle + 1, count - middle - 1, node);
+  return node;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SPLAY_TREE_H_
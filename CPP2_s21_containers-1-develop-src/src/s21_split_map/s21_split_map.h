@@ -0,0 +1,498 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SPLIT_MAP_SPLIT_MAP_H_
+#define CPP2_S21_CONTAINERS_1_S21_SPLIT_MAP_SPLIT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_red_black_tree/NodePool.h"
+#include "../s21_red_black_tree/RedBlackTree.h"
+
+namespace s21 {
+
+// What a split_map keeps in its tree nodes: the key and where the value is
+template <typename Key, typename T>
+struct SplitEntry {
+  Key key;
+  T *value;
+};
+
+template <typename Entry>
+struct SelectEntryKey {
+  const auto &operator()(const Entry &entry) const { return entry.key; }
+};
+
+// Keys and values are stored apart, so dereferencing yields a pair of
+// references built on the fly rather than a reference to a stored pair.
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+class SplitMapIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::pair<const Key, T>;
+  using reference =
+      std::pair<const Key &, std::conditional_t<IsConst, const T &, T &>>;
+
+  struct pointer {
+    reference pair;
+    const reference *operator->() const { return &pair; }
+  };
+
+ public:
+  SplitMapIterator() = default;
+  explicit SplitMapIterator(TreeIterator it) : it_(it){};
+  // iterator converts to const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  SplitMapIterator(
+      const SplitMapIterator<Key, T, TreeIterator, OtherConst> &other)
+      : it_(other.Base()){};
+
+ public:
+  reference operator*() const { return reference(it_->key, *it_->value); }
+  pointer operator->() const { return pointer{**this}; }
+
+  SplitMapIterator &operator++();
+  SplitMapIterator &operator--();
+  SplitMapIterator operator++(int);
+  SplitMapIterator operator--(int);
+
+  bool operator==(const SplitMapIterator &other) const;
+  bool operator!=(const SplitMapIterator &other) const;
+
+  TreeIterator Base() const { return it_; }
+
+ private:
+  TreeIterator it_;
+};
+
+// Map whose tree nodes hold only the key, the links and a pointer to the
+// value; the values themselves live in a separate slab. A descent then reads
+// nothing but keys and links, so lookups in maps with large values touch
+// far fewer cache lines than in map, at the price of one extra indirection
+// when a value is actually read.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Balance = RedBlackBalance>
+class split_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using entry_type = SplitEntry<Key, T>;
+  using tree_type =
+      RedBlackTree<entry_type, key_compare, SelectEntryKey<entry_type>,
+                   Balance>;
+  using iterator = SplitMapIterator<Key, T,
+                                    typename tree_type::const_iterator, false>;
+  using const_iterator =
+      SplitMapIterator<Key, T, typename tree_type::const_iterator, true>;
+  using reference = typename iterator::reference;
+  using const_reference = typename const_iterator::reference;
+  using size_type = size_t;
+
+ public:
+  split_map();
+  split_map(std::initializer_list<value_type> const &items);
+  split_map(const split_map &other);
+  split_map(split_map &&other) noexcept;
+  ~split_map();
+
+  split_map &operator=(const split_map &other);
+  split_map &operator=(split_map &&other) noexcept;
+  T &at(const Key &key);
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key);
+
+ public:
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ public:
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  iterator erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(split_map &other);
+
+  // Preallocates key nodes and value slots for size elements
+  void reserve(size_type size);
+
+ public:
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+  bool validate() const;
+
+ private:
+  using node_type = typename tree_type::node_type;
+
+  tree_type tree_;
+  NodePool<T> values_;
+
+  T *NewValue(const T &obj);
+  void DeleteValue(T *value);
+  void DeleteValues(node_type *node);
+  template <typename Iterator>
+  Iterator MakeIterator(node_type *node) const;
+};
+
+//////////////////////////////////////////////////////
+
+// For SplitMapIterator
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>
+    &SplitMapIterator<Key, T, TreeIterator, IsConst>::operator++() {
+  ++it_;
+  return *this;
+}
+
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>
+    &SplitMapIterator<Key, T, TreeIterator, IsConst>::operator--() {
+  --it_;
+  return *this;
+}
+
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>::operator++(int) {
+  SplitMapIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>
+SplitMapIterator<Key, T, TreeIterator, IsConst>::operator--(int) {
+  SplitMapIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+bool SplitMapIterator<Key, T, TreeIterator, IsConst>::operator==(
+    const SplitMapIterator &other) const {
+  return it_ == other.it_;
+}
+
+template <typename Key, typename T, typename TreeIterator, bool IsConst>
+bool SplitMapIterator<Key, T, TreeIterator, IsConst>::operator!=(
+    const SplitMapIterator &other) const {
+  return it_ != other.it_;
+}
+
+//////////////////////////////////////////////////////
+
+// For split_map
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance>::split_map() = default;
+
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance>::split_map(
+    std::initializer_list<value_type> const &items)
+    : split_map() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+// The tree is copied as is and then every entry is pointed at a copy of its
+// value; if a copy throws, the entries not yet redirected are cleared so
+// that only the values made here are destroyed
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance>::split_map(const split_map &other)
+    : tree_(other.tree_) {
+  values_.Reserve(tree_.GetSize());
+  typename tree_type::iterator it = tree_.begin();
+  try {
+    for (; it != tree_.end(); ++it) {
+      it->value = NewValue(*it->value);
+    }
+  } catch (...) {
+    for (; it != tree_.end(); ++it) {
+      it->value = nullptr;
+    }
+    DeleteValues(tree_.GetRoot());
+    throw;
+  }
+}
+
+// The moved-from map is left empty
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance>::split_map(split_map &&other) noexcept
+    : split_map() {
+  swap(other);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance>::~split_map() {
+  DeleteValues(tree_.GetRoot());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance> &
+split_map<Key, T, Compare, Balance>::operator=(const split_map &other) {
+  if (this != &other) {
+    split_map copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+split_map<Key, T, Compare, Balance> &
+split_map<Key, T, Compare, Balance>::operator=(split_map &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+T &split_map<Key, T, Compare, Balance>::at(const Key &key) {
+  node_type *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found");
+  }
+  return *node->data_.value;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+const T &split_map<Key, T, Compare, Balance>::at(const Key &key) const {
+  node_type *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found");
+  }
+  return *node->data_.value;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+T &split_map<Key, T, Compare, Balance>::operator[](const Key &key) {
+  node_type *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    return insert(key, T()).first->second;
+  }
+  return *node->data_.value;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::begin() {
+  return MakeIterator<iterator>(tree_.MinNode(tree_.GetRoot()));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::end() {
+  return MakeIterator<iterator>(tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::const_iterator
+split_map<Key, T, Compare, Balance>::begin() const {
+  return MakeIterator<const_iterator>(tree_.MinNode(tree_.GetRoot()));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::const_iterator
+split_map<Key, T, Compare, Balance>::end() const {
+  return MakeIterator<const_iterator>(tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+bool split_map<Key, T, Compare, Balance>::empty() const {
+  return tree_.GetSize() == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::size_type
+split_map<Key, T, Compare, Balance>::size() const {
+  return tree_.GetSize();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::size_type
+split_map<Key, T, Compare, Balance>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         (sizeof(node_type) + sizeof(T));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void split_map<Key, T, Compare, Balance>::clear() {
+  DeleteValues(tree_.GetRoot());
+  tree_.ClearNodes(tree_.GetRoot());
+  tree_.SetRoot(tree_.GetNil());
+  values_.Clear();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename split_map<Key, T, Compare, Balance>::iterator, bool>
+split_map<Key, T, Compare, Balance>::insert(const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename split_map<Key, T, Compare, Balance>::iterator, bool>
+split_map<Key, T, Compare, Balance>::insert(const Key &key, const T &obj) {
+  node_type *node = tree_.FindNode(key);
+  if (node != nullptr) {
+    return {MakeIterator<iterator>(node), false};
+  }
+  T *value = NewValue(obj);
+  try {
+    node = tree_.Insert(entry_type{key, value});
+  } catch (...) {
+    DeleteValue(value);
+    throw;
+  }
+  return {MakeIterator<iterator>(node), true};
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+std::pair<typename split_map<Key, T, Compare, Balance>::iterator, bool>
+split_map<Key, T, Compare, Balance>::insert_or_assign(const Key &key,
+                                                      const T &obj) {
+  node_type *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    return insert(key, obj);
+  }
+  *node->data_.value = obj;
+  return {MakeIterator<iterator>(node), false};
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::erase(const_iterator pos) {
+  node_type *node = pos.Base().GetNode();
+  DeleteValue(node->data_.value);
+  return MakeIterator<iterator>(tree_.EraseNode(node));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::size_type
+split_map<Key, T, Compare, Balance>::erase(const Key &key) {
+  node_type *node = tree_.FindNode(key);
+  if (node == nullptr) {
+    return 0;
+  }
+  DeleteValue(node->data_.value);
+  tree_.EraseNode(node);
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void split_map<Key, T, Compare, Balance>::swap(split_map &other) {
+  std::swap(tree_, other.tree_);
+  values_.Swap(other.values_);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void split_map<Key, T, Compare, Balance>::reserve(size_type size) {
+  tree_.Reserve(size);
+  if (size > tree_.GetSize()) {
+    values_.Reserve(size - tree_.GetSize());
+  }
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::find(const Key &key) {
+  node_type *node = tree_.FindNode(key);
+  return MakeIterator<iterator>(node != nullptr ? node : tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::const_iterator
+split_map<Key, T, Compare, Balance>::find(const Key &key) const {
+  node_type *node = tree_.FindNode(key);
+  return MakeIterator<const_iterator>(node != nullptr ? node
+                                                      : tree_.GetNil());
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+bool split_map<Key, T, Compare, Balance>::contains(const Key &key) const {
+  return tree_.FindNode(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::size_type
+split_map<Key, T, Compare, Balance>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::lower_bound(const Key &key) {
+  return MakeIterator<iterator>(tree_.LowerBoundNode(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+typename split_map<Key, T, Compare, Balance>::iterator
+split_map<Key, T, Compare, Balance>::upper_bound(const Key &key) {
+  return MakeIterator<iterator>(tree_.UpperBoundNode(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+bool split_map<Key, T, Compare, Balance>::validate() const {
+  return tree_.Validate();
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+T *split_map<Key, T, Compare, Balance>::NewValue(const T &obj) {
+  void *slot = values_.Allocate();
+  try {
+    return new (slot) T(obj);
+  } catch (...) {
+    values_.Deallocate(slot);
+    throw;
+  }
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void split_map<Key, T, Compare, Balance>::DeleteValue(T *value) {
+  value->~T();
+  values_.Deallocate(value);
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+void split_map<Key, T, Compare, Balance>::DeleteValues(node_type *node) {
+  if (node == nullptr || node == tree_.GetNil()) {
+    return;
+  }
+  DeleteValues(node->left_);
+  DeleteValues(node->right_);
+  if (node->data_.value != nullptr) {
+    DeleteValue(node->data_.value);
+  }
+}
+
+template <typename Key, typename T, typename Compare, typename Balance>
+template <typename Iterator>
+Iterator split_map<Key, T, Compare, Balance>::MakeIterator(
+    node_type *node) const {
+  return Iterator(typename tree_type::const_iterator(node, tree_.GetNil()));
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SPLIT_MAP_SPLIT_MAP_H_
@@ -54,6 +54,7 @@ class vector {
   const_reference back();
 
   T *data();
+  const T *data() const;
 
   //
 
@@ -65,7 +66,7 @@ class vector {
 
   bool empty() noexcept;
 
-  size_type size();
+  size_type size() const;
 
   size_type max_size();
 
@@ -195,6 +196,11 @@ inline value_type *vector<value_type>::data() {
   return _arr;
 }
 
+template <typename value_type>
+inline const value_type *vector<value_type>::data() const {
+  return _arr;
+}
+
 template <typename value_type>
 inline typename vector<value_type>::iterator vector<value_type>::begin() {
   return _arr;
@@ -213,7 +219,8 @@ inline bool vector<value_type>::empty()
 }
 
 template <typename value_type>
-inline typename vector<value_type>::size_type vector<value_type>::size() {
+inline typename vector<value_type>::size_type vector<value_type>::size()
+    const {
   return _size;
 }
 
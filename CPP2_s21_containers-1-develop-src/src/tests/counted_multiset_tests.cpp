@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <type_traits>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class CountedMultisetTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    stdMultisetWithDuplicates = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4};
+    myMultisetWithDuplicates = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4};
+  }
+
+  std::multiset<int> stdMultisetWithDuplicates{};
+  s21::counted_multiset<int> myMultisetWithDuplicates{};
+};
+
+TEST_F(CountedMultisetTest, DefaultConstructorTest) {
+  std::multiset<int> stdMultiset{};
+  s21::counted_multiset<int> myMultiset{};
+  AssertContainerEquality(stdMultiset, myMultiset);
+}
+
+TEST_F(CountedMultisetTest, ListConstructorTest) {
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+  ASSERT_EQ(myMultisetWithDuplicates.distinct_size(), 4U);
+}
+
+TEST_F(CountedMultisetTest, ListConstructorTest2) {
+  std::multiset<std::string> stdMultiset{"tag", "other", "tag", "tag"};
+  s21::counted_multiset<std::string> myMultiset{"tag", "other", "tag", "tag"};
+  AssertContainerEquality(stdMultiset, myMultiset);
+}
+
+TEST_F(CountedMultisetTest, CopyAndMoveTest) {
+  s21::counted_multiset<int> myCopy{myMultisetWithDuplicates};
+  AssertContainerEquality(stdMultisetWithDuplicates, myCopy);
+
+  s21::counted_multiset<int> myMoved{std::move(myCopy)};
+  AssertContainerEquality(stdMultisetWithDuplicates, myMoved);
+  ASSERT_TRUE(myCopy.empty());
+
+  s21::counted_multiset<int> myAssigned{};
+  myAssigned = myMoved;
+  AssertContainerEquality(stdMultisetWithDuplicates, myAssigned);
+}
+
+TEST_F(CountedMultisetTest, CountTest) {
+  for (int key = 0; key < 6; ++key) {
+    ASSERT_EQ(stdMultisetWithDuplicates.count(key),
+              myMultisetWithDuplicates.count(key));
+  }
+}
+
+TEST_F(CountedMultisetTest, InsertTest) {
+  auto std_iter = stdMultisetWithDuplicates.insert(3);
+  auto my_iter = myMultisetWithDuplicates.insert(3);
+  ASSERT_EQ(*std_iter, *my_iter);
+  myMultisetWithDuplicates.insert(7, 3);
+  stdMultisetWithDuplicates.insert({7, 7, 7});
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+}
+
+TEST_F(CountedMultisetTest, InsertManyTest) {
+  myMultisetWithDuplicates.insert_many(5, 1, 5);
+  stdMultisetWithDuplicates.insert({5, 1, 5});
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+}
+
+TEST_F(CountedMultisetTest, EraseOneCopyTest) {
+  stdMultisetWithDuplicates.erase(stdMultisetWithDuplicates.find(3));
+  myMultisetWithDuplicates.erase(myMultisetWithDuplicates.find(3));
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+  ASSERT_EQ(myMultisetWithDuplicates.count(3), 2U);
+}
+
+TEST_F(CountedMultisetTest, EraseAllTest) {
+  while (!myMultisetWithDuplicates.empty()) {
+    auto iter = myMultisetWithDuplicates.begin();
+    stdMultisetWithDuplicates.erase(stdMultisetWithDuplicates.begin());
+    myMultisetWithDuplicates.erase(iter);
+    AssertContainerEquality(stdMultisetWithDuplicates,
+                            myMultisetWithDuplicates);
+  }
+  ASSERT_EQ(myMultisetWithDuplicates.distinct_size(), 0U);
+}
+
+TEST_F(CountedMultisetTest, EraseByKeyTest) {
+  ASSERT_EQ(stdMultisetWithDuplicates.erase(4),
+            myMultisetWithDuplicates.erase(4));
+  ASSERT_EQ(stdMultisetWithDuplicates.erase(4),
+            myMultisetWithDuplicates.erase(4));
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+}
+
+TEST_F(CountedMultisetTest, BoundsTest) {
+  auto std_range = stdMultisetWithDuplicates.equal_range(3);
+  auto my_range = myMultisetWithDuplicates.equal_range(3);
+  ASSERT_EQ(std::distance(std_range.first, std_range.second),
+            std::distance(my_range.first, my_range.second));
+  ASSERT_EQ(*std_range.second, *my_range.second);
+  ASSERT_TRUE(myMultisetWithDuplicates.lower_bound(5) ==
+              myMultisetWithDuplicates.end());
+  ASSERT_FALSE(myMultisetWithDuplicates.contains(0));
+  ASSERT_TRUE(myMultisetWithDuplicates.find(0) ==
+              myMultisetWithDuplicates.end());
+}
+
+TEST_F(CountedMultisetTest, MergeAndSwapTest) {
+  std::multiset<int> stdOther{2, 9, 9};
+  s21::counted_multiset<int> myOther{2, 9, 9};
+  stdMultisetWithDuplicates.merge(stdOther);
+  myMultisetWithDuplicates.merge(myOther);
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+  ASSERT_TRUE(myOther.empty());
+
+  myOther.swap(myMultisetWithDuplicates);
+  AssertContainerEquality(stdMultisetWithDuplicates, myOther);
+  ASSERT_TRUE(myMultisetWithDuplicates.empty());
+}
+
+TEST_F(CountedMultisetTest, ClearTest) {
+  stdMultisetWithDuplicates.clear();
+  myMultisetWithDuplicates.clear();
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+}
+
+TEST_F(CountedMultisetTest, EraseReturnsNextTest) {
+  auto iter = myMultisetWithDuplicates.find(3);
+  auto next = myMultisetWithDuplicates.erase(iter);
+  ASSERT_EQ(*next, 3);
+  next = myMultisetWithDuplicates.erase(std::next(next));
+  ASSERT_EQ(*next, 4);
+  stdMultisetWithDuplicates.erase(stdMultisetWithDuplicates.find(3));
+  stdMultisetWithDuplicates.erase(stdMultisetWithDuplicates.find(3));
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+  next = myMultisetWithDuplicates.erase(myMultisetWithDuplicates.find(3));
+  ASSERT_EQ(*next, 4);
+  ASSERT_EQ(myMultisetWithDuplicates.distinct_size(), 3U);
+}
+
+TEST_F(CountedMultisetTest, EraseRangeTest) {
+  // From the second 2 up to the third 4
+  auto first = std::next(myMultisetWithDuplicates.begin(), 2);
+  auto last = std::next(myMultisetWithDuplicates.begin(), 8);
+  auto next = myMultisetWithDuplicates.erase(first, last);
+  ASSERT_EQ(*next, 4);
+  stdMultisetWithDuplicates.erase(
+      std::next(stdMultisetWithDuplicates.begin(), 2),
+      std::next(stdMultisetWithDuplicates.begin(), 8));
+  AssertContainerEquality(stdMultisetWithDuplicates, myMultisetWithDuplicates);
+
+  first = myMultisetWithDuplicates.find(4);
+  next = myMultisetWithDuplicates.erase(first, std::next(first));
+  std::multiset<int> stdExpected{1, 2, 4};
+  AssertContainerEquality(stdExpected, myMultisetWithDuplicates);
+  next = myMultisetWithDuplicates.erase(myMultisetWithDuplicates.begin(),
+                                        myMultisetWithDuplicates.end());
+  ASSERT_TRUE(next == myMultisetWithDuplicates.end());
+  ASSERT_TRUE(myMultisetWithDuplicates.empty());
+}
+
+}  // namespace s21
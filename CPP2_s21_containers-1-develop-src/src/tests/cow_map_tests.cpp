@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class CowMapTest : public ::testing::Test {
+ protected:
+  template <typename StdMap, typename MyMap>
+  void AssertSameElements(const StdMap &expected, const MyMap &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::map<int, std::string> stdMapInt{{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::cow_map<int, std::string> myMapInt{{1, "a"}, {2, "b"}, {3, "c"}};
+};
+
+TEST_F(CowMapTest, DefaultConstructorTest) {
+  s21::cow_map<int, int> myMap{};
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_FALSE(myMap.is_shared());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+}
+
+TEST_F(CowMapTest, CopySharesTreeTest) {
+  s21::cow_map<int, std::string> copy(myMapInt);
+  ASSERT_TRUE(copy.is_shared());
+  ASSERT_TRUE(myMapInt.is_shared());
+  ASSERT_TRUE(copy.begin() == myMapInt.begin());
+  ASSERT_EQ(copy.at(2), "b");
+  ASSERT_TRUE(copy.is_shared());
+  s21::cow_map<int, std::string> assigned{};
+  assigned = copy;
+  ASSERT_TRUE(assigned.begin() == myMapInt.begin());
+}
+
+TEST_F(CowMapTest, WriteDetachesTest) {
+  s21::cow_map<int, std::string> copy(myMapInt);
+  copy[2] = "B";
+  ASSERT_FALSE(copy.is_shared());
+  ASSERT_FALSE(myMapInt.is_shared());
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(copy.at(2), "B");
+
+  s21::cow_map<int, std::string> second(myMapInt);
+  ASSERT_TRUE(second.insert(4, "d").second);
+  ASSERT_TRUE(second.insert_or_assign(1, "A").first->second == "A");
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(second.size(), 4U);
+}
+
+TEST_F(CowMapTest, FailedWriteKeepsSharingTest) {
+  s21::cow_map<int, std::string> copy(myMapInt);
+  ASSERT_FALSE(copy.insert(1, "x").second);
+  ASSERT_EQ(copy.erase(9), 0U);
+  ASSERT_TRUE(copy.is_shared());
+}
+
+TEST_F(CowMapTest, EraseTest) {
+  s21::cow_map<int, std::string> copy(myMapInt);
+  copy.erase(copy.find(2));
+  ASSERT_EQ(copy.erase(3), 1U);
+  AssertSameElements(stdMapInt, myMapInt);
+  AssertSameElements(std::map<int, std::string>{{1, "a"}}, copy);
+  myMapInt.erase(1);
+  stdMapInt.erase(1);
+  AssertSameElements(stdMapInt, myMapInt);
+}
+
+TEST_F(CowMapTest, LookupTest) {
+  ASSERT_EQ(myMapInt.at(3), "c");
+  ASSERT_THROW(myMapInt.at(7), std::out_of_range);
+  ASSERT_TRUE(myMapInt.contains(1));
+  ASSERT_EQ(myMapInt.count(4), 0U);
+  ASSERT_TRUE(myMapInt.find(4) == myMapInt.end());
+  ASSERT_EQ(myMapInt.lower_bound(2)->first, 2);
+  ASSERT_EQ(myMapInt.upper_bound(2)->first, 3);
+  ASSERT_TRUE(myMapInt.upper_bound(3) == myMapInt.end());
+}
+
+TEST_F(CowMapTest, ClearAndMoveTest) {
+  s21::cow_map<int, std::string> copy(myMapInt);
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+  AssertSameElements(stdMapInt, myMapInt);
+  s21::cow_map<int, std::string> moved(std::move(myMapInt));
+  AssertSameElements(stdMapInt, moved);
+  ASSERT_TRUE(myMapInt.empty());
+  myMapInt = std::move(moved);
+  AssertSameElements(stdMapInt, myMapInt);
+  myMapInt.clear();
+  ASSERT_TRUE(myMapInt.empty());
+}
+
+TEST_F(CowMapTest, MergeAndSwapTest) {
+  s21::cow_map<int, std::string> other{{1, "x"}, {5, "e"}};
+  s21::cow_map<int, std::string> other_copy(other);
+  myMapInt.merge(other);
+  stdMapInt.insert({5, "e"});
+  AssertSameElements(stdMapInt, myMapInt);
+  AssertSameElements(std::map<int, std::string>{{1, "x"}}, other);
+  ASSERT_EQ(other_copy.size(), 2U);
+  other.swap(myMapInt);
+  AssertSameElements(stdMapInt, other);
+  auto results = myMapInt.insert_many(std::make_pair(2, "b"),
+                                      std::make_pair(1, "dup"));
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+}
+}  // namespace s21
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class CowSetTest : public ::testing::Test {
+ protected:
+  template <typename StdSet, typename MySet>
+  void AssertSameElements(const StdSet &expected, const MySet &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &key : expected) {
+      ASSERT_EQ(key, *iter);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::set<int> stdSetInt{1, 4, 9, 16};
+  s21::cow_set<int> mySetInt{1, 4, 9, 16};
+};
+
+TEST_F(CowSetTest, DefaultConstructorTest) {
+  s21::cow_set<int> mySet{};
+  ASSERT_TRUE(mySet.empty());
+  ASSERT_FALSE(mySet.is_shared());
+  ASSERT_TRUE(mySet.begin() == mySet.end());
+}
+
+TEST_F(CowSetTest, CopyOnWriteTest) {
+  s21::cow_set<int> copy(mySetInt);
+  ASSERT_TRUE(copy.is_shared());
+  ASSERT_TRUE(copy.begin() == mySetInt.begin());
+  ASSERT_FALSE(copy.insert(4).second);
+  ASSERT_TRUE(copy.is_shared());
+  ASSERT_TRUE(copy.insert(5).second);
+  ASSERT_FALSE(copy.is_shared());
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1, 4, 5, 9, 16}, copy);
+}
+
+TEST_F(CowSetTest, EraseTest) {
+  s21::cow_set<int> copy(mySetInt);
+  copy.erase(copy.find(4));
+  ASSERT_EQ(copy.erase(4), 0U);
+  ASSERT_EQ(copy.erase(16), 1U);
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1, 9}, copy);
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(mySetInt.size(), 4U);
+}
+
+TEST_F(CowSetTest, LookupTest) {
+  for (int key = 0; key < 20; ++key) {
+    ASSERT_EQ(stdSetInt.count(key), mySetInt.count(key));
+    ASSERT_EQ(stdSetInt.count(key) != 0, mySetInt.contains(key));
+    auto std_lower = stdSetInt.lower_bound(key);
+    auto lower = mySetInt.lower_bound(key);
+    ASSERT_EQ(std_lower == stdSetInt.end(), lower == mySetInt.end());
+    if (lower != mySetInt.end()) {
+      ASSERT_EQ(*std_lower, *lower);
+    }
+    auto std_upper = stdSetInt.upper_bound(key);
+    auto upper = mySetInt.upper_bound(key);
+    ASSERT_EQ(std_upper == stdSetInt.end(), upper == mySetInt.end());
+    if (upper != mySetInt.end()) {
+      ASSERT_EQ(*std_upper, *upper);
+    }
+  }
+}
+
+TEST_F(CowSetTest, MergeSwapAndMoveTest) {
+  s21::cow_set<int> other{1, 2, 3};
+  mySetInt.merge(other);
+  stdSetInt.insert({2, 3});
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1}, other);
+  s21::cow_set<int> same(mySetInt);
+  mySetInt.merge(same);
+  AssertSameElements(stdSetInt, same);
+  other.swap(mySetInt);
+  AssertSameElements(stdSetInt, other);
+  s21::cow_set<int> moved(std::move(other));
+  AssertSameElements(stdSetInt, moved);
+  ASSERT_TRUE(other.empty());
+  auto results = other.insert_many(3, 3);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+}
+}  // namespace s21
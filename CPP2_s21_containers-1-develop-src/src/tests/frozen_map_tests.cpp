@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containers.h"
+#include "test_utils.h"
+
+namespace s21 {
+class FrozenMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (int i = 0; i < 100; ++i) {
+      stdMapHundredElements.insert({i * 2, "value" + std::to_string(i)});
+      myMapHundredElements.insert(i * 2, "value" + std::to_string(i));
+    }
+  }
+
+  template <typename FrozenMap>
+  void AssertSameElements(const std::map<int, std::string> &expected,
+                          const FrozenMap &frozen) {
+    ASSERT_EQ(expected.size(), frozen.size());
+    ASSERT_EQ(expected.empty(), frozen.empty());
+    auto iter = frozen.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == frozen.end());
+  }
+
+  std::map<int, std::string> stdMapHundredElements{};
+  s21::map<int, std::string> myMapHundredElements{};
+};
+
+TEST_F(FrozenMapTest, EmptyTest) {
+  s21::frozen_map<int, std::string> frozen =
+      s21::map<int, std::string>{}.freeze();
+  AssertSameElements({}, frozen);
+  ASSERT_THROW(frozen.at(1), std::out_of_range);
+}
+
+TEST_F(FrozenMapTest, IterationTest) {
+  s21::frozen_map<int, std::string> frozen = myMapHundredElements.freeze();
+  AssertSameElements(stdMapHundredElements, frozen);
+  auto std_iter = stdMapHundredElements.rbegin();
+  for (auto iter = frozen.end(); iter != frozen.begin(); ++std_iter) {
+    --iter;
+    ASSERT_EQ(std_iter->first, (*iter).first);
+    ASSERT_EQ(std_iter->second, (*iter).second);
+  }
+}
+
+TEST_F(FrozenMapTest, LookupTest) {
+  s21::frozen_map<int, std::string> frozen = myMapHundredElements.freeze();
+  for (int key = -1; key < 202; ++key) {
+    auto expected = stdMapHundredElements.find(key);
+    ASSERT_EQ(expected != stdMapHundredElements.end(), frozen.contains(key));
+    if (expected != stdMapHundredElements.end()) {
+      ASSERT_EQ(expected->second, frozen.at(key));
+      ASSERT_EQ(expected->second, frozen.find(key)->second);
+    } else {
+      ASSERT_TRUE(frozen.find(key) == frozen.end());
+      ASSERT_THROW(frozen.at(key), std::out_of_range);
+    }
+    auto lower = frozen.lower_bound(key);
+    auto std_lower = stdMapHundredElements.lower_bound(key);
+    ASSERT_EQ(std_lower == stdMapHundredElements.end(),
+              lower == frozen.end());
+    if (lower != frozen.end()) {
+      ASSERT_EQ(std_lower->first, lower->first);
+    }
+  }
+}
+
+TEST_F(FrozenMapTest, SnapshotTest) {
+  s21::frozen_map<int, std::string> frozen = myMapHundredElements.freeze();
+  myMapHundredElements[0] = "changed";
+  myMapHundredElements.erase(2);
+  AssertSameElements(stdMapHundredElements, frozen);
+}
+}  // namespace s21
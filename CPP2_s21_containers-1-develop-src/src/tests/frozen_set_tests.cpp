@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "../s21_containers.h"
+#include "test_utils.h"
+
+namespace s21 {
+class FrozenSetTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (int i = 0; i < 100; ++i) {
+      stdSetHundredElements.insert(i * 3);
+      mySetHundredElements.insert(i * 3);
+    }
+  }
+
+  std::set<int> stdSetHundredElements{};
+  s21::set<int> mySetHundredElements{};
+};
+
+TEST_F(FrozenSetTest, EmptyTest) {
+  std::set<int> stdSet{};
+  s21::frozen_set<int> frozen = s21::set<int>{}.freeze();
+  AssertContainerEquality(stdSet, frozen);
+  ASSERT_TRUE(frozen.begin() == frozen.end());
+  ASSERT_FALSE(frozen.contains(0));
+  ASSERT_TRUE(frozen.lower_bound(0) == frozen.end());
+}
+
+TEST_F(FrozenSetTest, IterationTest) {
+  for (size_t size = 0; size < 40; ++size) {
+    std::set<int> stdSet{};
+    s21::set<int> mySet{};
+    for (size_t i = 0; i < size; ++i) {
+      stdSet.insert(static_cast<int>(i));
+      mySet.insert(static_cast<int>(i));
+    }
+    s21::frozen_set<int> frozen = mySet.freeze();
+    AssertContainerEquality(stdSet, frozen);
+    auto std_iter = stdSet.rbegin();
+    for (auto iter = frozen.end(); iter != frozen.begin(); ++std_iter) {
+      --iter;
+      ASSERT_EQ(*std_iter, *iter);
+    }
+  }
+}
+
+TEST_F(FrozenSetTest, FindTest) {
+  s21::frozen_set<int> frozen = mySetHundredElements.freeze();
+  AssertContainerEquality(stdSetHundredElements, frozen);
+  for (int key = -2; key < 305; ++key) {
+    ASSERT_EQ(stdSetHundredElements.count(key), frozen.count(key));
+    ASSERT_EQ(stdSetHundredElements.count(key) != 0, frozen.contains(key));
+    auto found = frozen.find(key);
+    if (stdSetHundredElements.count(key) != 0) {
+      ASSERT_EQ(*found, key);
+    } else {
+      ASSERT_TRUE(found == frozen.end());
+    }
+  }
+}
+
+TEST_F(FrozenSetTest, BoundsTest) {
+  s21::frozen_set<int> frozen = mySetHundredElements.freeze();
+  for (int key = -2; key < 305; ++key) {
+    auto std_lower = stdSetHundredElements.lower_bound(key);
+    auto std_upper = stdSetHundredElements.upper_bound(key);
+    auto lower = frozen.lower_bound(key);
+    auto upper = frozen.upper_bound(key);
+    ASSERT_EQ(std_lower == stdSetHundredElements.end(), lower == frozen.end());
+    ASSERT_EQ(std_upper == stdSetHundredElements.end(), upper == frozen.end());
+    if (lower != frozen.end()) {
+      ASSERT_EQ(*std_lower, *lower);
+    }
+    if (upper != frozen.end()) {
+      ASSERT_EQ(*std_upper, *upper);
+    }
+  }
+}
+
+TEST_F(FrozenSetTest, SnapshotTest) {
+  s21::frozen_set<int> frozen = mySetHundredElements.freeze();
+  mySetHundredElements.clear();
+  s21::frozen_set<int> copy = frozen;
+  AssertContainerEquality(stdSetHundredElements, copy);
+}
+
+TEST_F(FrozenSetTest, TransparentLookupTest) {
+  s21::set<std::string, std::less<>> mySet{"frozen", "sets", "are", "fast"};
+  s21::frozen_set<std::string, std::less<>> frozen = mySet.freeze();
+  std::string_view view = "sets";
+  ASSERT_TRUE(frozen.contains(view));
+  ASSERT_EQ(*frozen.find(view), "sets");
+  ASSERT_EQ(frozen.count(std::string_view("slow")), 0U);
+  ASSERT_EQ(*frozen.lower_bound(std::string_view("b")), "fast");
+}
+}  // namespace s21
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class IndexedSetTest : public ::testing::Test {
+ protected:
+  template <typename StdSet, typename MySet>
+  void AssertSameElements(const StdSet &expected, const MySet &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &key : expected) {
+      ASSERT_EQ(key, *iter);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+    ASSERT_TRUE(actual.validate());
+  }
+
+  std::set<int> stdSetInt{5, 1, 3, 8, 2};
+  s21::indexed_set<int> mySetInt{5, 1, 3, 8, 2};
+};
+
+TEST_F(IndexedSetTest, DefaultConstructorTest) {
+  s21::indexed_set<int> mySet{};
+  ASSERT_TRUE(mySet.empty());
+  ASSERT_TRUE(mySet.begin() == mySet.end());
+  ASSERT_TRUE(mySet.find(1) == mySet.end());
+  ASSERT_EQ(mySet.erase(1), 0U);
+  ASSERT_EQ(mySet.stats().bytes_used, 0U);
+  ASSERT_TRUE(mySet.validate());
+}
+
+TEST_F(IndexedSetTest, InsertTest) {
+  AssertSameElements(stdSetInt, mySetInt);
+  ASSERT_FALSE(mySetInt.insert(3).second);
+  auto result = mySetInt.insert(4);
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(*result.first, 4);
+  stdSetInt.insert(4);
+  AssertSameElements(stdSetInt, mySetInt);
+}
+
+TEST_F(IndexedSetTest, LookupTest) {
+  for (int key = 0; key < 10; ++key) {
+    ASSERT_EQ(stdSetInt.count(key), mySetInt.count(key));
+    ASSERT_EQ(stdSetInt.count(key) != 0, mySetInt.contains(key));
+    auto lower = stdSetInt.lower_bound(key);
+    auto upper = stdSetInt.upper_bound(key);
+    ASSERT_EQ(lower == stdSetInt.end(),
+              mySetInt.lower_bound(key) == mySetInt.end());
+    ASSERT_EQ(upper == stdSetInt.end(),
+              mySetInt.upper_bound(key) == mySetInt.end());
+    if (lower != stdSetInt.end()) {
+      ASSERT_EQ(*lower, *mySetInt.lower_bound(key));
+    }
+    if (upper != stdSetInt.end()) {
+      ASSERT_EQ(*upper, *mySetInt.upper_bound(key));
+    }
+  }
+  ASSERT_TRUE(mySetInt.find(4) == mySetInt.end());
+  ASSERT_EQ(*mySetInt.find(5), 5);
+}
+
+TEST_F(IndexedSetTest, IteratorTest) {
+  auto iter = mySetInt.end();
+  --iter;
+  ASSERT_EQ(*iter, 8);
+  iter--;
+  ASSERT_EQ(*iter, 5);
+  ASSERT_EQ(*iter++, 5);
+  ASSERT_EQ(*iter, 8);
+  // Growing the arena moves the nodes but not the positions
+  auto kept = mySetInt.find(3);
+  for (int key = 100; key < 1000; ++key) {
+    mySetInt.insert(key);
+  }
+  ASSERT_EQ(*kept, 3);
+  ASSERT_EQ(*++kept, 5);
+}
+
+TEST_F(IndexedSetTest, EraseReusesSlotsTest) {
+  mySetInt.erase(mySetInt.find(3));
+  ASSERT_EQ(mySetInt.erase(3), 0U);
+  ASSERT_EQ(mySetInt.erase(8), 1U);
+  stdSetInt.erase(3);
+  stdSetInt.erase(8);
+  AssertSameElements(stdSetInt, mySetInt);
+  size_t bytes = mySetInt.stats().bytes_used;
+  mySetInt.insert(30);
+  mySetInt.insert(80);
+  ASSERT_EQ(mySetInt.stats().bytes_used, bytes);
+  stdSetInt.insert({30, 80});
+  AssertSameElements(stdSetInt, mySetInt);
+}
+
+TEST_F(IndexedSetTest, RandomizedTest) {
+  std::mt19937 rng(7);
+  std::set<std::string> stdSet{};
+  s21::indexed_set<std::string> mySet{};
+  for (int step = 0; step < 5000; ++step) {
+    std::string key = std::to_string(rng() % 200);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(stdSet.erase(key), mySet.erase(key));
+    } else {
+      ASSERT_EQ(stdSet.insert(key).second, mySet.insert(key).second);
+    }
+    if (rng() % 1000 == 0) {
+      stdSet.clear();
+      mySet.clear();
+    }
+    if (step % 50 == 0) {
+      AssertSameElements(stdSet, mySet);
+    }
+  }
+  AssertSameElements(stdSet, mySet);
+  ASSERT_LE(mySet.stats().height, 2 * mySet.stats().black_height);
+}
+
+TEST_F(IndexedSetTest, MergeTest) {
+  s21::indexed_set<int> other{1, 2, 9, 11};
+  mySetInt.merge(other);
+  stdSetInt.insert({9, 11});
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1, 2}, other);
+  auto results = other.insert_many(7, 7, 0);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_TRUE(results[2].second);
+}
+
+TEST_F(IndexedSetTest, CopySwapAndMoveTest) {
+  s21::indexed_set<std::string> first{"b", "a"};
+  s21::indexed_set<std::string> second{"x", "y", "z"};
+  s21::indexed_set<std::string> copy(second);
+  copy.erase("x");
+  ASSERT_EQ(second.size(), 3U);
+  AssertSameElements(std::set<std::string>{"y", "z"}, copy);
+  first.swap(second);
+  AssertSameElements(std::set<std::string>{"x", "y", "z"}, first);
+  AssertSameElements(std::set<std::string>{"a", "b"}, second);
+  s21::indexed_set<std::string> moved(std::move(second));
+  AssertSameElements(std::set<std::string>{"a", "b"}, moved);
+  ASSERT_TRUE(second.empty());
+  second.insert("c");
+  AssertSameElements(std::set<std::string>{"c"}, second);
+  moved = first;
+  AssertSameElements(std::set<std::string>{"x", "y", "z"}, moved);
+  first = std::move(copy);
+  AssertSameElements(std::set<std::string>{"y", "z"}, first);
+}
+
+TEST_F(IndexedSetTest, ComparatorAndReserveTest) {
+  s21::indexed_set<int, std::greater<int>> mySet{};
+  mySet.reserve(100);
+  for (int key = 0; key < 100; ++key) {
+    mySet.insert(key);
+  }
+  ASSERT_EQ(*mySet.begin(), 99);
+  ASSERT_EQ(*mySet.lower_bound(50), 50);
+  ASSERT_EQ(*mySet.upper_bound(50), 49);
+  ASSERT_TRUE(mySet.validate());
+  ASSERT_LT(sizeof(s21::IndexedRedBlackTree<int>::node_type),
+            sizeof(TreeNode<int, RedBlackBalance>));
+}
+}  // namespace s21
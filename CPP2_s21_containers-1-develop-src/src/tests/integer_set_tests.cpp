@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class IntegerSetTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (unsigned key : {0U, 1U, 63U, 64U, 65U, 4095U, 4096U, 262144U, 70U}) {
+      stdSetIds.insert(key);
+      mySetIds.insert(key);
+    }
+  }
+
+  template <typename MySet>
+  void AssertSameElements(const std::set<unsigned> &expected,
+                          const MySet &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (unsigned key : expected) {
+      ASSERT_EQ(key, *iter);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::set<unsigned> stdSetIds{};
+  s21::integer_set<unsigned> mySetIds{};
+};
+
+TEST_F(IntegerSetTest, DefaultConstructorTest) {
+  s21::integer_set<unsigned> mySet{};
+  ASSERT_TRUE(mySet.empty());
+  ASSERT_TRUE(mySet.begin() == mySet.end());
+  ASSERT_FALSE(mySet.contains(0));
+  ASSERT_TRUE(mySet.lower_bound(0) == mySet.end());
+  ASSERT_EQ(mySet.erase(5), 0U);
+}
+
+TEST_F(IntegerSetTest, OrderedIterationTest) {
+  AssertSameElements(stdSetIds, mySetIds);
+  auto std_iter = stdSetIds.rbegin();
+  for (auto iter = mySetIds.end(); iter != mySetIds.begin(); ++std_iter) {
+    --iter;
+    ASSERT_EQ(*std_iter, *iter);
+  }
+}
+
+TEST_F(IntegerSetTest, InsertTest) {
+  ASSERT_FALSE(mySetIds.insert(64).second);
+  auto result = mySetIds.insert(1000000);
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(*result.first, 1000000U);
+  stdSetIds.insert(1000000);
+  AssertSameElements(stdSetIds, mySetIds);
+  auto many = mySetIds.insert_many(7U, 7U, 0U);
+  ASSERT_TRUE(many[0].second);
+  ASSERT_FALSE(many[1].second);
+  ASSERT_FALSE(many[2].second);
+}
+
+TEST_F(IntegerSetTest, EraseTest) {
+  ASSERT_EQ(mySetIds.erase(64), 1U);
+  ASSERT_EQ(mySetIds.erase(64), 0U);
+  mySetIds.erase(mySetIds.find(262144));
+  stdSetIds.erase(64);
+  stdSetIds.erase(262144);
+  AssertSameElements(stdSetIds, mySetIds);
+  mySetIds.clear();
+  ASSERT_TRUE(mySetIds.empty());
+  ASSERT_TRUE(mySetIds.begin() == mySetIds.end());
+}
+
+TEST_F(IntegerSetTest, BoundsTest) {
+  for (unsigned probe : {0U, 2U, 62U, 66U, 71U, 4096U, 5000U, 300000U}) {
+    auto std_lower = stdSetIds.lower_bound(probe);
+    auto std_upper = stdSetIds.upper_bound(probe);
+    auto lower = mySetIds.lower_bound(probe);
+    auto upper = mySetIds.upper_bound(probe);
+    ASSERT_EQ(std_lower == stdSetIds.end(), lower == mySetIds.end());
+    ASSERT_EQ(std_upper == stdSetIds.end(), upper == mySetIds.end());
+    if (lower != mySetIds.end()) {
+      ASSERT_EQ(*std_lower, *lower);
+    }
+    if (upper != mySetIds.end()) {
+      ASSERT_EQ(*std_upper, *upper);
+    }
+  }
+  s21::integer_set<unsigned char> bytes{255};
+  ASSERT_TRUE(bytes.upper_bound(255) == bytes.end());
+  ASSERT_EQ(*bytes.lower_bound(200), 255);
+}
+
+TEST_F(IntegerSetTest, LookupTest) {
+  for (unsigned key = 0; key < 5000; ++key) {
+    ASSERT_EQ(stdSetIds.count(key), mySetIds.count(key));
+    ASSERT_EQ(stdSetIds.count(key) != 0, mySetIds.contains(key));
+  }
+  ASSERT_TRUE(mySetIds.find(2) == mySetIds.end());
+  ASSERT_EQ(*mySetIds.find(4095), 4095U);
+  ASSERT_FALSE(mySetIds.contains(4000000000U));
+}
+
+TEST_F(IntegerSetTest, RandomizedTest) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<unsigned> dist(0, 300000);
+  for (int step = 0; step < 20000; ++step) {
+    unsigned key = dist(rng);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(stdSetIds.erase(key), mySetIds.erase(key));
+    } else {
+      ASSERT_EQ(stdSetIds.insert(key).second, mySetIds.insert(key).second);
+    }
+  }
+  AssertSameElements(stdSetIds, mySetIds);
+  for (int step = 0; step < 2000; ++step) {
+    unsigned key = dist(rng);
+    auto std_upper = stdSetIds.upper_bound(key);
+    auto upper = mySetIds.upper_bound(key);
+    ASSERT_EQ(std_upper == stdSetIds.end(), upper == mySetIds.end());
+    if (upper != mySetIds.end()) {
+      ASSERT_EQ(*std_upper, *upper);
+    }
+  }
+}
+
+TEST_F(IntegerSetTest, MergeTest) {
+  s21::integer_set<unsigned> other{1, 2, 64, 9000000};
+  mySetIds.merge(other);
+  stdSetIds.insert({2, 9000000});
+  AssertSameElements(stdSetIds, mySetIds);
+  AssertSameElements({1, 64}, other);
+}
+
+TEST_F(IntegerSetTest, CopySwapAndMoveTest) {
+  s21::integer_set<unsigned> copy(mySetIds);
+  copy.erase(0);
+  ASSERT_TRUE(mySetIds.contains(0));
+  s21::integer_set<unsigned> moved(std::move(copy));
+  ASSERT_EQ(moved.size(), stdSetIds.size() - 1);
+  s21::integer_set<unsigned> small{3};
+  small.swap(moved);
+  ASSERT_EQ(moved.size(), 1U);
+  AssertSameElements(stdSetIds, mySetIds);
+  moved = mySetIds;
+  AssertSameElements(stdSetIds, moved);
+  small = std::move(mySetIds);
+  AssertSameElements(stdSetIds, small);
+}
+}  // namespace s21
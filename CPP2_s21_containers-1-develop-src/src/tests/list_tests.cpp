@@ -1,5 +1,6 @@
 #include <iterator>
 #include <list>
+#include <string>
 
 #include "../s21_containers.h"
 #include "test_utils.h"
@@ -332,4 +333,21 @@ TEST_F(ListTest, InsertManyBackTest) {
   s21::list<int> result{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 6, 7};
   AssertContainerEquality(myListTenElements, result);
 }
+
+TEST_F(ListTest, ClearAsyncTest) {
+  list<std::string> myList{};
+  for (int i = 0; i < 1000; ++i) {
+    myList.push_back(std::to_string(i));
+  }
+  myList.pop_back();
+  myList.clear_async();
+  ASSERT_TRUE(myList.empty());
+  ASSERT_EQ(myList.size(), 0U);
+  myList.push_back("again");
+  ASSERT_EQ(myList.front(), "again");
+  myList.clear_async();
+  myList.clear_async();
+  Reclaimer::Instance().Drain();
+  ASSERT_TRUE(myList.empty());
+}
 }  // namespace s21
\ No newline at end of file
@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "../s21_containers.h"
 #include "test_utils.h"
@@ -393,4 +400,525 @@ TEST_F(MapTest, EmptyTest) {
   AssertContainerEquality(stdMapTenElements, myMapTenElements);
 }
 
-}  // namespace s21
\ No newline at end of file
+
+TEST_F(MapTest, CountAndBoundsTest) {
+  ASSERT_EQ(stdMapTenElements.count(5), myMapTenElements.count(5));
+  ASSERT_EQ(stdMapTenElements.count(50), myMapTenElements.count(50));
+  ASSERT_EQ(stdMapTenElements.lower_bound(5)->first,
+            myMapTenElements.lower_bound(5)->first);
+  ASSERT_EQ(stdMapTenElements.upper_bound(5)->first,
+            myMapTenElements.upper_bound(5)->first);
+  ASSERT_TRUE(myMapTenElements.lower_bound(11) == myMapTenElements.end());
+}
+
+TEST_F(MapTest, EraseByKeyTest) {
+  ASSERT_EQ(stdMapTenElements.erase(3), myMapTenElements.erase(3));
+  ASSERT_EQ(stdMapTenElements.erase(3), myMapTenElements.erase(3));
+  AssertContainerEquality(stdMapTenElements, myMapTenElements);
+}
+
+TEST_F(MapTest, TransparentLookupTest) {
+  std::map<std::string, int, std::less<>> stdMap{
+      {"alpha", 1}, {"beta", 2}, {"gamma", 3}, {"delta", 4}};
+  s21::map<std::string, int, std::less<>> myMap{
+      {"alpha", 1}, {"beta", 2}, {"gamma", 3}, {"delta", 4}};
+  std::string_view view = "gamma";
+
+  ASSERT_EQ(stdMap.find(view)->second, myMap.find(view)->second);
+  ASSERT_EQ(stdMap.find("beta")->second, myMap.find("beta")->second);
+  ASSERT_TRUE(myMap.find(std::string_view("omega")) == myMap.end());
+  ASSERT_TRUE(myMap.contains(view));
+  ASSERT_EQ(stdMap.count("delta"), myMap.count("delta"));
+  ASSERT_EQ(stdMap.lower_bound("c")->first, myMap.lower_bound("c")->first);
+  ASSERT_EQ(stdMap.upper_bound(view) == stdMap.end(),
+            myMap.upper_bound(view) == myMap.end());
+  ASSERT_EQ(stdMap.erase(std::string("alpha")),
+            myMap.erase(std::string_view("alpha")));
+  AssertContainerEquality(stdMap, myMap);
+}
+
+TEST_F(MapTest, CustomCompareTest) {
+  std::map<int, int, std::greater<int>> stdMap{{1, 1}, {3, 3}, {2, 2}};
+  s21::map<int, int, std::greater<int>> myMap{{1, 1}, {3, 3}, {2, 2}};
+  AssertContainerEquality(stdMap, myMap);
+  ASSERT_EQ(stdMap.lower_bound(2)->first, myMap.lower_bound(2)->first);
+}
+
+TEST_F(MapTest, StatsAndValidateTest) {
+  ASSERT_TRUE(myMapTenElements.validate());
+  ASSERT_EQ(myMapTenElements.stats().node_count, myMapTenElements.size());
+  for (int i = 0; i < 11; i += 3) {
+    myMapTenElements.erase(i);
+    ASSERT_TRUE(myMapTenElements.validate());
+  }
+  TreeStats stats = myMapTenElements.stats();
+  ASSERT_EQ(stats.node_count, 7U);
+  ASSERT_LE(stats.height, 6U);
+}
+
+TEST_F(MapTest, AvlBalanceTest) {
+  std::map<int, int> stdMap{};
+  s21::map<int, int, std::less<int>, AvlBalance> myMap{};
+  for (int i = 0; i < 300; ++i) {
+    stdMap.insert({i, -i});
+    myMap.insert({i, -i});
+    ASSERT_TRUE(myMap.validate());
+  }
+  ASSERT_LE(myMap.stats().height, 11U);
+  for (int i = 299; i >= 0; i -= 2) {
+    ASSERT_EQ(stdMap.erase(i), myMap.erase(i));
+    ASSERT_TRUE(myMap.validate());
+  }
+  AssertContainerEquality(stdMap, myMap);
+}
+
+TEST_F(MapTest, FindManyTest) {
+  std::map<int, int> stdMap{};
+  s21::map<int, int> myMap{};
+  for (int i = 0; i < 100; ++i) {
+    stdMap.insert({i * 5, i});
+    myMap.insert({i * 5, i});
+  }
+  std::vector<int> keys;
+  for (int i = 0; i < 600; i += 7) {
+    keys.push_back(i);
+  }
+  std::vector<s21::map<int, int>::iterator> found(keys.size());
+  myMap.find_many(keys.begin(), keys.end(), found.begin());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    auto expected = stdMap.find(keys[i]);
+    ASSERT_EQ(expected == stdMap.end(), found[i] == myMap.end());
+    if (expected != stdMap.end()) {
+      ASSERT_EQ(expected->second, found[i]->second);
+    }
+  }
+  bool present[2];
+  int probes[2] = {5, 6};
+  myMap.contains_many(probes, probes + 2, present);
+  ASSERT_TRUE(present[0]);
+  ASSERT_FALSE(present[1]);
+}
+
+TEST_F(MapTest, EraseReturnsNextTest) {
+  auto next = myMapTenElements.erase(myMapTenElements.find(4));
+  auto std_next = stdMapTenElements.erase(stdMapTenElements.find(4));
+  ASSERT_EQ(std_next->first, next->first);
+  AssertContainerEquality(stdMapTenElements, myMapTenElements);
+  ASSERT_TRUE(myMapTenElements.validate());
+}
+
+TEST_F(MapTest, EraseRangeTest) {
+  auto next = myMapTenElements.erase(myMapTenElements.begin(),
+                                     myMapTenElements.find(6));
+  auto std_next = stdMapTenElements.erase(stdMapTenElements.begin(),
+                                          stdMapTenElements.find(6));
+  ASSERT_EQ(std_next->first, next->first);
+  AssertContainerEquality(stdMapTenElements, myMapTenElements);
+  ASSERT_TRUE(myMapTenElements.validate());
+  myMapTenElements.erase(next, myMapTenElements.end());
+  ASSERT_TRUE(myMapTenElements.empty());
+}
+
+TEST_F(MapTest, ParallelForEachAndReduceTest) {
+  s21::map<int, int> myMap{};
+  for (int i = 0; i < 4000; ++i) {
+    myMap.insert(i, i);
+  }
+  myMap.parallel_for_each(
+      [](std::pair<const int, int> &item) { item.second *= 2; }, 3);
+  long long sum = myMap.parallel_reduce(
+      0LL,
+      [](long long acc, const std::pair<const int, int> &item) {
+        return acc + item.second;
+      },
+      std::plus<long long>(), 3);
+  ASSERT_EQ(sum, 4000LL * 3999);
+  int last_key = myMap.parallel_reduce(
+      -1,
+      [](int, const std::pair<const int, int> &item) { return item.first; },
+      [](int lhs, int rhs) { return rhs < 0 ? lhs : rhs; }, 5);
+  ASSERT_EQ(last_key, 3999);
+  ASSERT_TRUE(myMap.validate());
+}
+
+TEST_F(MapTest, CompactTest) {
+  s21::map<int, std::string> myMap{};
+  std::map<int, std::string> stdMap{};
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 3001;
+    myMap.insert(key, std::to_string(key));
+    stdMap.insert({key, std::to_string(key)});
+  }
+  for (int key = 0; key < 3001; key += 3) {
+    myMap.erase(myMap.find(key));
+    stdMap.erase(key);
+  }
+  size_t bytes_before = myMap.stats().bytes_used;
+  myMap.compact();
+  ASSERT_LT(myMap.stats().bytes_used, bytes_before);
+  AssertContainerEquality(stdMap, myMap);
+  ASSERT_TRUE(myMap.validate());
+
+  // In key order the elements now sit at a constant stride
+  auto prev = myMap.begin();
+  auto next = std::next(prev);
+  std::ptrdiff_t stride = reinterpret_cast<const char *>(&*next) -
+                          reinterpret_cast<const char *>(&*prev);
+  ASSERT_GT(stride, 0);
+  for (prev = next++; next != myMap.end(); prev = next++) {
+    ASSERT_EQ(reinterpret_cast<const char *>(&*next) -
+                  reinterpret_cast<const char *>(&*prev),
+              stride);
+  }
+
+  myMap.compact(NodeLayout::kVanEmdeBoas);
+  AssertContainerEquality(stdMap, myMap);
+  ASSERT_TRUE(myMap.validate());
+  myMap.insert(-1, "-1");
+  stdMap.insert({-1, "-1"});
+  myMap.erase(myMap.find(1));
+  stdMap.erase(1);
+  AssertContainerEquality(stdMap, myMap);
+  ASSERT_TRUE(myMap.validate());
+}
+
+TEST_F(MapTest, ReserveTest) {
+  s21::map<int, int> myMap{};
+  myMap.reserve(5000);
+  size_t reserved = myMap.stats().bytes_used;
+  for (int i = 0; i < 5000; ++i) {
+    myMap.insert(i, i);
+  }
+  ASSERT_EQ(myMap.stats().bytes_used, reserved);
+  ASSERT_EQ(myMap.size(), 5000U);
+  ASSERT_TRUE(myMap.validate());
+  myMap.reserve(100);
+  ASSERT_EQ(myMap.stats().bytes_used, reserved);
+  myMap.clear();
+  ASSERT_LT(myMap.stats().bytes_used, reserved);
+}
+
+TEST_F(MapTest, FindFromTest) {
+  s21::map<int, int> myMap{};
+  for (int i = 0; i < 300; ++i) {
+    myMap.insert(i * 2, i);
+  }
+  for (auto finger = myMap.begin(); finger != myMap.end(); ++finger) {
+    for (int key = -1; key < 601; key += 7) {
+      auto found = myMap.find_from(finger, key);
+      ASSERT_TRUE(found == myMap.find(key));
+    }
+  }
+  ASSERT_EQ(myMap.find_from(myMap.end(), 10)->second, 5);
+}
+
+TEST_F(MapTest, LookupCacheTest) {
+  s21::map<int, int> myMap{};
+  std::map<int, int> stdMap{};
+  myMap.set_lookup_cache(true);
+  for (int i = 0; i < 1000; ++i) {
+    myMap[i % 100] += i;
+    stdMap[i % 100] += i;
+    ASSERT_EQ(myMap.at(i % 100), stdMap.at(i % 100));
+  }
+  for (int key = 0; key < 100; key += 3) {
+    ASSERT_TRUE(myMap.contains(key));
+    ASSERT_EQ(myMap.erase(key), 1U);
+    stdMap.erase(key);
+    ASSERT_FALSE(myMap.contains(key));
+    ASSERT_TRUE(myMap.find(key) == myMap.end());
+  }
+  AssertContainerEquality(stdMap, myMap);
+  myMap.find(50);
+  myMap.compact();
+  ASSERT_EQ(myMap.at(50), stdMap.at(50));
+  ASSERT_EQ(myMap.at(52), stdMap.at(52));
+  myMap.erase(myMap.find(52));
+  stdMap.erase(52);
+
+  s21::map<int, int> other{};
+  other.swap(myMap);
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_FALSE(myMap.contains(50));
+  ASSERT_EQ(other.at(50), stdMap.at(50));
+  other.clear();
+  ASSERT_FALSE(other.contains(50));
+  ASSERT_TRUE(other.validate());
+}
+
+TEST_F(MapTest, ParallelCopyTest) {
+  s21::map<int, std::string> myMap{};
+  for (int i = 0; i < 40000; ++i) {
+    myMap.insert((i * 7919) % 40009, std::to_string(i));
+  }
+  for (size_t threads : {1, 3, 4}) {
+    s21::map<int, std::string> copy(myMap, threads);
+    ASSERT_EQ(copy.size(), myMap.size());
+    ASSERT_TRUE(copy.validate());
+    ASSERT_TRUE(std::equal(copy.begin(), copy.end(), myMap.begin()));
+    copy[1] = "changed";
+    copy.erase(copy.begin());
+    ASSERT_NE(myMap.at(1), "changed");
+    ASSERT_EQ(copy.size() + 1, myMap.size());
+  }
+  s21::map<int, std::string> empty{};
+  s21::map<int, std::string> emptyCopy(empty, 4);
+  ASSERT_TRUE(emptyCopy.empty());
+}
+
+// Counts live instances, to tell when the reclaimer has run
+struct TrackedValue {
+  static std::atomic<int> live;
+  int value;
+
+  TrackedValue(int v = 0) : value(v) { ++live; }
+  TrackedValue(const TrackedValue &other) : value(other.value) { ++live; }
+  TrackedValue &operator=(const TrackedValue &other) = default;
+  ~TrackedValue() { --live; }
+};
+
+std::atomic<int> TrackedValue::live{0};
+
+TEST_F(MapTest, ClearAsyncTest) {
+  {
+    // The tree's sentinel node holds a value too
+    s21::map<int, TrackedValue> myMap{};
+    int sentinel = TrackedValue::live.load();
+    for (int i = 0; i < 5000; ++i) {
+      myMap.insert(i, TrackedValue(i));
+    }
+    ASSERT_EQ(TrackedValue::live.load(), sentinel + 5000);
+    myMap.clear_async();
+    ASSERT_TRUE(myMap.empty());
+    ASSERT_TRUE(myMap.begin() == myMap.end());
+    ASSERT_FALSE(myMap.contains(1));
+    myMap.insert(1, TrackedValue(10));
+    ASSERT_EQ(myMap.at(1).value, 10);
+    ASSERT_TRUE(myMap.validate());
+    Reclaimer::Instance().Drain();
+    ASSERT_EQ(TrackedValue::live.load(), sentinel + 1);
+  }
+  ASSERT_EQ(TrackedValue::live.load(), 0);
+
+  s21::map<int, int> plain{};
+  for (int i = 0; i < 5000; ++i) {
+    plain.insert(i, i);
+  }
+  plain.clear_async();
+  plain.clear_async();
+  plain.insert(3, 4);
+  plain.clear();
+  ASSERT_TRUE(plain.empty());
+  Reclaimer::Instance().Drain();
+}
+
+TEST_F(MapTest, EraseIfTest) {
+  s21::map<int, std::string> myMap{};
+  std::map<int, std::string> stdMap{};
+  for (int i = 0; i < 3000; ++i) {
+    myMap.insert(i, std::to_string(i % 10));
+    stdMap.insert({i, std::to_string(i % 10)});
+  }
+  // Few removals go one by one, many rebuild the tree
+  auto survivor = myMap.find(1501);
+  for (int modulus : {1000, 3, 2}) {
+    auto pred = [modulus](const std::pair<const int, std::string> &item) {
+      return item.first % modulus == 0;
+    };
+    size_t expected = 0;
+    for (auto it = stdMap.begin(); it != stdMap.end();) {
+      if (pred(*it)) {
+        it = stdMap.erase(it);
+        ++expected;
+      } else {
+        ++it;
+      }
+    }
+    ASSERT_EQ(s21::erase_if(myMap, pred), expected);
+    AssertContainerEquality(stdMap, myMap);
+    ASSERT_TRUE(myMap.validate());
+    ASSERT_EQ(survivor->first, 1501);
+  }
+  ASSERT_EQ(erase_if(myMap, [](const auto &) { return false; }), 0U);
+  myMap.insert(-1, "x");
+  myMap.erase(1501);
+  ASSERT_TRUE(myMap.validate());
+  ASSERT_EQ(erase_if(myMap, [](const auto &) { return true; }),
+            stdMap.size());
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_TRUE(myMap.validate());
+  s21::map<int, int> empty{};
+  ASSERT_EQ(erase_if(empty, [](const auto &) { return true; }), 0U);
+}
+
+TEST_F(MapTest, EraseIfThrowTest) {
+  s21::map<int, int> myMap{};
+  for (int i = 0; i < 1000; ++i) {
+    myMap.insert(i, i);
+  }
+  // Removing every even key takes the rebuild path; pred gives up at 700
+  auto pred = [](const std::pair<const int, int> &item) {
+    if (item.first == 700) {
+      throw std::runtime_error("expired");
+    }
+    return item.first % 2 == 0;
+  };
+  ASSERT_THROW(s21::erase_if(myMap, pred), std::runtime_error);
+  ASSERT_EQ(myMap.size(), 650U);
+  ASSERT_TRUE(myMap.validate());
+  ASSERT_FALSE(myMap.contains(698));
+  ASSERT_TRUE(myMap.contains(699));
+  ASSERT_TRUE(myMap.contains(700));
+  ASSERT_TRUE(myMap.contains(702));
+  // A skewed tail: the sample keeps everything, the rest goes one by one
+  ASSERT_EQ(s21::erase_if(myMap, [](const auto &item) {
+              return item.first > 900;
+            }),
+            99U);
+  ASSERT_TRUE(myMap.validate());
+  ASSERT_EQ(myMap.size(), 551U);
+}
+
+TEST_F(MapTest, RangeInsertTest) {
+  s21::map<int, std::string> myMap{};
+  std::map<int, std::string> stdMap{};
+  for (int i = 0; i < 1000; i += 2) {
+    myMap.insert(i, "old");
+    stdMap.insert({i, "old"});
+  }
+  auto survivor = myMap.find(500);
+  // A small batch goes in one by one, a large one is merged; existing keys
+  // keep their values and the first of equal keys in a batch wins
+  for (int count : {8, 4000}) {
+    std::vector<std::pair<int, std::string>> batch;
+    for (int i = 0; i < count; ++i) {
+      int key = (i * 7919) % (count / 2);
+      batch.emplace_back(key, std::to_string(i));
+    }
+    myMap.insert(batch.begin(), batch.end());
+    for (const auto &item : batch) {
+      stdMap.insert(item);
+    }
+    AssertContainerEquality(stdMap, myMap);
+    ASSERT_TRUE(myMap.validate());
+    ASSERT_EQ(survivor->second, "old");
+  }
+  s21::map<long, long> numbers{};
+  numbers.insert(1, 2);
+  ASSERT_EQ(numbers.at(1), 2);
+}
+
+TEST_F(MapTest, PartitionTest) {
+  s21::map<int, long> myMap{};
+  long expected = 0;
+  for (int i = 0; i < 20000; ++i) {
+    myMap.insert(i * 3, i);
+    expected += i;
+  }
+  // Each range goes to a thread of its own, with no copy of the map
+  auto ranges = myMap.partition(4);
+  std::vector<long> sums(ranges.size());
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    workers.emplace_back([&ranges, &sums, i]() {
+      for (auto it = ranges[i].first; it != ranges[i].second; ++it) {
+        sums[i] += it->second;
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  long total = 0;
+  for (long sum : sums) {
+    ASSERT_GT(sum, 0);
+    total += sum;
+  }
+  ASSERT_EQ(total, expected);
+}
+
+TEST_F(MapTest, CopyAssignReusesNodesTest) {
+  s21::map<int, std::string> source{};
+  s21::map<int, std::string> target{};
+  std::map<int, std::string> stdMap{};
+  for (int i = 0; i < 1000; ++i) {
+    target.insert(i, "old " + std::to_string(i));
+  }
+  for (int i = 0; i < 300; ++i) {
+    source.insert(i * 7, std::to_string(i));
+    stdMap.insert({i * 7, std::to_string(i)});
+  }
+  // Shrinking keeps the node storage; the shape is the source's
+  size_t bytes = target.stats().bytes_used;
+  target = source;
+  AssertContainerEquality(stdMap, target);
+  ASSERT_TRUE(target.validate());
+  ASSERT_EQ(target.stats().bytes_used, bytes);
+  ASSERT_EQ(target.stats().height, source.stats().height);
+  source.insert(-1, "new");
+  ASSERT_FALSE(target.contains(-1));
+  // Growing allocates only the missing nodes
+  for (int i = 0; i < 2000; ++i) {
+    source.insert(i * 5 + 1, "grown");
+    stdMap.insert({i * 5 + 1, "grown"});
+  }
+  stdMap.insert({-1, "new"});
+  target = source;
+  AssertContainerEquality(stdMap, target);
+  ASSERT_TRUE(target.validate());
+  target.erase(1);
+  target.insert(3, "three");
+  ASSERT_TRUE(target.validate());
+  source = s21::map<int, std::string>{};
+  target = source;
+  ASSERT_TRUE(target.empty());
+  ASSERT_TRUE(target.validate());
+}
+
+// Counts live instances and fails the copy after copies_left more
+struct FlakyValue {
+  static int live;
+  static int copies_left;
+  int value;
+
+  FlakyValue(int v = 0) : value(v) { ++live; }
+  FlakyValue(const FlakyValue &other) : value(other.value) {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    --copies_left;
+    ++live;
+  }
+  FlakyValue &operator=(const FlakyValue &other) = default;
+  ~FlakyValue() { --live; }
+};
+
+int FlakyValue::live = 0;
+int FlakyValue::copies_left = -1;
+
+TEST_F(MapTest, CopyAssignThrowTest) {
+  int baseline = FlakyValue::live;
+  {
+    s21::map<int, FlakyValue> source{};
+    s21::map<int, FlakyValue> target{};
+    for (int i = 0; i < 200; ++i) {
+      source.insert(i, FlakyValue(i));
+      if (i % 2 == 0) {
+        target.insert(i, FlakyValue(-i));
+      }
+    }
+    // Fails past the recycled nodes, while allocating new ones
+    FlakyValue::copies_left = 150;
+    ASSERT_THROW(target = source, std::runtime_error);
+    FlakyValue::copies_left = -1;
+    ASSERT_TRUE(target.empty());
+    ASSERT_TRUE(target.validate());
+    target = source;
+    ASSERT_EQ(target.size(), 200U);
+    ASSERT_EQ(target.at(199).value, 199);
+    ASSERT_TRUE(target.validate());
+  }
+  ASSERT_EQ(FlakyValue::live, baseline);
+}
+
+}  // namespace s21
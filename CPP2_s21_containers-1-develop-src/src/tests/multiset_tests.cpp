@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <functional>
+#include <iterator>
 #include <set>
 #include <type_traits>
 
@@ -235,4 +238,144 @@ TEST_F(MultisetTest, EqualRange3) {
 
   AssertContainerEquality(stdMultisetTenElements, myMultisetTenElements);
 }
-}  // namespace s21
\ No newline at end of file
+
+TEST_F(MultisetTest, CountTest) {
+  myMultisetTenElements.insert_many(5, 5, 7);
+  stdMultisetTenElements.insert({5, 5, 7});
+  ASSERT_EQ(stdMultisetTenElements.count(5), myMultisetTenElements.count(5));
+  ASSERT_EQ(stdMultisetTenElements.count(7), myMultisetTenElements.count(7));
+  ASSERT_EQ(stdMultisetTenElements.count(0), myMultisetTenElements.count(0));
+}
+
+TEST_F(MultisetTest, FindReturnsFirstEqualTest) {
+  myMultisetTenElements.insert_many(5, 5);
+  auto it = myMultisetTenElements.find(5);
+  ASSERT_TRUE(it == myMultisetTenElements.lower_bound(5));
+  ASSERT_TRUE(myMultisetTenElements.find(42) == myMultisetTenElements.end());
+}
+
+TEST_F(MultisetTest, EraseByKeyTest) {
+  myMultisetTenElements.insert_many(5, 5);
+  stdMultisetTenElements.insert({5, 5});
+  ASSERT_EQ(stdMultisetTenElements.erase(5), myMultisetTenElements.erase(5));
+  ASSERT_EQ(stdMultisetTenElements.erase(5), myMultisetTenElements.erase(5));
+  AssertContainerEquality(stdMultisetTenElements, myMultisetTenElements);
+}
+
+TEST_F(MultisetTest, TransparentLookupTest) {
+  std::multiset<std::string, std::less<>> stdMultiset{"a", "b", "b", "c"};
+  s21::multiset<std::string, std::less<>> myMultiset{"a", "b", "b", "c"};
+  std::string_view view = "b";
+
+  ASSERT_EQ(stdMultiset.count(view), myMultiset.count(view));
+  ASSERT_EQ(*stdMultiset.find(view), *myMultiset.find(view));
+  ASSERT_TRUE(myMultiset.contains("c"));
+  auto my_range = myMultiset.equal_range(view);
+  ASSERT_EQ(*my_range.second, "c");
+  ASSERT_EQ(stdMultiset.erase(std::string(view)), myMultiset.erase(view));
+  AssertContainerEquality(stdMultiset, myMultiset);
+}
+
+TEST_F(MultisetTest, StatsAndValidateTest) {
+  for (int i = 0; i < 200; ++i) {
+    myMultisetTenElements.insert(i % 10);
+  }
+  ASSERT_TRUE(myMultisetTenElements.validate());
+  ASSERT_EQ(myMultisetTenElements.stats().node_count, 210U);
+  myMultisetTenElements.erase(3);
+  ASSERT_TRUE(myMultisetTenElements.validate());
+  ASSERT_EQ(myMultisetTenElements.stats().node_count, 189U);
+}
+
+TEST_F(MultisetTest, AvlBalanceTest) {
+  std::multiset<int> stdMultiset{};
+  s21::multiset<int, std::less<int>, AvlBalance> myMultiset{};
+  for (int i = 0; i < 400; ++i) {
+    stdMultiset.insert(i % 37);
+    myMultiset.insert(i % 37);
+  }
+  ASSERT_TRUE(myMultiset.validate());
+  AssertContainerEquality(stdMultiset, myMultiset);
+  ASSERT_EQ(stdMultiset.erase(5), myMultiset.erase(5));
+  ASSERT_EQ(stdMultiset.count(6), myMultiset.count(6));
+  ASSERT_TRUE(myMultiset.validate());
+  AssertContainerEquality(stdMultiset, myMultiset);
+}
+
+TEST_F(MultisetTest, EraseIteratorRemovesThatElementTest) {
+  s21::multiset<int> myMultiset{1, 2, 2, 2, 3};
+  std::multiset<int> stdMultiset{1, 2, 2, 3};
+  auto next = myMultiset.erase(std::next(myMultiset.begin(), 2));
+  ASSERT_EQ(*next, 2);
+  AssertContainerEquality(stdMultiset, myMultiset);
+  next = myMultiset.erase(myMultiset.lower_bound(2),
+                          myMultiset.upper_bound(2));
+  ASSERT_EQ(*next, 3);
+  stdMultiset.erase(2);
+  AssertContainerEquality(stdMultiset, myMultiset);
+  ASSERT_TRUE(myMultiset.validate());
+}
+
+TEST_F(MultisetTest, ParallelReduceTest) {
+  s21::multiset<int> myMultiset{};
+  for (int i = 0; i < 2000; ++i) {
+    myMultiset.insert(i % 10);
+  }
+  ASSERT_EQ(myMultiset.parallel_reduce(0, std::plus<int>(), 4), 9000);
+  std::atomic<int> nines{0};
+  myMultiset.parallel_for_each([&nines](int key) { nines += key == 9; }, 4);
+  ASSERT_EQ(nines, 200);
+}
+
+TEST_F(MultisetTest, CompactTest) {
+  s21::multiset<int, std::less<int>, AvlBalance> myMultiset{};
+  std::multiset<int> stdMultiset{};
+  for (int i = 0; i < 2000; ++i) {
+    myMultiset.insert(i % 37);
+    stdMultiset.insert(i % 37);
+  }
+  for (NodeLayout layout : {NodeLayout::kVanEmdeBoas, NodeLayout::kInOrder}) {
+    myMultiset.compact(layout);
+    AssertContainerEquality(stdMultiset, myMultiset);
+    ASSERT_TRUE(myMultiset.validate());
+  }
+  s21::multiset<int> empty{};
+  empty.compact();
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST_F(MultisetTest, EraseIfTest) {
+  s21::multiset<int> myMultiset{};
+  std::multiset<int> stdMultiset{};
+  for (int i = 0; i < 5000; ++i) {
+    myMultiset.insert(i % 50);
+    stdMultiset.insert(i % 50);
+  }
+  ASSERT_EQ(s21::erase_if(myMultiset, [](int key) { return key < 40; }),
+            4000U);
+  stdMultiset.erase(stdMultiset.begin(), stdMultiset.lower_bound(40));
+  AssertContainerEquality(stdMultiset, myMultiset);
+  ASSERT_TRUE(myMultiset.validate());
+  ASSERT_EQ(myMultiset.count(45), 100U);
+}
+
+TEST_F(MultisetTest, PartitionTest) {
+  s21::multiset<int> myMultiset{};
+  for (int i = 0; i < 3000; ++i) {
+    myMultiset.insert(i % 10);
+  }
+  auto ranges = myMultiset.partition(4);
+  ASSERT_EQ(ranges.size(), 4U);
+  ASSERT_TRUE(ranges.front().first == myMultiset.begin());
+  ASSERT_TRUE(ranges.back().second == myMultiset.end());
+  size_t total = 0;
+  for (const auto &range : ranges) {
+    size_t count = std::distance(range.first, range.second);
+    ASSERT_GT(count, 500U);
+    ASSERT_LT(count, 1000U);
+    total += count;
+  }
+  ASSERT_EQ(total, myMultiset.size());
+}
+
+}  // namespace s21
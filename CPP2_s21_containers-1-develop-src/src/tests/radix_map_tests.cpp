@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class RadixMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (const char *url : {"/", "/api", "/api/v1", "/api/v1/users",
+                            "/api/v2", "/about", "/static/app.js", "/b"}) {
+      stdMapUrls.insert({url, static_cast<int>(stdMapUrls.size())});
+      myMapUrls.insert(url, static_cast<int>(myMapUrls.size()));
+    }
+  }
+
+  template <typename StdMap, typename MyMap>
+  void AssertSameElements(const StdMap &expected, const MyMap &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::map<std::string, int> stdMapUrls{};
+  s21::radix_map<std::string, int> myMapUrls{};
+};
+
+TEST_F(RadixMapTest, DefaultConstructorTest) {
+  s21::radix_map<std::string, int> myMap{};
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+  ASSERT_FALSE(myMap.contains(""));
+}
+
+TEST_F(RadixMapTest, OrderedIterationTest) {
+  AssertSameElements(stdMapUrls, myMapUrls);
+  auto std_iter = stdMapUrls.rbegin();
+  for (auto iter = myMapUrls.end(); iter != myMapUrls.begin(); ++std_iter) {
+    --iter;
+    ASSERT_EQ(std_iter->first, iter->first);
+  }
+}
+
+TEST_F(RadixMapTest, LookupTest) {
+  for (const auto &item : stdMapUrls) {
+    ASSERT_TRUE(myMapUrls.contains(item.first));
+    ASSERT_EQ(item.second, myMapUrls.at(item.first));
+    ASSERT_EQ(item.second, myMapUrls.find(item.first)->second);
+  }
+  ASSERT_FALSE(myMapUrls.contains("/ap"));
+  ASSERT_FALSE(myMapUrls.contains("/api/v1/"));
+  ASSERT_EQ(myMapUrls.count("/api/v3"), 0U);
+  ASSERT_TRUE(myMapUrls.find("/apx") == myMapUrls.end());
+  ASSERT_THROW(myMapUrls.at("/missing"), std::out_of_range);
+}
+
+TEST_F(RadixMapTest, InsertTest) {
+  ASSERT_FALSE(myMapUrls.insert("/api", 100).second);
+  ASSERT_EQ(myMapUrls.insert_or_assign("/api", 100).first->second, 100);
+  ASSERT_TRUE(myMapUrls.insert("", -1).second);
+  myMapUrls["/api/v1/users/42"] = 42;
+  stdMapUrls["/api"] = 100;
+  stdMapUrls[""] = -1;
+  stdMapUrls["/api/v1/users/42"] = 42;
+  AssertSameElements(stdMapUrls, myMapUrls);
+}
+
+TEST_F(RadixMapTest, EraseTest) {
+  ASSERT_EQ(myMapUrls.erase("/api/v1"), 1U);
+  ASSERT_EQ(myMapUrls.erase("/api/v1"), 0U);
+  myMapUrls.erase(myMapUrls.find("/"));
+  stdMapUrls.erase("/api/v1");
+  stdMapUrls.erase("/");
+  AssertSameElements(stdMapUrls, myMapUrls);
+  while (!stdMapUrls.empty()) {
+    ASSERT_EQ(myMapUrls.erase(stdMapUrls.begin()->first), 1U);
+    stdMapUrls.erase(stdMapUrls.begin());
+    AssertSameElements(stdMapUrls, myMapUrls);
+  }
+}
+
+TEST_F(RadixMapTest, BoundsTest) {
+  for (const char *probe : {"", "/", "/a", "/api/", "/api/v1/usera",
+                            "/api/v1/users0", "/c", "~"}) {
+    auto std_lower = stdMapUrls.lower_bound(probe);
+    auto std_upper = stdMapUrls.upper_bound(probe);
+    auto lower = myMapUrls.lower_bound(probe);
+    auto upper = myMapUrls.upper_bound(probe);
+    ASSERT_EQ(std_lower == stdMapUrls.end(), lower == myMapUrls.end());
+    ASSERT_EQ(std_upper == stdMapUrls.end(), upper == myMapUrls.end());
+    if (lower != myMapUrls.end()) {
+      ASSERT_EQ(std_lower->first, lower->first);
+    }
+    if (upper != myMapUrls.end()) {
+      ASSERT_EQ(std_upper->first, upper->first);
+    }
+  }
+}
+
+TEST_F(RadixMapTest, PrefixRangeTest) {
+  auto range = myMapUrls.prefix_range("/api/v");
+  s21::vector<std::string> found;
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    found.push_back(iter->first);
+  }
+  ASSERT_EQ(found.size(), 3U);
+  ASSERT_EQ(found[0], "/api/v1");
+  ASSERT_EQ(found[1], "/api/v1/users");
+  ASSERT_EQ(found[2], "/api/v2");
+  range = myMapUrls.prefix_range("/nothing");
+  ASSERT_TRUE(range.first == range.second);
+  range = myMapUrls.prefix_range("");
+  ASSERT_TRUE(range.first == myMapUrls.begin());
+  ASSERT_TRUE(range.second == myMapUrls.end());
+}
+
+TEST_F(RadixMapTest, LongCommonPrefixTest) {
+  std::string base(40, 'k');
+  std::map<std::string, int> stdMap{};
+  s21::radix_map<std::string, int> myMap{};
+  for (int i = 0; i < 300; ++i) {
+    std::string key = base + std::to_string(i % 7) + base + std::to_string(i);
+    stdMap.insert({key, i});
+    myMap.insert(key, i);
+  }
+  AssertSameElements(stdMap, myMap);
+  for (int i = 0; i < 300; i += 2) {
+    std::string key = base + std::to_string(i % 7) + base + std::to_string(i);
+    ASSERT_EQ(stdMap.erase(key), myMap.erase(key));
+  }
+  AssertSameElements(stdMap, myMap);
+}
+
+TEST_F(RadixMapTest, NodeGrowthAndShrinkTest) {
+  std::map<std::string, int> stdMap{};
+  s21::radix_map<std::string, int> myMap{};
+  for (int byte = 0; byte < 256; ++byte) {
+    std::string key = "p" + std::string(1, static_cast<char>(byte));
+    stdMap.insert({key, byte});
+    myMap.insert(key, byte);
+  }
+  AssertSameElements(stdMap, myMap);
+  for (int byte = 255; byte >= 0; byte -= 1) {
+    std::string key = "p" + std::string(1, static_cast<char>(byte));
+    ASSERT_EQ(stdMap.erase(key), myMap.erase(key));
+    if (byte % 17 == 0) {
+      AssertSameElements(stdMap, myMap);
+    }
+  }
+  ASSERT_TRUE(myMap.empty());
+}
+
+TEST_F(RadixMapTest, IntegerKeysTest) {
+  std::map<int, int> stdMap{};
+  s21::radix_map<int, int> myMap{};
+  for (int i = -500; i < 500; i += 3) {
+    stdMap.insert({i * 7919, i});
+    myMap.insert(i * 7919, i);
+  }
+  AssertSameElements(stdMap, myMap);
+  ASSERT_EQ(stdMap.lower_bound(-1)->first, myMap.lower_bound(-1)->first);
+  ASSERT_EQ(stdMap.upper_bound(0)->first, myMap.upper_bound(0)->first);
+  for (int i = -500; i < 500; i += 6) {
+    ASSERT_EQ(stdMap.erase(i * 7919), myMap.erase(i * 7919));
+  }
+  AssertSameElements(stdMap, myMap);
+}
+
+TEST_F(RadixMapTest, CopyAndMoveTest) {
+  s21::radix_map<std::string, int> copy(myMapUrls);
+  AssertSameElements(stdMapUrls, copy);
+  copy.erase("/api");
+  ASSERT_TRUE(myMapUrls.contains("/api"));
+  s21::radix_map<std::string, int> moved(std::move(copy));
+  ASSERT_EQ(moved.size(), stdMapUrls.size() - 1);
+  copy = moved;
+  ASSERT_EQ(copy.size(), moved.size());
+  moved = std::move(myMapUrls);
+  AssertSameElements(stdMapUrls, moved);
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  ASSERT_TRUE(moved.begin() == moved.end());
+}
+}  // namespace s21
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class ScoredSetTest : public ::testing::Test {
+ protected:
+  using Ranking = std::vector<std::pair<std::string, int>>;
+
+  // The members of a std::map model in rank order: by score, then by name
+  static Ranking Ranked(const std::map<std::string, int> &scores) {
+    Ranking ranking(scores.begin(), scores.end());
+    std::stable_sort(ranking.begin(), ranking.end(),
+                     [](const std::pair<std::string, int> &lhs,
+                        const std::pair<std::string, int> &rhs) {
+                       return lhs.second < rhs.second;
+                     });
+    return ranking;
+  }
+
+  template <typename Vector>
+  void AssertSameRun(const Ranking &expected, size_t first, size_t last,
+                     const Vector &actual) {
+    ASSERT_EQ(last - first, actual.size());
+    for (size_t i = first; i < last; ++i) {
+      ASSERT_EQ(expected[i].first, actual.data()[i - first].first);
+      ASSERT_EQ(expected[i].second, actual.data()[i - first].second);
+    }
+  }
+
+  void AssertSameElements(const std::map<std::string, int> &scores,
+                          s21::scored_set<std::string, int> &actual) {
+    ASSERT_EQ(scores.size(), actual.size());
+    ASSERT_EQ(scores.empty(), actual.empty());
+    Ranking ranking = Ranked(scores);
+    AssertSameRun(ranking, 0, ranking.size(),
+                  actual.range_by_rank(0, actual.size()));
+    for (size_t i = 0; i < ranking.size(); ++i) {
+      ASSERT_EQ(i, actual.rank(ranking[i].first));
+      ASSERT_EQ(ranking[i].second, actual.at(ranking[i].first));
+    }
+    ASSERT_TRUE(actual.validate());
+  }
+
+  s21::scored_set<std::string, int> board{
+      {"carol", 30}, {"alice", 10}, {"dave", 20}, {"bob", 20}};
+};
+
+TEST_F(ScoredSetTest, DefaultConstructorTest) {
+  s21::scored_set<int, double> empty{};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.size(), 0U);
+  ASSERT_EQ(empty.range_by_rank(0, 10).size(), 0U);
+  ASSERT_EQ(empty.count_by_score(0.0, 1.0), 0U);
+  ASSERT_THROW(empty.rank(1), std::out_of_range);
+  ASSERT_THROW(empty.at(1), std::out_of_range);
+  ASSERT_TRUE(empty.validate());
+}
+
+TEST_F(ScoredSetTest, RankTest) {
+  ASSERT_EQ(board.size(), 4U);
+  ASSERT_EQ(board.rank("alice"), 0U);
+  // Equal scores are ranked by member
+  ASSERT_EQ(board.rank("bob"), 1U);
+  ASSERT_EQ(board.rank("dave"), 2U);
+  ASSERT_EQ(board.rank("carol"), 3U);
+  ASSERT_THROW(board.rank("eve"), std::out_of_range);
+  auto top = board.range_by_rank(2, 10);
+  ASSERT_EQ(top.size(), 2U);
+  ASSERT_EQ(top[0].first, "dave");
+  ASSERT_EQ(top[1].first, "carol");
+  ASSERT_EQ(top[1].second, 30);
+  ASSERT_EQ(board.range_by_rank(3, 1).size(), 0U);
+}
+
+TEST_F(ScoredSetTest, UpdateTest) {
+  ASSERT_FALSE(board.insert("alice", 50));
+  ASSERT_EQ(board.at("alice"), 10);
+  ASSERT_FALSE(board.insert_or_assign("alice", 50));
+  ASSERT_EQ(board.at("alice"), 50);
+  ASSERT_EQ(board.rank("alice"), 3U);
+  ASSERT_TRUE(board.insert_or_assign("eve", 0));
+  ASSERT_EQ(board.rank("eve"), 0U);
+  ASSERT_FALSE(board.insert_or_assign("eve", 0));
+  ASSERT_EQ(board.erase("bob"), 1U);
+  ASSERT_EQ(board.erase("bob"), 0U);
+  ASSERT_FALSE(board.contains("bob"));
+  ASSERT_EQ(board.rank("dave"), 1U);
+  ASSERT_EQ(board.size(), 4U);
+  ASSERT_TRUE(board.validate());
+}
+
+TEST_F(ScoredSetTest, ScoreRangeTest) {
+  auto middle = board.range_by_score(15, 25);
+  ASSERT_EQ(middle.size(), 2U);
+  ASSERT_EQ(middle[0].first, "bob");
+  ASSERT_EQ(middle[1].first, "dave");
+  ASSERT_EQ(board.count_by_score(10, 30), 4U);
+  ASSERT_EQ(board.count_by_score(20, 20), 2U);
+  ASSERT_EQ(board.count_by_score(21, 29), 0U);
+  ASSERT_EQ(board.count_by_score(30, 10), 0U);
+  ASSERT_EQ(board.range_by_score(31, 100).size(), 0U);
+}
+
+TEST_F(ScoredSetTest, CopyMoveAndSwapTest) {
+  s21::scored_set<std::string, int> copy(board);
+  copy.insert_or_assign("alice", 100);
+  ASSERT_EQ(board.rank("alice"), 0U);
+  ASSERT_EQ(copy.rank("alice"), 3U);
+  s21::scored_set<std::string, int> moved(std::move(copy));
+  ASSERT_EQ(moved.size(), 4U);
+  ASSERT_TRUE(copy.empty());
+  copy = moved;
+  ASSERT_EQ(copy.at("alice"), 100);
+  s21::scored_set<std::string, int> other{{"zed", 1}};
+  other.swap(board);
+  ASSERT_EQ(other.size(), 4U);
+  ASSERT_EQ(board.size(), 1U);
+  board = std::move(other);
+  ASSERT_EQ(board.rank("carol"), 3U);
+  board.clear();
+  ASSERT_TRUE(board.empty());
+  ASSERT_TRUE(board.validate());
+}
+
+TEST_F(ScoredSetTest, DescendingScoreTest) {
+  s21::scored_set<int, int, std::less<int>, std::greater<int>> scores{
+      {1, 5}, {2, 9}, {3, 7}};
+  ASSERT_EQ(scores.rank(2), 0U);
+  ASSERT_EQ(scores.rank(1), 2U);
+  // With a reversed order, min is the higher score
+  ASSERT_EQ(scores.count_by_score(9, 6), 2U);
+  ASSERT_TRUE(scores.validate());
+}
+
+TEST_F(ScoredSetTest, RandomizedTest) {
+  std::mt19937 rng(11);
+  std::map<std::string, int> scores{};
+  s21::scored_set<std::string, int> actual{};
+  for (int step = 0; step < 20000; ++step) {
+    std::string member = "m" + std::to_string(rng() % 600);
+    int score = static_cast<int>(rng() % 200);
+    switch (rng() % 6) {
+      case 0:
+        ASSERT_EQ(scores.erase(member), actual.erase(member));
+        break;
+      case 1:
+        ASSERT_EQ(scores.insert({member, score}).second,
+                  actual.insert(member, score));
+        break;
+      case 2: {
+        Ranking ranking = Ranked(scores);
+        size_t first = rng() % (ranking.size() + 1);
+        size_t last = std::min(ranking.size(), first + rng() % 40);
+        AssertSameRun(ranking, first, last,
+                      actual.range_by_rank(first, first + (last - first)));
+        break;
+      }
+      case 3: {
+        int max = score + static_cast<int>(rng() % 10);
+        size_t expected = 0;
+        for (const auto &item : scores) {
+          expected += item.second >= score && item.second <= max ? 1 : 0;
+        }
+        ASSERT_EQ(expected, actual.count_by_score(score, max));
+        ASSERT_EQ(expected, actual.range_by_score(score, max).size());
+        break;
+      }
+      default:
+        ASSERT_EQ(scores.count(member) == 0,
+                  actual.insert_or_assign(member, score));
+        scores[member] = score;
+    }
+    if (step % 1000 == 0) {
+      AssertSameElements(scores, actual);
+    }
+  }
+  AssertSameElements(scores, actual);
+  ASSERT_LE(actual.stats().height, 13U);
+}
+
+}  // namespace s21
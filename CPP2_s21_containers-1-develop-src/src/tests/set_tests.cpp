@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <random>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "../s21_containers.h"
 #include "test_utils.h"
@@ -173,4 +180,456 @@ TEST_F(SetTest, SwapTest) {
   AssertContainerEquality(mySet2, mySet1_copy);
 }
 
+
+TEST_F(SetTest, CountAndBoundsTest) {
+  ASSERT_EQ(stdSetTenElements.count(5), mySetTenElements.count(5));
+  ASSERT_EQ(stdSetTenElements.count(50), mySetTenElements.count(50));
+  ASSERT_EQ(*stdSetTenElements.lower_bound(5),
+            *mySetTenElements.lower_bound(5));
+  ASSERT_EQ(*stdSetTenElements.upper_bound(5),
+            *mySetTenElements.upper_bound(5));
+  ASSERT_TRUE(mySetTenElements.upper_bound(10) == mySetTenElements.end());
+}
+
+TEST_F(SetTest, EraseByKeyTest) {
+  ASSERT_EQ(stdSetTenElements.erase(7), mySetTenElements.erase(7));
+  ASSERT_EQ(stdSetTenElements.erase(7), mySetTenElements.erase(7));
+  AssertContainerEquality(stdSetTenElements, mySetTenElements);
+}
+
+TEST_F(SetTest, TransparentLookupTest) {
+  std::set<std::string, std::less<>> stdSet{"Here", "is", "some", "words"};
+  s21::set<std::string, std::less<>> mySet{"Here", "is", "some", "words"};
+  std::string_view view = "some";
+
+  ASSERT_EQ(*stdSet.find(view), *mySet.find(view));
+  ASSERT_TRUE(mySet.find("absent") == mySet.end());
+  ASSERT_TRUE(mySet.contains("is"));
+  ASSERT_EQ(stdSet.count(view), mySet.count(view));
+  ASSERT_EQ(*stdSet.lower_bound("j"), *mySet.lower_bound("j"));
+  ASSERT_EQ(stdSet.erase(std::string("is")), mySet.erase("is"));
+  AssertContainerEquality(stdSet, mySet);
+}
+
+TEST_F(SetTest, StatsTest) {
+  s21::set<int> mySet{};
+  for (int i = 0; i < 1000; ++i) {
+    mySet.insert((i * 7919) % 1000);
+  }
+  TreeStats stats = mySet.stats();
+  ASSERT_EQ(stats.node_count, 1000U);
+  ASSERT_EQ(stats.node_count, mySet.size());
+  ASSERT_GE(stats.height, 10U);
+  ASSERT_LE(stats.height, 20U);
+  ASSERT_GE(stats.black_height, 5U);
+  ASSERT_GE(stats.bytes_used, stats.node_count * sizeof(int));
+}
+
+TEST_F(SetTest, ValidateAfterChurnTest) {
+  s21::set<int> mySet{};
+  ASSERT_TRUE(mySet.validate());
+  for (int i = 0; i < 500; ++i) {
+    mySet.insert((i * 37) % 499);
+    ASSERT_TRUE(mySet.validate());
+  }
+  for (int i = 0; i < 499; i += 2) {
+    mySet.erase(i);
+    ASSERT_TRUE(mySet.validate());
+  }
+  ASSERT_EQ(mySet.size(), 249U);
+}
+
+TEST_F(SetTest, AvlBalanceTest) {
+  std::set<int> stdSet{};
+  s21::set<int, std::less<int>, AvlBalance> mySet{};
+  for (int i = 0; i < 1000; ++i) {
+    stdSet.insert((i * 7919) % 1000);
+    mySet.insert((i * 7919) % 1000);
+  }
+  ASSERT_TRUE(mySet.validate());
+  AssertContainerEquality(stdSet, mySet);
+  ASSERT_LE(mySet.stats().height, 14U);
+  for (int i = 0; i < 1000; i += 3) {
+    stdSet.erase(i);
+    mySet.erase(i);
+    ASSERT_TRUE(mySet.validate());
+  }
+  AssertContainerEquality(stdSet, mySet);
+  s21::set<int, std::less<int>, AvlBalance> copy(mySet);
+  ASSERT_TRUE(copy.validate());
+  AssertContainerEquality(stdSet, copy);
+}
+
+TEST_F(SetTest, FindManyTest) {
+  s21::set<int> mySet{};
+  for (int i = 0; i < 200; i += 2) {
+    mySet.insert(i);
+  }
+  std::vector<int> keys;
+  for (int i = 301; i >= -5; i -= 3) {
+    keys.push_back(i);
+  }
+  std::vector<s21::set<int>::iterator> found;
+  mySet.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  std::vector<bool> present(keys.size());
+  auto end = mySet.contains_many(keys.begin(), keys.end(), present.begin());
+  ASSERT_TRUE(end == present.end());
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_TRUE(found[i] == mySet.find(keys[i]));
+    ASSERT_EQ(present[i], mySet.contains(keys[i]));
+  }
+}
+
+TEST_F(SetTest, EraseReturnsNextTest) {
+  auto next = mySetTenElements.erase(mySetTenElements.find(4));
+  auto std_next = stdSetTenElements.erase(stdSetTenElements.find(4));
+  ASSERT_EQ(*std_next, *next);
+  next = mySetTenElements.erase(mySetTenElements.find(10));
+  ASSERT_TRUE(next == mySetTenElements.end());
+  stdSetTenElements.erase(10);
+  AssertContainerEquality(stdSetTenElements, mySetTenElements);
+  ASSERT_TRUE(mySetTenElements.validate());
+}
+
+TEST_F(SetTest, EraseRangeTest) {
+  auto next = mySetTenElements.erase(mySetTenElements.find(3),
+                                     mySetTenElements.find(8));
+  auto std_next = stdSetTenElements.erase(stdSetTenElements.find(3),
+                                          stdSetTenElements.find(8));
+  ASSERT_EQ(*std_next, *next);
+  AssertContainerEquality(stdSetTenElements, mySetTenElements);
+  ASSERT_TRUE(mySetTenElements.validate());
+  next = mySetTenElements.erase(next, next);
+  ASSERT_EQ(*next, 8);
+  next = mySetTenElements.erase(mySetTenElements.begin(),
+                                mySetTenElements.end());
+  ASSERT_TRUE(next == mySetTenElements.end());
+  ASSERT_TRUE(mySetTenElements.empty());
+  mySetTenElements.insert(1);
+  ASSERT_EQ(*mySetTenElements.begin(), 1);
+}
+
+TEST_F(SetTest, EraseRangeLargeTest) {
+  s21::set<int> mySet{};
+  std::set<int> stdSet{};
+  for (int i = 0; i < 2000; ++i) {
+    mySet.insert(i);
+    stdSet.insert(i);
+  }
+  mySet.erase(mySet.lower_bound(100), mySet.lower_bound(1500));
+  stdSet.erase(stdSet.lower_bound(100), stdSet.lower_bound(1500));
+  AssertContainerEquality(stdSet, mySet);
+  ASSERT_TRUE(mySet.validate());
+}
+
+TEST_F(SetTest, ParallelReduceTest) {
+  s21::set<int> mySet{};
+  long long expected = 0;
+  for (int i = 0; i < 5000; ++i) {
+    mySet.insert(i * 3);
+    expected += i * 3;
+  }
+  for (size_t threads : {1, 2, 4, 7}) {
+    ASSERT_EQ(mySet.parallel_reduce(0LL, std::plus<long long>(), threads),
+              expected);
+  }
+  s21::set<int> emptySet{};
+  ASSERT_EQ(emptySet.parallel_reduce(5, std::plus<int>(), 4), 5);
+}
+
+TEST_F(SetTest, ParallelReduceKeepsOrderTest) {
+  s21::set<std::string> mySet{};
+  std::string expected;
+  for (char c = 'a'; c <= 'z'; ++c) {
+    for (char d = 'a'; d <= 'z'; ++d) {
+      mySet.insert(std::string{c, d});
+      expected += std::string{c, d};
+    }
+  }
+  std::string joined = mySet.parallel_reduce(std::string(), std::plus<>(), 4);
+  ASSERT_EQ(joined, expected);
+}
+
+TEST_F(SetTest, ParallelForEachTest) {
+  s21::set<int> mySet{};
+  for (int i = 0; i < 3000; ++i) {
+    mySet.insert(i);
+  }
+  std::atomic<long long> sum{0};
+  std::atomic<int> calls{0};
+  mySet.parallel_for_each(
+      [&](int key) {
+        sum += key;
+        ++calls;
+      },
+      4);
+  ASSERT_EQ(calls, 3000);
+  ASSERT_EQ(sum, 3000LL * 2999 / 2);
+  ASSERT_THROW(mySet.parallel_for_each(
+                   [](int key) {
+                     if (key == 1234) {
+                       throw std::runtime_error("stop");
+                     }
+                   },
+                   4),
+               std::runtime_error);
+}
+
+TEST_F(SetTest, ShrinkToFitTest) {
+  s21::set<int> mySet{};
+  std::set<int> stdSet{};
+  for (int i = 0; i < 20000; ++i) {
+    mySet.insert(i);
+    stdSet.insert(i);
+  }
+  size_t full = mySet.stats().bytes_used;
+  mySet.shrink_to_fit();
+  ASSERT_EQ(mySet.stats().bytes_used, full);
+  mySet.erase(mySet.find(19999));
+  mySet.erase(mySet.begin(), mySet.find(19000));
+  stdSet.erase(19999);
+  stdSet.erase(stdSet.begin(), stdSet.find(19000));
+  mySet.shrink_to_fit();
+  ASSERT_LT(mySet.stats().bytes_used, full / 2);
+  AssertContainerEquality(stdSet, mySet);
+  ASSERT_TRUE(mySet.validate());
+
+  // Erasing element by element keeps a reservation
+  mySet.reserve(64);
+  while (!mySet.empty()) {
+    mySet.erase(mySet.begin());
+  }
+  ASSERT_GT(mySet.stats().bytes_used, sizeof(int) * 64);
+  for (int i = 0; i < 64; ++i) {
+    mySet.insert(i);
+  }
+  ASSERT_EQ(mySet.size(), 64U);
+  ASSERT_TRUE(mySet.validate());
+}
+
+TEST_F(SetTest, FindFromAndLookupCacheTest) {
+  s21::set<int> mySet{};
+  std::set<int> stdSet{};
+  for (int i = 0; i < 2000; ++i) {
+    mySet.insert((i * 37) % 2000);
+    stdSet.insert((i * 37) % 2000);
+  }
+  auto finger = mySet.find(1000);
+  for (int key = 990; key < 1010; ++key) {
+    finger = mySet.find_from(finger, key);
+    ASSERT_EQ(*finger, key);
+  }
+  ASSERT_TRUE(mySet.find_from(finger, 5000) == mySet.end());
+
+  mySet.set_lookup_cache(true);
+  for (int key = 0; key < 2000; key += 2) {
+    ASSERT_EQ(mySet.count(key), 1U);
+    ASSERT_EQ(mySet.erase(key), 1U);
+    stdSet.erase(key);
+    ASSERT_FALSE(mySet.contains(key));
+    ASSERT_TRUE(mySet.contains(key + 1));
+  }
+  AssertContainerEquality(stdSet, mySet);
+  mySet.set_lookup_cache(false);
+  ASSERT_TRUE(mySet.contains(1999));
+  ASSERT_TRUE(mySet.validate());
+}
+
+// Key whose copy constructor throws once a shared budget runs out
+struct BudgetedKey {
+  static std::atomic<int> budget;
+  int value;
+
+  explicit BudgetedKey(int v = 0) : value(v) {}
+  BudgetedKey(const BudgetedKey &other) : value(other.value) {
+    if (budget.fetch_sub(1) <= 0) {
+      throw std::runtime_error("copy budget exhausted");
+    }
+  }
+  BudgetedKey &operator=(const BudgetedKey &other) = default;
+  bool operator<(const BudgetedKey &other) const {
+    return value < other.value;
+  }
+};
+
+std::atomic<int> BudgetedKey::budget{0};
+
+TEST_F(SetTest, ParallelCopyTest) {
+  BudgetedKey::budget = 1 << 30;
+  s21::set<BudgetedKey> mySet{};
+  for (int i = 0; i < 30000; ++i) {
+    mySet.insert(BudgetedKey(i));
+  }
+  s21::set<BudgetedKey> copy(mySet, 4);
+  ASSERT_EQ(copy.size(), mySet.size());
+  ASSERT_TRUE(copy.validate());
+
+  BudgetedKey::budget = 20000;
+  ASSERT_THROW(s21::set<BudgetedKey> failed(mySet, 4), std::runtime_error);
+  BudgetedKey::budget = 100;
+  ASSERT_THROW(s21::set<BudgetedKey> failed(mySet, 4), std::runtime_error);
+  BudgetedKey::budget = 10;
+  ASSERT_THROW(s21::set<BudgetedKey> failed(mySet, 4), std::runtime_error);
+  BudgetedKey::budget = 1 << 30;
+  ASSERT_TRUE(mySet.validate());
+}
+
+TEST_F(SetTest, EraseIfTest) {
+  s21::set<int, std::less<int>, AvlBalance> avlSet{};
+  s21::set<int> mySet{};
+  std::set<int> stdSet{};
+  for (int size = 1; size < 70; ++size) {
+    for (int i = 0; i < size; ++i) {
+      avlSet.insert(i);
+      mySet.insert(i);
+      stdSet.insert(i);
+    }
+    auto odd = [](int key) { return key % 2 != 0; };
+    size_t expected = stdSet.size();
+    for (auto it = stdSet.begin(); it != stdSet.end();) {
+      it = odd(*it) ? stdSet.erase(it) : std::next(it);
+    }
+    expected -= stdSet.size();
+    ASSERT_EQ(s21::erase_if(avlSet, odd), expected);
+    ASSERT_EQ(s21::erase_if(mySet, odd), expected);
+    AssertContainerEquality(stdSet, mySet);
+    AssertContainerEquality(stdSet, avlSet);
+    ASSERT_TRUE(mySet.validate());
+    ASSERT_TRUE(avlSet.validate());
+    // The rebuilt trees still take inserts and removals
+    mySet.insert(-size);
+    avlSet.insert(-size);
+    stdSet.insert(-size);
+    mySet.erase(0);
+    avlSet.erase(0);
+    stdSet.erase(0);
+    ASSERT_TRUE(mySet.validate());
+    ASSERT_TRUE(avlSet.validate());
+  }
+  AssertContainerEquality(stdSet, avlSet);
+}
+
+TEST_F(SetTest, RangeInsertTest) {
+  s21::set<int, std::less<int>, AvlBalance> avlSet{};
+  s21::set<int> mySet{};
+  std::set<int> stdSet{};
+  std::mt19937 rng(46);
+  // Batches of 1 to 400 keys against sets of up to a few thousand keys take
+  // both the one-by-one and the merging path
+  for (int round = 0; round < 40; ++round) {
+    std::vector<int> batch(1 + rng() % (round % 2 == 0 ? 400 : 20));
+    for (int &key : batch) {
+      key = static_cast<int>(rng() % 5000);
+    }
+    auto survivor = mySet.begin();
+    int first = mySet.empty() ? 0 : *survivor;
+    mySet.insert(batch.begin(), batch.end());
+    avlSet.insert(batch.begin(), batch.end());
+    stdSet.insert(batch.begin(), batch.end());
+    AssertContainerEquality(stdSet, mySet);
+    AssertContainerEquality(stdSet, avlSet);
+    ASSERT_TRUE(mySet.validate());
+    ASSERT_TRUE(avlSet.validate());
+    if (round > 0) {
+      ASSERT_EQ(*survivor, first);
+    }
+  }
+  // An ascending batch is searched for from the key before
+  std::vector<int> ascending{};
+  for (int key = 4000; key < 4100; key += 3) {
+    ascending.push_back(key);
+  }
+  mySet.insert(ascending.begin(), ascending.end());
+  stdSet.insert(ascending.begin(), ascending.end());
+  AssertContainerEquality(stdSet, mySet);
+  ASSERT_TRUE(mySet.validate());
+  const int keys[] = {3, 1, 2};
+  s21::set<int> fromEmpty{};
+  fromEmpty.insert(std::begin(keys), std::end(keys));
+  fromEmpty.insert(keys, keys);
+  std::set<int> expected{1, 2, 3};
+  AssertContainerEquality(expected, fromEmpty);
+}
+
+TEST_F(SetTest, PartitionTest) {
+  s21::set<int> mySet{};
+  s21::set<int, std::less<int>, AvlBalance> avlSet{};
+  ASSERT_EQ(mySet.partition(0).size(), 0U);
+  auto none = mySet.partition(3);
+  ASSERT_EQ(none.size(), 3U);
+  for (const auto &range : none) {
+    ASSERT_TRUE(range.first == mySet.end());
+    ASSERT_TRUE(range.second == mySet.end());
+  }
+  std::mt19937 rng(48);
+  // Small sets are cut exactly, larger ones from estimated subtree sizes;
+  // ascending inserts give the lopsided red-black shapes
+  for (int size : {1, 7, 100, 5000, 40000}) {
+    mySet.clear();
+    avlSet.clear();
+    for (int i = 0; i < size; ++i) {
+      mySet.insert(size % 2 == 0 ? static_cast<int>(rng()) : i);
+      avlSet.insert(i);
+    }
+    for (size_t k : {1U, 3U, 8U, 64U}) {
+      auto ranges = mySet.partition(k);
+      auto avlRanges = avlSet.partition(k);
+      ASSERT_EQ(ranges.size(), k);
+      ASSERT_TRUE(ranges.front().first == mySet.begin());
+      ASSERT_TRUE(ranges.back().second == mySet.end());
+      ASSERT_TRUE(avlRanges.front().first == avlSet.begin());
+      ASSERT_TRUE(avlRanges.back().second == avlSet.end());
+      size_t total = 0;
+      size_t avlTotal = 0;
+      for (size_t i = 0; i < k; ++i) {
+        if (i > 0) {
+          ASSERT_TRUE(ranges[i].first == ranges[i - 1].second);
+          ASSERT_TRUE(avlRanges[i].first == avlRanges[i - 1].second);
+        }
+        size_t count = std::distance(ranges[i].first, ranges[i].second);
+        size_t avlCount =
+            std::distance(avlRanges[i].first, avlRanges[i].second);
+        total += count;
+        avlTotal += avlCount;
+        double share = double(size) / k;
+        ASSERT_LE(count, share * 1.5 + 1);
+        ASSERT_GE(count, share * 0.5 - 1);
+        ASSERT_LE(avlCount, share * 1.5 + 1);
+        ASSERT_GE(avlCount, share * 0.5 - 1);
+      }
+      ASSERT_EQ(total, mySet.size());
+      ASSERT_EQ(avlTotal, avlSet.size());
+    }
+  }
+}
+
+TEST_F(SetTest, CopyAssignReusesNodesTest) {
+  s21::set<std::string> mySet{};
+  s21::set<std::string, std::less<std::string>, AvlBalance> avlSet{};
+  s21::set<std::string> mySource{};
+  s21::set<std::string, std::less<std::string>, AvlBalance> avlSource{};
+  std::set<std::string> stdSet{};
+  for (int i = 0; i < 500; ++i) {
+    mySet.insert("old " + std::to_string(i));
+    avlSet.insert("old " + std::to_string(i));
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 400; ++i) {
+      std::string key = std::to_string(round * 400 + i);
+      mySource.insert(key);
+      avlSource.insert(key);
+      stdSet.insert(key);
+    }
+    mySet = mySource;
+    avlSet = avlSource;
+    AssertContainerEquality(stdSet, mySet);
+    AssertContainerEquality(stdSet, avlSet);
+    ASSERT_TRUE(mySet.validate());
+    ASSERT_TRUE(avlSet.validate());
+    ASSERT_EQ(mySet.stats().height, mySource.stats().height);
+    ASSERT_EQ(avlSet.stats().height, avlSource.stats().height);
+  }
+}
+
 }  // namespace s21
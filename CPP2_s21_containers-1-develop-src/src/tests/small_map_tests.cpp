@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class SmallMapTest : public ::testing::Test {
+ protected:
+  template <typename StdMap, typename MyMap>
+  void AssertSameElements(const StdMap &expected, const MyMap &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::map<int, std::string> stdMapInt{{3, "c"}, {1, "a"}, {2, "b"}};
+  s21::small_map<int, std::string, 4> myMapInt{{3, "c"}, {1, "a"}, {2, "b"}};
+};
+
+TEST_F(SmallMapTest, DefaultConstructorTest) {
+  s21::small_map<int, int> myMap{};
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_TRUE(myMap.is_inline());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+}
+
+TEST_F(SmallMapTest, AccessTest) {
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(myMapInt.at(2), "b");
+  ASSERT_THROW(myMapInt.at(7), std::out_of_range);
+  myMapInt[2] = "B";
+  myMapInt[0] = "zero";
+  stdMapInt[2] = "B";
+  stdMapInt[0] = "zero";
+  AssertSameElements(stdMapInt, myMapInt);
+  const auto &const_map = myMapInt;
+  ASSERT_EQ(const_map.at(0), "zero");
+  ASSERT_TRUE(const_map.find(9) == const_map.end());
+}
+
+TEST_F(SmallMapTest, InsertAndPromotionTest) {
+  ASSERT_FALSE(myMapInt.insert(1, "x").second);
+  ASSERT_TRUE(myMapInt.insert(4, "d").second);
+  ASSERT_TRUE(myMapInt.is_inline());
+  ASSERT_FALSE(myMapInt.insert_or_assign(4, "D").second);
+  auto result = myMapInt.insert(std::make_pair(0, "zero"));
+  ASSERT_FALSE(myMapInt.is_inline());
+  ASSERT_EQ(result.first->second, "zero");
+  ASSERT_TRUE(myMapInt.insert_or_assign(9, "i").second);
+  stdMapInt.insert({{4, "D"}, {0, "zero"}, {9, "i"}});
+  AssertSameElements(stdMapInt, myMapInt);
+}
+
+TEST_F(SmallMapTest, EraseAndBoundsTest) {
+  myMapInt.erase(myMapInt.find(2));
+  ASSERT_EQ(myMapInt.erase(2), 0U);
+  ASSERT_EQ(myMapInt.erase(3), 1U);
+  stdMapInt.erase(2);
+  stdMapInt.erase(3);
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(myMapInt.lower_bound(0)->first, 1);
+  ASSERT_TRUE(myMapInt.upper_bound(1) == myMapInt.end());
+  ASSERT_EQ(myMapInt.count(1), 1U);
+  ASSERT_FALSE(myMapInt.contains(3));
+}
+
+TEST_F(SmallMapTest, RandomizedTest) {
+  std::mt19937 rng(11);
+  std::map<int, int> stdMap{};
+  s21::small_map<int, int, 6> myMap{};
+  for (int step = 0; step < 3000; ++step) {
+    int key = static_cast<int>(rng() % 30);
+    int value = static_cast<int>(rng() % 100);
+    switch (rng() % 3) {
+      case 0:
+        ASSERT_EQ(stdMap.erase(key), myMap.erase(key));
+        break;
+      case 1:
+        stdMap[key] = value;
+        myMap[key] = value;
+        break;
+      default:
+        ASSERT_EQ(stdMap.insert({key, value}).second,
+                  myMap.insert(key, value).second);
+    }
+    if (rng() % 40 == 0) {
+      stdMap.clear();
+      myMap.clear();
+    }
+    AssertSameElements(stdMap, myMap);
+  }
+}
+
+TEST_F(SmallMapTest, MergeSwapAndMoveTest) {
+  s21::small_map<int, std::string, 4> other{{1, "other"}, {7, "g"}};
+  myMapInt.merge(other);
+  stdMapInt.insert({7, "g"});
+  AssertSameElements(stdMapInt, myMapInt);
+  AssertSameElements(std::map<int, std::string>{{1, "other"}}, other);
+  auto results = other.insert_many(std::make_pair(5, "e"),
+                                   std::make_pair(1, "dup"));
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+
+  s21::small_map<int, std::string, 4> copy(myMapInt);
+  copy.swap(other);
+  AssertSameElements(stdMapInt, other);
+  s21::small_map<int, std::string, 4> moved(std::move(other));
+  AssertSameElements(stdMapInt, moved);
+  ASSERT_TRUE(other.empty());
+  moved = copy;
+  ASSERT_EQ(moved.size(), 2U);
+}
+}  // namespace s21
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class SmallSetTest : public ::testing::Test {
+ protected:
+  template <typename StdSet, typename MySet>
+  void AssertSameElements(const StdSet &expected, const MySet &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &key : expected) {
+      ASSERT_EQ(key, *iter);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::set<int> stdSetInt{5, 1, 3};
+  s21::small_set<int, 4> mySetInt{5, 1, 3};
+};
+
+TEST_F(SmallSetTest, DefaultConstructorTest) {
+  s21::small_set<int> mySet{};
+  ASSERT_TRUE(mySet.empty());
+  ASSERT_TRUE(mySet.is_inline());
+  ASSERT_TRUE(mySet.begin() == mySet.end());
+}
+
+TEST_F(SmallSetTest, InlineInsertTest) {
+  AssertSameElements(stdSetInt, mySetInt);
+  ASSERT_FALSE(mySetInt.insert(3).second);
+  auto result = mySetInt.insert(2);
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(*result.first, 2);
+  stdSetInt.insert(2);
+  AssertSameElements(stdSetInt, mySetInt);
+  ASSERT_TRUE(mySetInt.is_inline());
+}
+
+TEST_F(SmallSetTest, PromotionTest) {
+  mySetInt.insert(2);
+  ASSERT_TRUE(mySetInt.is_inline());
+  auto result = mySetInt.insert(4);
+  ASSERT_FALSE(mySetInt.is_inline());
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(*result.first, 4);
+  stdSetInt.insert({2, 4});
+  AssertSameElements(stdSetInt, mySetInt);
+  ASSERT_EQ(mySetInt.erase(1), 1U);
+  stdSetInt.erase(1);
+  AssertSameElements(stdSetInt, mySetInt);
+  mySetInt.clear();
+  ASSERT_TRUE(mySetInt.is_inline());
+  ASSERT_TRUE(mySetInt.empty());
+}
+
+TEST_F(SmallSetTest, LookupTest) {
+  for (int key = 0; key < 7; ++key) {
+    ASSERT_EQ(stdSetInt.count(key), mySetInt.count(key));
+    ASSERT_EQ(stdSetInt.count(key) != 0, mySetInt.contains(key));
+    ASSERT_EQ(stdSetInt.lower_bound(key) == stdSetInt.end(),
+              mySetInt.lower_bound(key) == mySetInt.end());
+    ASSERT_EQ(stdSetInt.upper_bound(key) == stdSetInt.end(),
+              mySetInt.upper_bound(key) == mySetInt.end());
+  }
+  ASSERT_EQ(*mySetInt.lower_bound(2), 3);
+  ASSERT_EQ(*mySetInt.upper_bound(3), 5);
+  ASSERT_TRUE(mySetInt.find(4) == mySetInt.end());
+  ASSERT_EQ(*mySetInt.find(5), 5);
+}
+
+TEST_F(SmallSetTest, EraseTest) {
+  mySetInt.erase(mySetInt.find(3));
+  ASSERT_EQ(mySetInt.erase(3), 0U);
+  stdSetInt.erase(3);
+  AssertSameElements(stdSetInt, mySetInt);
+  auto iter = mySetInt.end();
+  --iter;
+  ASSERT_EQ(*iter, 5);
+}
+
+TEST_F(SmallSetTest, RandomizedTest) {
+  std::mt19937 rng(3);
+  std::set<std::string> stdSet{};
+  s21::small_set<std::string, 8> mySet{};
+  for (int step = 0; step < 3000; ++step) {
+    std::string key = std::to_string(rng() % 40);
+    if (rng() % 2 == 0) {
+      ASSERT_EQ(stdSet.erase(key), mySet.erase(key));
+    } else {
+      ASSERT_EQ(stdSet.insert(key).second, mySet.insert(key).second);
+    }
+    if (rng() % 50 == 0) {
+      stdSet.clear();
+      mySet.clear();
+    }
+    AssertSameElements(stdSet, mySet);
+  }
+}
+
+TEST_F(SmallSetTest, MergeTest) {
+  s21::small_set<int, 4> other{1, 2, 9};
+  mySetInt.merge(other);
+  stdSetInt.insert({2, 9});
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1}, other);
+  auto results = other.insert_many(7, 7, 0);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_TRUE(results[2].second);
+}
+
+TEST_F(SmallSetTest, CopySwapAndMoveTest) {
+  s21::small_set<std::string, 2> inline_set{"b", "a"};
+  s21::small_set<std::string, 2> tree_set{"x", "y", "z"};
+  ASSERT_TRUE(inline_set.is_inline());
+  ASSERT_FALSE(tree_set.is_inline());
+  s21::small_set<std::string, 2> copy(tree_set);
+  copy.erase("x");
+  ASSERT_EQ(tree_set.size(), 3U);
+  inline_set.swap(tree_set);
+  AssertSameElements(std::set<std::string>{"x", "y", "z"}, inline_set);
+  AssertSameElements(std::set<std::string>{"a", "b"}, tree_set);
+  s21::small_set<std::string, 2> moved(std::move(tree_set));
+  AssertSameElements(std::set<std::string>{"a", "b"}, moved);
+  ASSERT_TRUE(tree_set.empty());
+  moved = inline_set;
+  AssertSameElements(std::set<std::string>{"x", "y", "z"}, moved);
+  inline_set = std::move(copy);
+  AssertSameElements(std::set<std::string>{"y", "z"}, inline_set);
+}
+}  // namespace s21
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class SplayMapTest : public ::testing::Test {
+ protected:
+  template <typename StdMap, typename MyMap>
+  void AssertSameElements(const StdMap &expected, const MyMap &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+    ASSERT_TRUE(actual.validate());
+  }
+
+  std::map<int, std::string> stdMapInt{{3, "c"}, {1, "a"}, {2, "b"}};
+  s21::splay_map<int, std::string> myMapInt{{3, "c"}, {1, "a"}, {2, "b"}};
+};
+
+TEST_F(SplayMapTest, DefaultConstructorTest) {
+  s21::splay_map<int, int> myMap{};
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+  ASSERT_THROW(myMap.at(1), std::out_of_range);
+}
+
+TEST_F(SplayMapTest, AccessTest) {
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(myMapInt.at(2), "b");
+  myMapInt.at(2) = "B";
+  myMapInt[4] = "d";
+  ASSERT_EQ(myMapInt[1], "a");
+  stdMapInt[2] = "B";
+  stdMapInt[4] = "d";
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_THROW(myMapInt.at(5), std::out_of_range);
+}
+
+TEST_F(SplayMapTest, InsertTest) {
+  ASSERT_FALSE(myMapInt.insert(1, "x").second);
+  ASSERT_TRUE(myMapInt.insert(std::make_pair(0, "z")).second);
+  ASSERT_FALSE(myMapInt.insert_or_assign(3, "C").second);
+  ASSERT_TRUE(myMapInt.insert_or_assign(7, "g").second);
+  stdMapInt.insert({0, "z"});
+  stdMapInt[3] = "C";
+  stdMapInt[7] = "g";
+  AssertSameElements(stdMapInt, myMapInt);
+  auto results = myMapInt.insert_many(std::make_pair(8, "h"),
+                                      std::make_pair(8, "i"));
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_EQ(myMapInt.at(8), "h");
+}
+
+TEST_F(SplayMapTest, EraseAndLookupTest) {
+  ASSERT_EQ(myMapInt.find(2)->second, "b");
+  ASSERT_TRUE(myMapInt.find(9) == myMapInt.end());
+  ASSERT_TRUE(myMapInt.contains(3));
+  ASSERT_EQ(myMapInt.count(4), 0U);
+  ASSERT_EQ(myMapInt.lower_bound(2)->first, 2);
+  ASSERT_EQ(myMapInt.upper_bound(2)->first, 3);
+  ASSERT_EQ(myMapInt.erase(myMapInt.find(1))->first, 2);
+  ASSERT_EQ(myMapInt.erase(3), 1U);
+  stdMapInt.erase(1);
+  stdMapInt.erase(3);
+  AssertSameElements(stdMapInt, myMapInt);
+}
+
+TEST_F(SplayMapTest, RandomizedTest) {
+  std::mt19937 rng(5);
+  std::map<int, int> stdMap{};
+  s21::splay_map<int, int> myMap{};
+  // Mostly hits on a few hot keys, as the container is meant for
+  for (int step = 0; step < 20000; ++step) {
+    int key = rng() % 10 == 0 ? static_cast<int>(rng() % 5000)
+                              : static_cast<int>(rng() % 8);
+    switch (rng() % 5) {
+      case 0:
+        ASSERT_EQ(stdMap.erase(key), myMap.erase(key));
+        break;
+      case 1:
+        ASSERT_EQ(stdMap.count(key), myMap.count(key));
+        break;
+      case 2:
+        stdMap[key] += step;
+        myMap[key] += step;
+        break;
+      default:
+        ASSERT_EQ(stdMap.insert({key, step}).second,
+                  myMap.insert(key, step).second);
+    }
+    if (step % 500 == 0) {
+      AssertSameElements(stdMap, myMap);
+    }
+  }
+  AssertSameElements(stdMap, myMap);
+}
+
+TEST_F(SplayMapTest, MergeSwapAndCopyTest) {
+  s21::splay_map<int, std::string> other{{1, "x"}, {5, "e"}};
+  myMapInt.merge(other);
+  stdMapInt[5] = "e";
+  AssertSameElements(stdMapInt, myMapInt);
+  AssertSameElements(std::map<int, std::string>{{1, "x"}}, other);
+  const s21::splay_map<int, std::string> copy(myMapInt);
+  myMapInt.swap(other);
+  AssertSameElements(stdMapInt, copy);
+  AssertSameElements(stdMapInt, other);
+  AssertSameElements(std::map<int, std::string>{{1, "x"}}, myMapInt);
+  myMapInt = std::move(other);
+  AssertSameElements(stdMapInt, myMapInt);
+  myMapInt.clear();
+  ASSERT_TRUE(myMapInt.empty());
+}
+}  // namespace s21
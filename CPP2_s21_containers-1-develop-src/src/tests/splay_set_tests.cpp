@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class SplaySetTest : public ::testing::Test {
+ protected:
+  template <typename StdSet, typename MySet>
+  void AssertSameElements(const StdSet &expected, const MySet &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &key : expected) {
+      ASSERT_EQ(key, *iter);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+    ASSERT_TRUE(actual.validate());
+  }
+
+  std::set<int> stdSetInt{5, 1, 3, 8, 2};
+  s21::splay_set<int> mySetInt{5, 1, 3, 8, 2};
+};
+
+TEST_F(SplaySetTest, DefaultConstructorTest) {
+  s21::splay_set<int> mySet{};
+  ASSERT_TRUE(mySet.empty());
+  ASSERT_TRUE(mySet.begin() == mySet.end());
+  ASSERT_TRUE(mySet.find(1) == mySet.end());
+  ASSERT_EQ(mySet.erase(1), 0U);
+  ASSERT_TRUE(mySet.validate());
+}
+
+TEST_F(SplaySetTest, InsertAndLookupTest) {
+  AssertSameElements(stdSetInt, mySetInt);
+  ASSERT_FALSE(mySetInt.insert(3).second);
+  ASSERT_EQ(*mySetInt.insert(4).first, 4);
+  stdSetInt.insert(4);
+  for (int key = 0; key < 10; ++key) {
+    ASSERT_EQ(stdSetInt.count(key), mySetInt.count(key));
+    auto lower = stdSetInt.lower_bound(key);
+    auto upper = stdSetInt.upper_bound(key);
+    ASSERT_EQ(lower == stdSetInt.end(),
+              mySetInt.lower_bound(key) == mySetInt.end());
+    ASSERT_EQ(upper == stdSetInt.end(),
+              mySetInt.upper_bound(key) == mySetInt.end());
+    if (lower != stdSetInt.end()) {
+      ASSERT_EQ(*lower, *mySetInt.lower_bound(key));
+    }
+    if (upper != stdSetInt.end()) {
+      ASSERT_EQ(*upper, *mySetInt.upper_bound(key));
+    }
+    AssertSameElements(stdSetInt, mySetInt);
+  }
+  auto iter = mySetInt.end();
+  --iter;
+  ASSERT_EQ(*iter, 8);
+  ASSERT_EQ(*--iter, 5);
+}
+
+TEST_F(SplaySetTest, EraseTest) {
+  auto next = mySetInt.erase(mySetInt.find(3));
+  ASSERT_EQ(*next, 5);
+  ASSERT_TRUE(mySetInt.erase(mySetInt.find(8)) == mySetInt.end());
+  ASSERT_EQ(mySetInt.erase(3), 0U);
+  ASSERT_EQ(mySetInt.erase(1), 1U);
+  stdSetInt.erase(3);
+  stdSetInt.erase(8);
+  stdSetInt.erase(1);
+  AssertSameElements(stdSetInt, mySetInt);
+}
+
+TEST_F(SplaySetTest, AccessedKeysMoveUpTest) {
+  s21::splay_set<int> mySet{};
+  // Ascending inserts leave a single path
+  for (int key = 0; key < 1000; ++key) {
+    mySet.insert(key);
+  }
+  ASSERT_EQ(mySet.stats().height, 1000U);
+  mySet.find(0);
+  ASSERT_LT(mySet.stats().height, 600U);
+  for (int round = 0; round < 10; ++round) {
+    for (int key = 0; key < 1000; key += 97) {
+      mySet.find(key);
+    }
+  }
+  ASSERT_TRUE(mySet.validate());
+  // A copy is rebuilt balanced
+  s21::splay_set<int> copy(mySet);
+  ASSERT_EQ(copy.stats().height, 10U);
+  AssertSameElements(std::set<int>(mySet.begin(), mySet.end()), copy);
+}
+
+TEST_F(SplaySetTest, RandomizedTest) {
+  std::mt19937 rng(11);
+  std::set<std::string> stdSet{};
+  s21::splay_set<std::string> mySet{};
+  for (int step = 0; step < 5000; ++step) {
+    std::string key = std::to_string(rng() % 200);
+    switch (rng() % 4) {
+      case 0:
+        ASSERT_EQ(stdSet.erase(key), mySet.erase(key));
+        break;
+      case 1:
+        ASSERT_EQ(stdSet.count(key), mySet.count(key));
+        break;
+      default:
+        ASSERT_EQ(stdSet.insert(key).second, mySet.insert(key).second);
+    }
+    if (step % 50 == 0) {
+      AssertSameElements(stdSet, mySet);
+    }
+  }
+  AssertSameElements(stdSet, mySet);
+}
+
+TEST_F(SplaySetTest, MergeCopyAndMoveTest) {
+  s21::splay_set<int> other{1, 2, 9, 11};
+  mySetInt.merge(other);
+  stdSetInt.insert({9, 11});
+  AssertSameElements(stdSetInt, mySetInt);
+  AssertSameElements(std::set<int>{1, 2}, other);
+  auto results = other.insert_many(7, 7, 0);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_TRUE(results[2].second);
+
+  s21::splay_set<int> copy(mySetInt);
+  copy.erase(5);
+  AssertSameElements(stdSetInt, mySetInt);
+  mySetInt.swap(other);
+  AssertSameElements(std::set<int>{0, 1, 2, 7}, mySetInt);
+  s21::splay_set<int> moved(std::move(other));
+  AssertSameElements(stdSetInt, moved);
+  ASSERT_TRUE(other.empty());
+  moved = copy;
+  stdSetInt.erase(5);
+  AssertSameElements(stdSetInt, moved);
+  mySetInt = std::move(copy);
+  AssertSameElements(stdSetInt, mySetInt);
+  mySetInt.clear();
+  ASSERT_TRUE(mySetInt.empty());
+}
+}  // namespace s21
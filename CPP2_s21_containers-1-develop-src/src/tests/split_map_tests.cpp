@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../s21_containersplus.h"
+#include "test_utils.h"
+
+namespace s21 {
+class SplitMapTest : public ::testing::Test {
+ protected:
+  template <typename StdMap, typename MyMap>
+  void AssertSameElements(const StdMap &expected, const MyMap &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.empty(), actual.empty());
+    auto iter = actual.begin();
+    for (const auto &item : expected) {
+      ASSERT_EQ(item.first, iter->first);
+      ASSERT_EQ(item.second, iter->second);
+      ++iter;
+    }
+    ASSERT_TRUE(iter == actual.end());
+  }
+
+  std::map<int, std::string> stdMapInt{{5, "e"}, {1, "a"}, {3, "c"}};
+  s21::split_map<int, std::string> myMapInt{{5, "e"}, {1, "a"}, {3, "c"}};
+};
+
+TEST_F(SplitMapTest, DefaultConstructorTest) {
+  s21::split_map<int, int> myMap{};
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_EQ(myMap.size(), 0U);
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+}
+
+TEST_F(SplitMapTest, ListConstructorTest) {
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_TRUE(myMapInt.validate());
+}
+
+TEST_F(SplitMapTest, CopyAndMoveTest) {
+  s21::split_map<int, std::string> copy(myMapInt);
+  copy[1] = "A";
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_EQ(copy.at(1), "A");
+
+  s21::split_map<int, std::string> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.at(1), "A");
+
+  copy = myMapInt;
+  AssertSameElements(stdMapInt, copy);
+  copy = std::move(moved);
+  ASSERT_EQ(copy.at(1), "A");
+  ASSERT_EQ(copy.size(), 3U);
+  ASSERT_TRUE(copy.validate());
+}
+
+TEST_F(SplitMapTest, ElementAccessTest) {
+  ASSERT_EQ(myMapInt.at(3), "c");
+  ASSERT_THROW(myMapInt.at(4), std::out_of_range);
+  const auto &constMap = myMapInt;
+  ASSERT_EQ(constMap.at(5), "e");
+  ASSERT_THROW(constMap.at(4), std::out_of_range);
+  myMapInt[4] = "d";
+  stdMapInt[4] = "d";
+  ASSERT_EQ(myMapInt[2], "");
+  stdMapInt[2];
+  AssertSameElements(stdMapInt, myMapInt);
+}
+
+TEST_F(SplitMapTest, InsertTest) {
+  auto inserted = myMapInt.insert(2, "b");
+  ASSERT_TRUE(inserted.second);
+  ASSERT_EQ(inserted.first->first, 2);
+  ASSERT_EQ(inserted.first->second, "b");
+  ASSERT_FALSE(myMapInt.insert({2, "x"}).second);
+  ASSERT_EQ(myMapInt.at(2), "b");
+  ASSERT_FALSE(myMapInt.insert_or_assign(2, "B").second);
+  ASSERT_TRUE(myMapInt.insert_or_assign(7, "g").second);
+  stdMapInt.insert({2, "B"});
+  stdMapInt.insert({7, "g"});
+  AssertSameElements(stdMapInt, myMapInt);
+  ASSERT_TRUE(myMapInt.validate());
+}
+
+TEST_F(SplitMapTest, IteratorTest) {
+  for (auto it = myMapInt.begin(); it != myMapInt.end(); ++it) {
+    it->second += "!";
+  }
+  for (auto &item : stdMapInt) {
+    item.second += "!";
+  }
+  AssertSameElements(stdMapInt, myMapInt);
+  s21::split_map<int, std::string>::const_iterator last = myMapInt.find(5);
+  ASSERT_EQ((*last).first, 5);
+  ASSERT_EQ((*last).second, "e!");
+  --last;
+  ASSERT_EQ(last->first, 3);
+  ASSERT_TRUE(last++ == myMapInt.find(3));
+  ASSERT_TRUE(++last == myMapInt.end());
+}
+
+TEST_F(SplitMapTest, LookupTest) {
+  ASSERT_TRUE(myMapInt.contains(1));
+  ASSERT_FALSE(myMapInt.contains(2));
+  ASSERT_EQ(myMapInt.count(3), 1U);
+  ASSERT_TRUE(myMapInt.find(2) == myMapInt.end());
+  ASSERT_EQ(myMapInt.lower_bound(2)->first, 3);
+  ASSERT_EQ(myMapInt.upper_bound(3)->first, 5);
+  ASSERT_TRUE(myMapInt.upper_bound(5) == myMapInt.end());
+}
+
+TEST_F(SplitMapTest, EraseTest) {
+  ASSERT_EQ(myMapInt.erase(3), 1U);
+  ASSERT_EQ(myMapInt.erase(3), 0U);
+  stdMapInt.erase(3);
+  AssertSameElements(stdMapInt, myMapInt);
+  auto next = myMapInt.erase(myMapInt.begin());
+  ASSERT_EQ(next->first, 5);
+  stdMapInt.erase(1);
+  AssertSameElements(stdMapInt, myMapInt);
+  myMapInt.clear();
+  ASSERT_TRUE(myMapInt.empty());
+  myMapInt.insert(9, "i");
+  ASSERT_EQ(myMapInt.at(9), "i");
+}
+
+TEST_F(SplitMapTest, ChurnTest) {
+  s21::split_map<int, std::string> myMap{};
+  std::map<int, std::string> stdMap{};
+  myMap.reserve(1000);
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 1009;
+    if (i % 3 == 2) {
+      ASSERT_EQ(myMap.erase(key), stdMap.erase(key));
+    } else {
+      myMap.insert_or_assign(key, std::to_string(i));
+      stdMap[key] = std::to_string(i);
+    }
+  }
+  AssertSameElements(stdMap, myMap);
+  ASSERT_TRUE(myMap.validate());
+  s21::split_map<int, std::string> other{{-1, "z"}};
+  other.swap(myMap);
+  AssertSameElements(stdMap, other);
+  ASSERT_EQ(myMap.at(-1), "z");
+}
+
+}  // namespace s21